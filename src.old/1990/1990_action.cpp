@@ -42,6 +42,25 @@
 #include "1990_gtk_actions.hpp"
 #endif
 
+#ifdef HAVE_BLAS
+extern "C" void dgemm_ (const char   *transa,
+                        const char   *transb,
+                        const int    *m,
+                        const int    *n,
+                        const int    *k,
+                        const double *alpha,
+                        const double *a,
+                        const int    *lda,
+                        const double *b,
+                        const int    *ldb,
+                        const double *beta,
+                        double       *c,
+                        const int    *ldc);
+#endif
+
+/// Taille des blocs du produit de matrices et des paquets de pondérations.
+#define TAILLE_BLOC 64U
+
 }
 
 /**
@@ -1005,26 +1024,309 @@ _1990_action_ponderation_resultat_free_calculs (Action *action)
 }
 
 /**
- * \brief Crée une fausse action sur la base d'une combinaison. L'objectif est
- *        uniquement de regrouper les résultats pondérés de chaque action.
- * \param ponderation : pondération selon laquelle sera créée l'action,
+ * \brief Calcule les coefficients d'une pondération sans évaluer ses
+ *        résultats. Le coefficient de chaque action est le produit de sa
+ *        pondération et, si nécessaire, de son coefficient psi. Une action
+ *        apparaissant plusieurs fois voit ses coefficients cumulés.
+ * \param ponderation : la pondération à convertir,
+ * \param resultat : le résultat à la demande, vide.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - ponderation == NULL,
+ *     - resultat == NULL.
+ */
+bool
+_1990_action_ponderation_coefs (std::list <Ponderation *> *ponderation,
+                                Ponderation_Resultat      *resultat)
+{
+  std::list <Ponderation *>::iterator it;
+  
+  BUGPARAM (ponderation, "%p", ponderation, false)
+  BUGPARAM (resultat, "%p", resultat, false)
+  
+  resultat->actions.clear ();
+  resultat->coefs.clear ();
+  
+  it = ponderation->begin ();
+  while (it != ponderation->end ())
+  {
+    Ponderation *element = *it;
+    double       mult;
+    size_t       i;
+    
+    mult = element->ponderation *
+                             (element->psi == 0 ? m_g (element->action->psi0) :
+                              element->psi == 1 ? m_g (element->action->psi1) :
+                              element->psi == 2 ? m_g (element->action->psi2) :
+                               1.);
+    
+    i = (size_t) (std::find (resultat->actions.begin (),
+                             resultat->actions.end (),
+                             element->action) - resultat->actions.begin ());
+    if (i == resultat->actions.size ())
+    {
+      resultat->actions.push_back (element->action);
+      resultat->coefs.push_back (mult);
+    }
+    else
+    {
+      resultat->coefs[i] += mult;
+    }
+    
+    ++it;
+  }
+  
+  return true;
+}
+
+/**
+ * \brief Renvoie la valeur en x d'une courbe d'une barre pour une pondération,
+ *        par combinaison linéaire des courbes des actions. Une action dont la
+ *        courbe n'est pas définie en x n'y contribue pas, comme pour la somme
+ *        des fonctions.
+ * \param resultat : le résultat de la pondération,
+ * \param renvoie : la fonction renvoyant la courbe d'une action,
+ * \param composante : la composante de la courbe,
+ * \param barre : la position de la barre dans la liste des barres,
+ * \param x : l'abscisse,
+ * \param position : voir #common_fonction_y.
+ * \return
+ *   Succès : la valeur.\n
+ *   Échec : NAN :
+ *     - aucune action n'est définie en x,
+ *     - #common_fonction_y.
+ */
+static double
+_1990_action_ponderation_fonction_y (
+  Ponderation_Resultat *resultat,
+  Fonction           *(*renvoie) (Action *, uint8_t, uint32_t),
+  uint8_t               composante,
+  uint32_t              barre,
+  double                x,
+  int8_t                position)
+{
+  double somme = 0.;
+  bool   trouve = false;
+  size_t i;
+  
+  for (i = 0; i < resultat->actions.size (); i++)
+  {
+    Fonction *fonction;
+    double    y;
+    
+    BUG (fonction = renvoie (resultat->actions[i], composante, barre), NAN)
+    
+    y = common_fonction_y (fonction, x, position);
+    if (!std::isnan (y))
+    {
+      somme += resultat->coefs[i] * y;
+      trouve = true;
+    }
+  }
+  
+  if (!trouve)
+  {
+    return NAN;
+  }
+  
+  return somme;
+}
+
+/**
+ * \brief Renvoie l'effort en x dans une barre pour une pondération.
+ * \param resultat : le résultat de la pondération,
+ * \param effort : l'effort (N : 0, T<sub>y</sub> : 1, T<sub>z</sub> : 2,
+ *                 M<sub>x</sub> : 3, M<sub>y</sub> : 4, M<sub>z</sub> : 5),
+ * \param barre : la position de la barre dans la liste des barres,
+ * \param x : l'abscisse,
+ * \param position : voir #common_fonction_y.
+ * \return
+ *   Succès : la valeur de l'effort.\n
+ *   Échec : NAN :
+ *     - resultat == NULL,
+ *     - effort > 5,
+ *     - #_1990_action_ponderation_fonction_y.
+ */
+double
+_1990_action_ponderation_efforts_y (Ponderation_Resultat *resultat,
+                                    uint8_t               effort,
+                                    uint32_t              barre,
+                                    double                x,
+                                    int8_t                position)
+{
+  BUGPARAM (resultat, "%p", resultat, NAN)
+  BUGPARAM (effort, "%d", effort <= 5, NAN)
+  
+  return _1990_action_ponderation_fonction_y (resultat,
+                                              _1990_action_efforts_renvoie,
+                                              effort,
+                                              barre,
+                                              x,
+                                              position);
+}
+
+/**
+ * \brief Renvoie la rotation en x dans une barre pour une pondération.
+ * \param resultat : le résultat de la pondération,
+ * \param effort : l'effort (r<sub>x</sub> : 0, r<sub>y</sub> : 1,
+ *                 r<sub>z</sub> : 2),
+ * \param barre : la position de la barre dans la liste des barres,
+ * \param x : l'abscisse,
+ * \param position : voir #common_fonction_y.
+ * \return
+ *   Succès : la valeur de la rotation.\n
+ *   Échec : NAN :
+ *     - resultat == NULL,
+ *     - effort > 2,
+ *     - #_1990_action_ponderation_fonction_y.
+ */
+double
+_1990_action_ponderation_rotation_y (Ponderation_Resultat *resultat,
+                                     uint8_t               effort,
+                                     uint32_t              barre,
+                                     double                x,
+                                     int8_t                position)
+{
+  BUGPARAM (resultat, "%p", resultat, NAN)
+  BUGPARAM (effort, "%d", effort <= 2, NAN)
+  
+  return _1990_action_ponderation_fonction_y (resultat,
+                                              _1990_action_rotation_renvoie,
+                                              effort,
+                                              barre,
+                                              x,
+                                              position);
+}
+
+/**
+ * \brief Renvoie la déformation en x dans une barre pour une pondération.
+ * \param resultat : le résultat de la pondération,
+ * \param effort : l'effort (u<sub>x</sub> : 0, u<sub>y</sub> : 1,
+ *                 u<sub>z</sub> : 2),
+ * \param barre : la position de la barre dans la liste des barres,
+ * \param x : l'abscisse,
+ * \param position : voir #common_fonction_y.
+ * \return
+ *   Succès : la valeur de la déformation.\n
+ *   Échec : NAN :
+ *     - resultat == NULL,
+ *     - effort > 2,
+ *     - #_1990_action_ponderation_fonction_y.
+ */
+double
+_1990_action_ponderation_deformation_y (Ponderation_Resultat *resultat,
+                                        uint8_t               effort,
+                                        uint32_t              barre,
+                                        double                x,
+                                        int8_t                position)
+{
+  BUGPARAM (resultat, "%p", resultat, NAN)
+  BUGPARAM (effort, "%d", effort <= 2, NAN)
+  
+  return _1990_action_ponderation_fonction_y (resultat,
+                                              _1990_action_deformation_renvoie,
+                                              effort,
+                                              barre,
+                                              x,
+                                              position);
+}
+
+/**
+ * \brief Renvoie le déplacement d'un noeud pour une pondération.
+ * \param resultat : le résultat de la pondération,
+ * \param noeud : le noeud,
+ * \param indice : 0 si Ux, 1 si Uy, 2 si Uz, 3 si rx, 4 si ry et 5 si rz.
+ * \return
+ *   Succès : le déplacement.\n
+ *   Échec : NAN :
+ *     - resultat == NULL,
+ *     - noeud == NULL,
+ *     - indice > 5.
+ */
+double
+_1990_action_ponderation_deplacement (Ponderation_Resultat *resultat,
+                                      EF_Noeud             *noeud,
+                                      uint8_t               indice)
+{
+  double somme = 0.;
+  size_t i;
+  
+  BUGPARAM (resultat, "%p", resultat, NAN)
+  BUGPARAM (noeud, "%p", noeud, NAN)
+  BUGPARAM (indice, "%d", indice <= 5, NAN)
+  
+  for (i = 0; i < resultat->actions.size (); i++)
+  {
+    double *x = (double *) resultat->actions[i]->deplacement->x;
+    
+    somme += resultat->coefs[i] * x[noeud->indice * 6 + indice];
+  }
+  
+  return somme;
+}
+
+/**
+ * \brief Renvoie la réaction d'appui d'un noeud pour une pondération.
+ * \param resultat : le résultat de la pondération,
+ * \param noeud : le noeud,
+ * \param indice : 0 si Fx, 1 si Fy, 2 si Fz, 3 si Mx, 4 si My et 5 si Mz.
+ * \return
+ *   Succès : la réaction d'appui.\n
+ *   Échec : NAN :
+ *     - resultat == NULL,
+ *     - noeud == NULL,
+ *     - indice > 5.
+ */
+double
+_1990_action_ponderation_reaction_appui (Ponderation_Resultat *resultat,
+                                         EF_Noeud             *noeud,
+                                         uint8_t               indice)
+{
+  double somme = 0.;
+  size_t i;
+  
+  BUGPARAM (resultat, "%p", resultat, NAN)
+  BUGPARAM (noeud, "%p", noeud, NAN)
+  BUGPARAM (indice, "%d", indice <= 5, NAN)
+  
+  for (i = 0; i < resultat->actions.size (); i++)
+  {
+    double *x = (double *) resultat->actions[i]->efforts_noeuds->x;
+    
+    somme += resultat->coefs[i] * x[noeud->indice * 6 + indice];
+  }
+  
+  return somme;
+}
+
+/**
+ * \brief Crée une fausse action contenant l'ensemble des résultats d'une
+ *        pondération évaluée à la demande. Cette conversion est coûteuse en
+ *        mémoire et ne doit être faite que si tous les résultats sont
+ *        nécessaires.
+ * \param resultat : le résultat de la pondération,
  * \param p : la variable projet.
  * \return
  *   Succès : pointeur vers l'action équivalente créée.\n
  *   Échec : NULL :
+ *     - resultat == NULL,
  *     - p == NULL,
  *     - aucun noeud n'existe,
  *     - en cas d'erreur d'allocation mémoire (#_1990_action_fonction_init,
  *       #common_fonction_ajout_fonction).
  */
 Action *
-_1990_action_ponderation_resultat (std::list <Ponderation *> *ponderation,
-                                   Projet                    *p)
+_1990_action_ponderation_materialise (Ponderation_Resultat *resultat,
+                                      Projet               *p)
 {
-  std::list <Ponderation *>::iterator it;
   Action *action;
   double *x, *y;
+  size_t  i, j;
+  
+  std::vector <Fonction *> fonctions;
   
+  BUGPARAM (resultat, "%p", resultat, NULL)
   BUGPARAM (p, "%p", p, NULL)
   INFO (!p->modele.noeuds.empty (),
         NULL,
@@ -1034,16 +1336,21 @@ _1990_action_ponderation_resultat (std::list <Ponderation *> *ponderation,
   action = new Action;
   action->efforts_noeuds = new cholmod_sparse;
   action->efforts_noeuds->x = new double [p->modele.noeuds.size () * 6];
-  memset (action->efforts_noeuds->x, 0, p->modele.noeuds.size () * 6);
+  memset (action->efforts_noeuds->x,
+          0,
+          sizeof (double) * p->modele.noeuds.size () * 6);
   action->deplacement = new cholmod_sparse;
   action->deplacement->x = new double [p->modele.noeuds.size () * 6];
-  memset (action->deplacement->x, 0, p->modele.noeuds.size () * 6);
+  memset (action->deplacement->x,
+          0,
+          sizeof (double) * p->modele.noeuds.size () * 6);
   BUG (_1990_action_fonction_init (p, action),
        NULL,
        _1990_action_ponderation_resultat_free_calculs (action);
          delete action; )
   x = (double *) action->efforts_noeuds->x;
   y = (double *) action->deplacement->x;
+  fonctions.resize (resultat->actions.size ());
   
 #define FREE_ALL \
   _1990_action_fonction_free (action); \
@@ -1051,91 +1358,65 @@ _1990_action_ponderation_resultat (std::list <Ponderation *> *ponderation,
   delete action;
   
   // Remplissage de la variable action.
-  it = ponderation->begin ();
-  while (it != ponderation->end ())
+  for (j = 0; j < resultat->actions.size (); j++)
   {
-    Ponderation *element = *it;
-    double      *x2 = (double *) element->action->efforts_noeuds->x;
-    double      *y2 = (double *) element->action->deplacement->x;
-    double       mult;
-    uint32_t     i;
+    Action *element = resultat->actions[j];
+    double *x2 = (double *) element->efforts_noeuds->x;
+    double *y2 = (double *) element->deplacement->x;
+    double  mult = resultat->coefs[j];
     
-    mult = element->ponderation *
-                             (element->psi == 0 ? m_g (element->action->psi0) :
-                              element->psi == 1 ? m_g (element->action->psi1) :
-                              element->psi == 2 ? m_g (element->action->psi2) :
-                               1.);
     for (i = 0; i < p->modele.noeuds.size () * 6; i++)
     {
       x[i] = x[i] + mult*x2[i];
       y[i] = y[i] + mult*y2[i];
     }
+  }
+  
+  // Les courbes de chaque barre sont obtenues par une seule somme pondérée
+  // de toutes les actions.
+  for (j = 0; j < p->modele.barres.size (); j++)
+  {
+    uint8_t k;
     
-    for (i = 0; i < p->modele.barres.size (); i++)
+    for (k = 0; k < 6; k++)
     {
-      BUG (common_fonction_ajout_fonction (action->efforts[0][i],
-                                           element->action->efforts[0][i],
-                                           mult),
-           NULL,
-           FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->efforts[1][i],
-                                           element->action->efforts[1][i],
-                                           mult),
-           NULL,
-           FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->efforts[2][i],
-                                           element->action->efforts[2][i],
-                                           mult),
-           NULL,
-           FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->efforts[3][i],
-                                           element->action->efforts[3][i],
-                                           mult),
-           NULL,
-           FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->efforts[4][i],
-                                           element->action->efforts[4][i],
-                                           mult),
-           NULL,
-           FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->efforts[5][i],
-                                           element->action->efforts[5][i],
-                                           mult),
-           NULL,
-           FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->deformation[0][i],
-                                           element->action->deformation[0][i],
-                                           mult),
-           NULL,
-           FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->deformation[1][i],
-                                           element->action->deformation[1][i],
-                                           mult),
-           NULL,
-           FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->deformation[2][i],
-                                           element->action->deformation[2][i],
-                                           mult),
-           NULL,
-           FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->rotation[0][i],
-                                           element->action->rotation[0][i],
-                                           mult),
+      for (i = 0; i < resultat->actions.size (); i++)
+      {
+        fonctions[i] = resultat->actions[i]->efforts[k][j];
+      }
+      BUG (common_fonction_somme (action->efforts[k][j],
+                                  fonctions.data (),
+                                  resultat->coefs.data (),
+                                  (uint32_t) fonctions.size (),
+                                  false),
            NULL,
            FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->rotation[1][i],
-                                           element->action->rotation[1][i],
-                                           mult),
+    }
+    for (k = 0; k < 3; k++)
+    {
+      for (i = 0; i < resultat->actions.size (); i++)
+      {
+        fonctions[i] = resultat->actions[i]->deformation[k][j];
+      }
+      BUG (common_fonction_somme (action->deformation[k][j],
+                                  fonctions.data (),
+                                  resultat->coefs.data (),
+                                  (uint32_t) fonctions.size (),
+                                  false),
            NULL,
            FREE_ALL)
-      BUG (common_fonction_ajout_fonction (action->rotation[2][i],
-                                           element->action->rotation[2][i],
-                                           mult),
+      for (i = 0; i < resultat->actions.size (); i++)
+      {
+        fonctions[i] = resultat->actions[i]->rotation[k][j];
+      }
+      BUG (common_fonction_somme (action->rotation[k][j],
+                                  fonctions.data (),
+                                  resultat->coefs.data (),
+                                  (uint32_t) fonctions.size (),
+                                  false),
            NULL,
            FREE_ALL)
     }
-    
-    ++it;
   }
   
 #undef FREE_ALL
@@ -1143,6 +1424,299 @@ _1990_action_ponderation_resultat (std::list <Ponderation *> *ponderation,
   return action;
 }
 
+/**
+ * \brief Crée une fausse action sur la base d'une combinaison. L'objectif est
+ *        uniquement de regrouper les résultats pondérés de chaque action.
+ *        Pour n'accéder qu'à quelques valeurs, il est préférable d'utiliser
+ *        #_1990_action_ponderation_coefs et les fonctions d'évaluation à la
+ *        demande.
+ * \param ponderation : pondération selon laquelle sera créée l'action,
+ * \param p : la variable projet.
+ * \return
+ *   Succès : pointeur vers l'action équivalente créée.\n
+ *   Échec : NULL :
+ *     - p == NULL,
+ *     - #_1990_action_ponderation_coefs,
+ *     - #_1990_action_ponderation_materialise.
+ */
+Action *
+_1990_action_ponderation_resultat (std::list <Ponderation *> *ponderation,
+                                   Projet                    *p)
+{
+  Ponderation_Resultat resultat;
+  Action              *action;
+  
+  BUGPARAM (p, "%p", p, NULL)
+  
+  BUG (_1990_action_ponderation_coefs (ponderation, &resultat), NULL)
+  BUG (action = _1990_action_ponderation_materialise (&resultat, p), NULL)
+  
+  return action;
+}
+
+/**
+ * \brief Calcule C = A × B, toutes les matrices étant stockées par colonne.
+ *        L'appel est transmis à la fonction dgemm de BLAS si elle est
+ *        disponible. Sinon, le produit est calculé par blocs pour rester dans
+ *        le cache.
+ * \param m : le nombre de lignes de A et de C,
+ * \param n : le nombre de colonnes de B et de C,
+ * \param k : le nombre de colonnes de A et de lignes de B,
+ * \param a : la matrice A,
+ * \param b : la matrice B,
+ * \param c : la matrice C, de m lignes.
+ * \return Rien.
+ */
+static void
+_1990_action_produit_matrices (uint32_t      m,
+                               uint32_t      n,
+                               uint32_t      k,
+                               const double *a,
+                               const double *b,
+                               double       *c)
+{
+#ifdef HAVE_BLAS
+  int    m_ = (int) m, n_ = (int) n, k_ = (int) k;
+  double alpha = 1., beta = 0.;
+  
+  dgemm_ ("N", "N", &m_, &n_, &k_, &alpha, a, &m_, b, &k_, &beta, c, &m_);
+#else
+  uint32_t i0, j0, l0;
+  
+  std::fill (c, c + (size_t) m * n, 0.);
+  
+  for (j0 = 0; j0 < n; j0 += TAILLE_BLOC)
+  {
+    uint32_t j1 = std::min (n, j0 + TAILLE_BLOC);
+    
+    for (l0 = 0; l0 < k; l0 += TAILLE_BLOC)
+    {
+      uint32_t l1 = std::min (k, l0 + TAILLE_BLOC);
+      
+      for (i0 = 0; i0 < m; i0 += TAILLE_BLOC)
+      {
+        uint32_t i1 = std::min (m, i0 + TAILLE_BLOC);
+        uint32_t i, j, l;
+        
+        for (j = j0; j < j1; j++)
+        {
+          for (l = l0; l < l1; l++)
+          {
+            double        coef = b[(size_t) j * k + l];
+            const double *a_l = &a[(size_t) l * m];
+            double       *c_j = &c[(size_t) j * m];
+            
+            for (i = i0; i < i1; i++)
+            {
+              c_j[i] += coef * a_l[i];
+            }
+          }
+        }
+      }
+    }
+  }
+#endif
+  
+  return;
+}
+
+/**
+ * \brief Calcule les résultats aux noeuds (déplacements et réactions
+ *        d'appui) de toutes les pondérations d'une liste par un unique
+ *        produit de matrices. Les résultats des actions sont rangés dans une
+ *        matrice dense A de 12 × nombre de noeuds lignes et d'une colonne par
+ *        action : les 6 × nombre de noeuds premières lignes contiennent les
+ *        déplacements, les suivantes les réactions d'appui, dans l'ordre de
+ *        #EF_resultat_noeud_deplacement. Les coefficients sont rangés dans une
+ *        matrice W d'une ligne par action et d'une colonne par pondération.
+ *        Les résultats valent A × W.
+ * \param ponderations : la liste des pondérations,
+ * \param p : la variable projet,
+ * \param resultats : les résultats de chaque pondération, une colonne de
+ *                    12 × nombre de noeuds lignes par pondération. Peut être
+ *                    NULL. Dans ce cas, le produit est réalisé par paquets de
+ *                    pondérations pour limiter la mémoire,
+ * \param mini : la valeur minimale de chaque ligne sur l'ensemble des
+ *               pondérations, peut être NULL,
+ * \param maxi : la valeur maximale de chaque ligne sur l'ensemble des
+ *               pondérations, peut être NULL.
+ *        S'il n'y a aucune action ou aucune pondération, les résultats, mini
+ *        et maxi sont nuls.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - ponderations == NULL,
+ *     - p == NULL,
+ *     - aucun noeud n'existe,
+ *     - une action n'a pas été calculée,
+ *     - une pondération contient une action absente du projet,
+ *     - #_1990_action_ponderation_coefs.
+ */
+bool
+_1990_action_ponderations_noeuds (
+  std::list <std::list <Ponderation *> *> *ponderations,
+  Projet                                  *p,
+  std::vector <double>                    *resultats,
+  std::vector <double>                    *mini,
+  std::vector <double>                    *maxi)
+{
+  std::list <std::list <Ponderation *> *>::iterator it_p;
+  std::list <Action *>::iterator                    it_a;
+  
+  std::vector <Action *> actions;
+  std::vector <double>   a, w, tampon;
+  uint32_t               m, k, n, j, j0, nb_bloc;
+  size_t                 i;
+  
+  BUGPARAM (ponderations, "%p", ponderations, false)
+  BUGPARAM (p, "%p", p, false)
+  INFO (!p->modele.noeuds.empty (),
+        false,
+        (gettext ("Aucun noeud n'est existant.\n")); )
+  
+  m = (uint32_t) (p->modele.noeuds.size () * 12);
+  k = (uint32_t) p->actions.size ();
+  n = (uint32_t) ponderations->size ();
+  
+  // Sans action ou sans pondération, toutes les combinaisons sont nulles.
+  if ((k == 0) || (n == 0))
+  {
+    if (resultats != NULL)
+    {
+      resultats->assign ((size_t) m * n, 0.);
+    }
+    if (mini != NULL)
+    {
+      mini->assign (m, 0.);
+    }
+    if (maxi != NULL)
+    {
+      maxi->assign (m, 0.);
+    }
+    
+    return true;
+  }
+  
+  // Matrice A : une colonne de résultats par action.
+  a.resize ((size_t) m * k);
+  it_a = p->actions.begin ();
+  while (it_a != p->actions.end ())
+  {
+    Action *action = *it_a;
+    double *col = a.data () + (size_t) actions.size () * m;
+    
+    INFO ((action->deplacement != NULL) && (action->efforts_noeuds != NULL),
+          false,
+          (gettext ("L'action %s n'a pas été calculée.\n"),
+                    action->nom.c_str ()); )
+    
+    std::copy ((double *) action->deplacement->x,
+               (double *) action->deplacement->x + m / 2,
+               col);
+    std::copy ((double *) action->efforts_noeuds->x,
+               (double *) action->efforts_noeuds->x + m / 2,
+               col + m / 2);
+    actions.push_back (action);
+    
+    ++it_a;
+  }
+  
+  // Matrice W : une colonne de coefficients par pondération.
+  w.assign ((size_t) k * n, 0.);
+  j = 0;
+  it_p = ponderations->begin ();
+  while (it_p != ponderations->end ())
+  {
+    Ponderation_Resultat resultat;
+    
+    BUG (_1990_action_ponderation_coefs (*it_p, &resultat), false)
+    for (i = 0; i < resultat.actions.size (); i++)
+    {
+      size_t l = (size_t) (std::find (actions.begin (),
+                                      actions.end (),
+                                      resultat.actions[i]) - actions.begin ());
+      
+      BUGCRIT (l < actions.size (),
+               false,
+               (gettext ("L'action %s n'est pas dans le projet.\n"),
+                         resultat.actions[i]->nom.c_str ()); )
+      w[(size_t) j * k + l] = resultat.coefs[i];
+    }
+    
+    j++;
+    ++it_p;
+  }
+  
+  if (mini != NULL)
+  {
+    mini->assign (m, INFINITY);
+  }
+  if (maxi != NULL)
+  {
+    maxi->assign (m, -INFINITY);
+  }
+  
+  // Si les résultats ne sont pas conservés, le produit est fait par paquets
+  // de TAILLE_BLOC pondérations.
+  if (resultats != NULL)
+  {
+    resultats->resize ((size_t) m * n);
+    nb_bloc = std::max (n, 1U);
+  }
+  else
+  {
+    tampon.resize ((size_t) m * TAILLE_BLOC);
+    nb_bloc = TAILLE_BLOC;
+  }
+  
+  for (j0 = 0; j0 < n; j0 += nb_bloc)
+  {
+    uint32_t nb = std::min (nb_bloc, n - j0);
+    double  *c;
+    
+    if (resultats != NULL)
+    {
+      c = resultats->data () + (size_t) j0 * m;
+    }
+    else
+    {
+      c = tampon.data ();
+    }
+    
+    _1990_action_produit_matrices (m,
+                                   nb,
+                                   k,
+                                   a.data (),
+                                   w.data () + (size_t) j0 * k,
+                                   c);
+    
+    // Pour chaque pondération du paquet
+    //   Mise à jour des enveloppes.
+    // FinPour
+    for (j = 0; j < nb; j++)
+    {
+      double *col = &c[(size_t) j * m];
+      
+      if (mini != NULL)
+      {
+        for (i = 0; i < m; i++)
+        {
+          (*mini)[i] = std::min ((*mini)[i], col[i]);
+        }
+      }
+      if (maxi != NULL)
+      {
+        for (i = 0; i < m; i++)
+        {
+          (*maxi)[i] = std::max ((*maxi)[i], col[i]);
+        }
+      }
+    }
+  }
+  
+  return true;
+}
+
 /**
  * \brief Libère les résultats de l'action souhaitée.
  * \param p : la variable projet,
@@ -127,6 +127,53 @@ Action  *_1990_action_ponderation_resultat (
                                        __attribute__((__warn_unused_result__));
 bool _1990_action_ponderation_resultat_free_calculs (Action *action);
 
+bool     _1990_action_ponderation_coefs          (
+           std::list <Ponderation *> *ponderation,
+           Ponderation_Resultat      *resultat)
+                                       __attribute__((__warn_unused_result__));
+double   _1990_action_ponderation_efforts_y      (
+           Ponderation_Resultat *resultat,
+           uint8_t               effort,
+           uint32_t              barre,
+           double                x,
+           int8_t                position)
+                                       __attribute__((__warn_unused_result__));
+double   _1990_action_ponderation_rotation_y     (
+           Ponderation_Resultat *resultat,
+           uint8_t               effort,
+           uint32_t              barre,
+           double                x,
+           int8_t                position)
+                                       __attribute__((__warn_unused_result__));
+double   _1990_action_ponderation_deformation_y  (
+           Ponderation_Resultat *resultat,
+           uint8_t               effort,
+           uint32_t              barre,
+           double                x,
+           int8_t                position)
+                                       __attribute__((__warn_unused_result__));
+double   _1990_action_ponderation_deplacement    (
+           Ponderation_Resultat *resultat,
+           EF_Noeud             *noeud,
+           uint8_t               indice)
+                                       __attribute__((__warn_unused_result__));
+double   _1990_action_ponderation_reaction_appui (
+           Ponderation_Resultat *resultat,
+           EF_Noeud             *noeud,
+           uint8_t               indice)
+                                       __attribute__((__warn_unused_result__));
+Action  *_1990_action_ponderation_materialise    (
+           Ponderation_Resultat *resultat,
+           Projet               *p)
+                                       __attribute__((__warn_unused_result__));
+bool     _1990_action_ponderations_noeuds        (
+           std::list <std::list <Ponderation *> *> *ponderations,
+           Projet                                  *p,
+           std::vector <double>                    *resultats,
+           std::vector <double>                    *mini,
+           std::vector <double>                    *maxi)
+                                       __attribute__((__warn_unused_result__));
+
 bool _1990_action_free_calculs (Projet *p,
                                 Action *action)
                                        __attribute__((__warn_unused_result__));
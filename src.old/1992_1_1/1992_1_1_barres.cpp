@@ -41,6 +41,7 @@
 #include "EF_charge_barre_ponctuelle.hpp"
 #include "EF_calculs.hpp"
 #include "EF_noeuds.hpp"
+#include "EF_rigidite.hpp"
 #include "EF_sections.hpp"
 #include "EF_charge_barre_ponctuelle.hpp"
 #include "EF_charge_barre_repartie_uniforme.hpp"
@@ -109,15 +110,6 @@ _1992_1_1_barres_free_foreach (EF_Barre *barre,
     ++it;
   }
   
-  if (barre->m_rot != NULL)
-  {
-    cholmod_free_sparse (&barre->m_rot, p->calculs.c);
-  }
-  if (barre->m_rot_t != NULL)
-  {
-    cholmod_free_sparse (&barre->m_rot_t, p->calculs.c);
-  }
-  
 #ifdef ENABLE_GTK
   if (UI_BAR.builder != NULL)
   {
@@ -196,8 +188,7 @@ _1992_1_1_barres_ajout (Projet         *p,
   element_nouveau->info_EF = std::vector <Barre_Info_EF> (1);
   memset (&element_nouveau->info_EF[0], 0, sizeof (Barre_Info_EF));
   
-  element_nouveau->m_rot = NULL;
-  element_nouveau->m_rot_t = NULL;
+  memset (element_nouveau->rot, 0, sizeof (element_nouveau->rot));
   
   if (p->modele.barres.empty ())
   {
@@ -272,6 +263,7 @@ _1992_1_1_barres_ajout (Projet         *p,
     }
   }
   
+  element_nouveau->indice = p->modele.barres.size ();
   p->modele.barres.push_back (element_nouveau);
   
   return true;
@@ -968,7 +960,8 @@ _1992_1_1_barres_change_type (EF_Barre    *barre,
  *   Échec : false :
  *     - barre == NULL,
  *     - p == NULL,
- *     - section == NULL.
+ *     - section == NULL,
+ *     - #EF_calculs_modifie_barre.
  */
 bool
 _1992_1_1_barres_change_section (EF_Barre   *barre,
@@ -986,7 +979,7 @@ _1992_1_1_barres_change_section (EF_Barre   *barre,
   
   barre->section = section;
   
-  BUG (EF_calculs_free (p), false)
+  BUG (EF_calculs_modifie_barre (p, barre), false)
   
 #ifdef ENABLE_GTK
   BUG (m3d_barre (&UI_M3D, barre), false)
@@ -1012,7 +1005,7 @@ _1992_1_1_barres_change_section (EF_Barre   *barre,
  *   Échec : false :
  *     - barre == NULL,
  *     - p == NULL,
- *     - #EF_calculs_free;
+ *     - #EF_calculs_modifie_barre.
  */
 bool
 _1992_1_1_barres_change_materiau (EF_Barre    *barre,
@@ -1029,7 +1022,7 @@ _1992_1_1_barres_change_materiau (EF_Barre    *barre,
   
   barre->materiau = materiau;
   
-  BUG (EF_calculs_free (p), false)
+  BUG (EF_calculs_modifie_barre (p, barre), false)
   
 #ifdef ENABLE_GTK
   if (UI_BAR.builder != NULL)
@@ -1228,41 +1221,29 @@ _1992_1_1_barres_change_relachement (EF_Barre       *barre,
 }
 
 /**
- * \brief Ajouter un élément à la matrice de rigidité partielle et complète.
- * \param p : la variable projet,
- * \param element : la barre à ajouter.
+ * \brief Calcule les matrices de rigidité élémentaires, dans le repère global,
+ *        de chaque tronçon d'une barre. Seul element est modifié (matrices de
+ *        rotation et informations de calcul des tronçons) : plusieurs barres
+ *        peuvent donc être traitées simultanément par des fils d'exécution
+ *        différents.
+ * \param element : la barre à calculer,
+ * \param k_glob : tableau de 144 × nombre de tronçons valeurs qui recevra la
+ *                 matrice 12×12 de chaque tronçon, stockée colonne par
+ *                 colonne.
  * \return
  *   Succès : true.\n
  *   Échec : false :
- *     - p == NULL,
- *     - p->calculs.t_part == NULL,
- *     - element == NULL,
- *     - p->calculs.t_comp == NULL,
  *     - element->section == NULL,
  *     - distance entre le début et l'extrémité de la barre est nulle),
- *     - en cas d'erreur d'allocation mémoire,
  *     - en cas d'erreur due à une fonction interne.
  */
-bool
-_1992_1_1_barres_rigidite_ajout (Projet   *p,
-                                 EF_Barre *element)
+static bool
+_1992_1_1_barres_rigidite_calcule (EF_Barre *element,
+                                   double   *k_glob)
 {
-  EF_Noeud        *noeud1, *noeud2;
-  uint32_t        *ai, *aj;
-  double          *ax;
-  double           x, y, z;
-  uint8_t          k;
-  cholmod_triplet *triplet;
-  uint16_t         j;
-  
-  BUGPARAM (p, "%p", p, false)
-  INFO (p->calculs.t_part,
-        false,
-        (gettext ("Il est nécessaire de lancer la fonction EF_calculs_initialise avant.\n")); )
-  BUGPARAM (element, "%p", element, false)
-  INFO (p->calculs.t_comp,
-        false,
-        (gettext ("Il est nécessaire de lancer la fonction EF_calculs_initialise avant.\n")); )
+  EF_Noeud *noeud1, *noeud2;
+  double    x, y, z;
+  uint16_t  j;
   
   // Calcul de la matrice de rotation 3D qui permet de passer du repère local
   // au repère global. Elle est déterminée par le calcul de deux angles :
@@ -1348,48 +1329,15 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
                                         &y,
                                         &z),
        false)
-  triplet = cholmod_allocate_triplet (12,
-                                      12,
-                                      36,
-                                      0,
-                                      CHOLMOD_REAL,
-                                      p->calculs.c);
-  BUGCRIT (triplet, false, (gettext ("Erreur d'allocation mémoire.\n")); )
-  ai = (uint32_t *) triplet->i;
-  aj = (uint32_t *) triplet->j;
-  ax = (double *) triplet->x;
-  for (k = 0; k < 4; k++)
-  {
-    ai[k * 9 + 0] = k * 3U + 0U; aj[k * 9 + 0] = k * 3U + 0U;
-    ax[k * 9 + 0] = cos (y) * cos (z);
-    ai[k * 9 + 1] = k * 3U + 0U; aj[k * 9 + 1] = k * 3U + 1U;
-    ax[k * 9 + 1] = -sin (z);
-    ai[k * 9 + 2] = k * 3U + 0U; aj[k * 9 + 2] = k * 3U + 2U;
-    ax[k * 9 + 2] = -sin (y) * cos (z);
-    ai[k * 9 + 3] = k * 3U + 1U; aj[k * 9 + 3] = k * 3U + 0U;
-    ax[k * 9 + 3] = cos (x) * cos (y) * sin (z) - sin (x) * sin (y);
-    ai[k * 9 + 4] = k * 3U + 1U; aj[k * 9 + 4] = k * 3U + 1U;
-    ax[k * 9 + 4] = cos (x) * cos(z);
-    ai[k * 9 + 5] = k * 3U + 1U; aj[k * 9 + 5] = k * 3U + 2U;
-    ax[k * 9 + 5] = -cos (x) * sin (y) * sin (z) - sin (x) * cos (y);
-    ai[k * 9 + 6] = k * 3U + 2U; aj[k * 9 + 6] = k * 3U + 0U;
-    ax[k * 9 + 6] = sin (x) * cos (y) * sin (z) + cos (x) * sin (y);
-    ai[k * 9 + 7] = k * 3U + 2U; aj[k * 9 + 7] = k * 3U + 1U;
-    ax[k * 9 + 7] = sin (x) * cos (z);
-    ai[k * 9 + 8] = k * 3U + 2U; aj[k * 9 + 8] = k * 3U + 2U;
-    ax[k * 9 + 8] = cos (x) * cos (y) - sin (x) * sin (y) * sin (z);
-  }
-  triplet->nnz = 36;
-  element->m_rot = cholmod_triplet_to_sparse(triplet, 0, p->calculs.c);
-  BUGCRIT (element->m_rot,
-           false,
-           (gettext ("Erreur d'allocation mémoire.\n"));
-             cholmod_free_triplet (&triplet, p->calculs.c); )
-  cholmod_free_triplet (&triplet, p->calculs.c);
-  element->m_rot_t = cholmod_transpose ( element->m_rot, 1, p->calculs.c);
-  BUGCRIT (element->m_rot_t,
-           false,
-           (gettext ("Erreur d'allocation mémoire.\n")); )
+  element->rot[0] = cos (y) * cos (z);
+  element->rot[1] = -sin (z);
+  element->rot[2] = -sin (y) * cos (z);
+  element->rot[3] = cos (x) * cos (y) * sin (z) - sin (x) * sin (y);
+  element->rot[4] = cos (x) * cos(z);
+  element->rot[5] = -cos (x) * sin (y) * sin (z) - sin (x) * cos (y);
+  element->rot[6] = sin (x) * cos (y) * sin (z) + cos (x) * sin (y);
+  element->rot[7] = sin (x) * cos (z);
+  element->rot[8] = cos (x) * cos (y) - sin (x) * sin (y) * sin (z);
   
   // Une fois la matrice de rotation déterminée, il est nécessaire de calculer
   // la matrice de rigidité élémentaire dans le repère local. La poutre pouvant
@@ -1397,17 +1345,10 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
   // chaque tronçon.
   for (j = 0; j < element->nds_inter.size () + 1; j++)
   {
-    double          MA, MB;
-    double          phia_iso, phib_iso;
-    double          es_l;
-    uint32_t        num1, num2;
-    cholmod_sparse *sparse_tmp, *matrice_rigidite_globale;
-    double          ll;
-    uint32_t        i;
-    uint32_t       *ai2, *aj2;
-    double         *ax2;
-    uint32_t       *ai3, *aj3;
-    double         *ax3;
+    double MA, MB;
+    double phia_iso, phib_iso;
+    double es_l;
+    double ll;
     
     // Détermination du noeud de départ et de fin
     if (j == 0)
@@ -1442,15 +1383,6 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
       noeud2 = *it;
     }
     
-    num1 = (uint32_t) std::distance (p->modele.noeuds.begin (),
-                                     std::find (p->modele.noeuds.begin (),
-                                                p->modele.noeuds.end (),
-                                                noeud1));
-    num2 = (uint32_t) std::distance (p->modele.noeuds.begin (),
-                                     std::find (p->modele.noeuds.begin (),
-                                                p->modele.noeuds.end (),
-                                                noeud2));
-    
     // Calcul des L_x, L_y, L_z et L.
     ll = EF_noeuds_distance (noeud2, noeud1);
     BUG (!std::isnan(ll), false)
@@ -1726,18 +1658,8 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
     }
     
     // Calcul des valeurs de la matrice de rigidité locale :
-    triplet = cholmod_allocate_triplet (12,
-                                        12,
-                                        40,
-                                        0,
-                                        CHOLMOD_REAL,
-                                        p->calculs.c);
-    BUGCRIT (triplet, false, (gettext ("Erreur d'allocation mémoire.\n")); )
-    ai = (uint32_t *) triplet->i;
-    aj = (uint32_t *) triplet->j;
-    ax = (double *) triplet->x;
-    triplet->nnz = 40;
-    i = 0;
+    memset (element->info_EF[j].k_loc, 0, sizeof (element->info_EF[j].k_loc));
+#define K_LOC(I, J) element->info_EF[j].k_loc[(J) * 12 + (I)]
     
     // Pour un élément travaillant en compression simple (aucune variante
     // possible dues aux relachements). Les valeurs de ES/L sont obtenues par
@@ -1747,12 +1669,11 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
     // \end{bmatrix}\end{displaymath}\begin{verbatim}
     es_l = EF_sections_es_l (element, j, 0., ll);
     BUG (!std::isnan (es_l),
-         false,
-         cholmod_free_triplet (&triplet, p->calculs.c); )
-    ai[i] = 0;  aj[i] = 0;  ax[i] =  es_l; i++;
-    ai[i] = 0;  aj[i] = 6;  ax[i] = -es_l; i++;
-    ai[i] = 6;  aj[i] = 0;  ax[i] = -es_l; i++;
-    ai[i] = 6;  aj[i] = 6;  ax[i] =  es_l; i++;
+         false)
+    K_LOC (0, 0)   =  es_l;
+    K_LOC (0, 6)   = -es_l;
+    K_LOC (6, 0)   = -es_l;
+    K_LOC (6, 6)   =  es_l;
     
     // Détermination de la matrice de rigidité après prise en compte des
     // relachements autour de l'axe z :
@@ -1787,12 +1708,11 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
                                     1. / ll,
                                     &MA,
                                     &MB),
-         false,
-         cholmod_free_triplet (&triplet, p->calculs.c); )
-    ai[i] = 1;  aj[i] = 1;  ax[i] =  MA / ll + MB / ll; i++;
-    ai[i] = 5;  aj[i] = 1;  ax[i] =  MA;                i++;
-    ai[i] = 7;  aj[i] = 1;  ax[i] = -MA / ll - MB / ll; i++;
-    ai[i] = 11; aj[i] = 1;  ax[i] =  MB;                i++;
+         false)
+    K_LOC (1, 1)   =  MA / ll + MB / ll;
+    K_LOC (5, 1)   =  MA;
+    K_LOC (7, 1)   = -MA / ll - MB / ll;
+    K_LOC (11, 1)  =  MB;
     
     // Etude du cas 2, rotation imposée r. phiA (positif) et phiB (négatif)
     // sont déterminés par la fonction EF_charge_barre_ponctuelle_def_ang_iso_z
@@ -1810,8 +1730,7 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
                                                    1.,
                                                    &phia_iso,
                                                    &phib_iso),
-         false,
-         cholmod_free_triplet (&triplet, p->calculs.c); )
+         false)
     if (errrel (element->info_EF[j].kAz, MAXDOUBLE))
     {
       MA = 0.;
@@ -1827,10 +1746,10 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
            element->info_EF[j].kBz))));
     }
     MB = MA * phib_iso / (element->info_EF[j].cz + element->info_EF[j].kBz);
-    ai[i] = 1;  aj[i] = 5;  ax[i] =  MA / ll - MB / ll; i++;
-    ai[i] = 5;  aj[i] = 5;  ax[i] =  MA;                i++;
-    ai[i] = 7;  aj[i] = 5;  ax[i] = -MA / ll + MB / ll; i++;
-    ai[i] = 11; aj[i] = 5;  ax[i] = -MB;                i++;
+    K_LOC (1, 5)   =  MA / ll - MB / ll;
+    K_LOC (5, 5)   =  MA;
+    K_LOC (7, 5)   = -MA / ll + MB / ll;
+    K_LOC (11, 5)  = -MB;
     
     // Etude du cas 3 : Les moments MA et MB sont obtenues par la fonction
     // EF_calculs_moment_hyper_z en supposant arctan(-1/l) = -1/l (hypothèse
@@ -1843,12 +1762,11 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
                                     -1. / ll,
                                     &MA,
                                     &MB),
-         false,
-         cholmod_free_triplet (&triplet, p->calculs.c); )
-    ai[i] = 1;  aj[i] = 7;  ax[i] =  MA / ll + MB / ll; i++;
-    ai[i] = 5;  aj[i] = 7;  ax[i] =  MA;                i++;
-    ai[i] = 7;  aj[i] = 7;  ax[i] = -MA / ll - MB / ll; i++;
-    ai[i] = 11; aj[i] = 7;  ax[i] =  MB;                i++;
+         false)
+    K_LOC (1, 7)   =  MA / ll + MB / ll;
+    K_LOC (5, 7)   =  MA;
+    K_LOC (7, 7)   = -MA / ll - MB / ll;
+    K_LOC (11, 7)  =  MB;
     
     // Etude du cas 4, rotation imposée r. phiA (négatif) et phiB (positif)
     // sont déterminés par la fonction EF_charge_barre_ponctuelle_def_ang_iso_z
@@ -1869,8 +1787,7 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
                                                    1.,
                                                    &phia_iso,
                                                    &phib_iso),
-         false,
-         cholmod_free_triplet (&triplet, p->calculs.c); )
+         false)
     if (errrel (element->info_EF[j].kBz, MAXDOUBLE))
     {
       MB = 0.;
@@ -1887,10 +1804,10 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
     }
     MA = MB * phia_iso / (element->info_EF[j].cz + element->info_EF[j].kAz);
     
-    ai[i] = 1;  aj[i] = 11; ax[i] = -MA / ll + MB / ll; i++;
-    ai[i] = 5;  aj[i] = 11; ax[i] = -MA;                i++;
-    ai[i] = 7;  aj[i] = 11; ax[i] =  MA / ll - MB / ll; i++;
-    ai[i] = 11; aj[i] = 11; ax[i] =  MB;                i++;
+    K_LOC (1, 11)  = -MA / ll + MB / ll;
+    K_LOC (5, 11)  = -MA;
+    K_LOC (7, 11)  =  MA / ll - MB / ll;
+    K_LOC (11, 11) =  MB;
     // \begin{bmatrix}K_e\end{bmatrix} = 
     // \begin{bmatrix}  a & e & i & m\\
     //                  b & f & j & n\\
@@ -1913,12 +1830,11 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
                                     1. / ll,
                                     &MA,
                                     &MB),
-         false,
-         cholmod_free_triplet (&triplet, p->calculs.c); )
-    ai[i] = 2;  aj[i] = 2;  ax[i] =  MA / ll + MB / ll; i++;
-    ai[i] = 4;  aj[i] = 2;  ax[i] = -MA;                i++;
-    ai[i] = 8;  aj[i] = 2;  ax[i] = -MA / ll - MB / ll; i++;
-    ai[i] = 10; aj[i] = 2;  ax[i] = -MB;                i++;
+         false)
+    K_LOC (2, 2)   =  MA / ll + MB / ll;
+    K_LOC (4, 2)   = -MA;
+    K_LOC (8, 2)   = -MA / ll - MB / ll;
+    K_LOC (10, 2)  = -MB;
     
     // Etude du cas 2, rotation imposée r. phiA (positif) et phiB (négatif)
     // sont déterminés par la fonction EF_charge_barre_ponctuelle_def_ang_iso_y
@@ -1936,8 +1852,7 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
                                                    1.,
                                                    &phia_iso,
                                                    &phib_iso),
-         false,
-         cholmod_free_triplet (&triplet, p->calculs.c); )
+         false)
     if (errrel (element->info_EF[j].kAy, MAXDOUBLE))
     {
       MA = 0.;
@@ -1954,10 +1869,10 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
                              element->info_EF[j].kBy))));
     }
     MB = MA * phib_iso / (element->info_EF[j].cy + element->info_EF[j].kBy);
-    ai[i] = 2;  aj[i] = 4;  ax[i] =  MA / ll - MB / ll; i++;
-    ai[i] = 4;  aj[i] = 4;  ax[i] = -MA;                i++;
-    ai[i] = 8;  aj[i] = 4;  ax[i] = -MA / ll + MB / ll; i++;
-    ai[i] = 10; aj[i] = 4;  ax[i] =  MB;                i++;
+    K_LOC (2, 4)   =  MA / ll - MB / ll;
+    K_LOC (4, 4)   = -MA;
+    K_LOC (8, 4)   = -MA / ll + MB / ll;
+    K_LOC (10, 4)  =  MB;
     
     // Etude du cas 3 : Les moments MA et MB sont obtenues par la fonction
     // EF_calculs_moment_hyper_y en supposant arctan(-1/l) = -1/l (hypothèse
@@ -1970,12 +1885,11 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
                                     -1. / ll,
                                     &MA,
                                     &MB),
-         false,
-         cholmod_free_triplet (&triplet, p->calculs.c); )
-    ai[i] = 2;  aj[i] = 8;  ax[i] =  MA / ll + MB / ll; i++;
-    ai[i] = 4;  aj[i] = 8;  ax[i] = -MA;                i++;
-    ai[i] = 8;  aj[i] = 8;  ax[i] = -MA / ll - MB / ll; i++;
-    ai[i] = 10; aj[i] = 8;  ax[i] = -MB;                i++;
+         false)
+    K_LOC (2, 8)   =  MA / ll + MB / ll;
+    K_LOC (4, 8)   = -MA;
+    K_LOC (8, 8)   = -MA / ll - MB / ll;
+    K_LOC (10, 8)  = -MB;
     
     // Etude du cas 4, rotation imposée r. phiA (négatif) et phiB (positif)
     // sont déterminés par la fonction EF_charge_barre_ponctuelle_def_ang_iso_y
@@ -1993,8 +1907,7 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
                                                    1.,
                                                    &phia_iso,
                                                    &phib_iso),
-         false,
-         cholmod_free_triplet (&triplet, p->calculs.c); )
+         false)
     if (errrel (element->info_EF[j].kBy, MAXDOUBLE))
     {
       MB = 0.;
@@ -2010,10 +1923,10 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
            element->info_EF[j].kAy))));
     }
     MA = MB * phia_iso / (element->info_EF[j].cy + element->info_EF[j].kAy);
-    ai[i] = 2;  aj[i] = 10; ax[i] = -MA / ll + MB / ll; i++;
-    ai[i] = 4;  aj[i] = 10; ax[i] =  MA;                i++;
-    ai[i] = 8;  aj[i] = 10; ax[i] =  MA / ll - MB / ll; i++;
-    ai[i] = 10; aj[i] = 10; ax[i] = -MB;                i++;
+    K_LOC (2, 10)  = -MA / ll + MB / ll;
+    K_LOC (4, 10)  =  MA;
+    K_LOC (8, 10)  =  MA / ll - MB / ll;
+    K_LOC (10, 10) = -MB;
     
     // Pour un élément travaillant en torsion simple dont l'une des extrémités
     // est relaxée :\end{verbatim}\begin{displaymath}
@@ -2026,10 +1939,10 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
          (element->relachement != NULL) &&
          (element->relachement->rx_fin == EF_RELACHEMENT_LIBRE)))
     {
-      ai[i] = 3;  aj[i] = 3;  ax[i] = 0; i++;
-      ai[i] = 3;  aj[i] = 9;  ax[i] = 0; i++;
-      ai[i] = 9;  aj[i] = 3;  ax[i] = 0; i++;
-      ai[i] = 9;  aj[i] = 9;  ax[i] = 0; i++;
+      K_LOC (3, 3)   = 0;
+      K_LOC (3, 9)   = 0;
+      K_LOC (9, 3)   = 0;
+      K_LOC (9, 9)   = 0;
     }
     // Pour un élément travaillant en torsion simple dont aucune des extrémités
     // n'est relaxée :\end{verbatim}\begin{displaymath}
@@ -2040,168 +1953,334 @@ _1992_1_1_barres_rigidite_ajout (Projet   *p,
     {
       double gj_l = EF_sections_gj_l (element, j);
       
-      ai[i] = 3;  aj[i] = 3;  ax[i] =  gj_l; i++;
-      ai[i] = 3;  aj[i] = 9;  ax[i] = -gj_l; i++;
-      ai[i] = 9;  aj[i] = 3;  ax[i] = -gj_l; i++;
-      ai[i] = 9;  aj[i] = 9;  ax[i] =  gj_l; i++;
+      K_LOC (3, 3)   =  gj_l;
+      K_LOC (3, 9)   = -gj_l;
+      K_LOC (9, 3)   = -gj_l;
+      K_LOC (9, 9)   =  gj_l;
     }
     
-    cholmod_free_sparse (&element->info_EF[j].m_rig_loc,
-                         p->calculs.c);
-    element->info_EF[j].m_rig_loc = cholmod_triplet_to_sparse (triplet,
-                                                               0,
-                                                               p->calculs.c);
-    cholmod_free_triplet (&triplet, p->calculs.c);
-    BUGCRIT (element->info_EF[j].m_rig_loc,
-             false,
-             (gettext ("Erreur d'allocation mémoire.\n")); )
+#undef K_LOC
     
     // Calcule la matrice locale dans le repère globale :\end{verbatim}
     // \begin{displaymath}
     //     [K]_{global} = [R] \cdot [K]_{local} \cdot [R]^{-1}
     //                  = [R] \cdot [K]_{local} \cdot [R]^T\end{displaymath}
     // \begin{verbatim}
-    sparse_tmp = cholmod_ssmult (element->m_rot,
-                                 element->info_EF[j].m_rig_loc,
-                                 0,
-                                 1,
-                                 0,
-                                 p->calculs.c);
-    BUGCRIT (sparse_tmp,
-             false,
-             (gettext( "Erreur d'allocation mémoire.\n")); )
-    matrice_rigidite_globale = cholmod_ssmult (sparse_tmp,
-                                               element->m_rot_t,
-                                               0,
-                                               1,
-                                               0,
-                                               p->calculs.c);
-    cholmod_free_sparse (&(sparse_tmp), p->calculs.c);
-    BUGCRIT (matrice_rigidite_globale,
-             false,
-             (gettext ("Erreur d'allocation mémoire.\n")); )
-    triplet = cholmod_sparse_to_triplet (matrice_rigidite_globale,
-                                         p->calculs.c);
-    cholmod_free_sparse (&(matrice_rigidite_globale), p->calculs.c);
-    BUGCRIT (triplet,
-             false,
-             (gettext ("Erreur d'allocation mémoire.\n")); )
-    ai = (uint32_t *)     triplet->i;
-    aj = (uint32_t *)     triplet->j;
-    ax = (double *)  triplet->x;
-    ai2 = (uint32_t *)    p->calculs.t_part->i;
-    aj2 = (uint32_t *)    p->calculs.t_part->j;
-    ax2 = (double *) p->calculs.t_part->x;
-    ai3 = (uint32_t *)    p->calculs.t_comp->i;
-    aj3 = (uint32_t *)    p->calculs.t_comp->j;
-    ax3 = (double *) p->calculs.t_comp->x;
+    common_math_rotation_rigidite (element->rot,
+                                   element->info_EF[j].k_loc,
+                                   &k_glob[j * 144U]);
+  }
+  // FinPour
+  
+  return true;
+}
+
+/**
+ * \brief Cumule les matrices de rigidité élémentaires d'une barre dans la
+ *        matrice de rigidité partielle et dans les lignes de réaction à l'aide
+ *        des tables de dispersion déterminées par #EF_calculs_initialise. Pour une barre
+ *        condensée, seul son super-élément, calculé par
+ *        #EF_rigidite_condense, est cumulé dans la matrice partielle.
+ * \param p : la variable projet,
+ * \param element : la barre à ajouter,
+ * \param k_glob : les matrices élémentaires calculées par
+ *                 #_1992_1_1_barres_rigidite_calcule.
+ * \return Rien.
+ */
+static void
+_1992_1_1_barres_rigidite_disperse (Projet   *p,
+                                    EF_Barre *element,
+                                    double   *k_glob)
+{
+  double *x_part, *x_reac;
+  size_t  j;
+  
+  x_part = (double *) p->calculs.m_part->x;
+  x_reac = p->calculs.reac_x;
+  for (j = 0; j <= element->nds_inter.size (); j++)
+  {
+    uint32_t *disp_part, *disp_reac;
+    uint8_t   i;
     
-    // Insertion de la matrice de rigidité élémentaire dans la matrice de
-    // rigidité globale partielle et complète.
-    for (i = 0; i < triplet->nnz; i++)
+    disp_part = &p->calculs.disp_part[element->info_EF[j].troncon * 144U];
+    disp_reac = &p->calculs.disp_reac[element->info_EF[j].troncon * 144U];
+    for (i = 0; i < 144; i++)
     {
-      if ((ai[i] < 6) &&
-          (aj[i] < 6) &&
-          (p->calculs.n_part[num1][ai[i]] != UINT32_MAX) &&
-          (p->calculs.n_part[num1][aj[i]] != UINT32_MAX))
-      {
-        ai2[p->calculs.t_part_en_cours] = p->calculs.n_part[num1][ai[i]];
-        aj2[p->calculs.t_part_en_cours] = p->calculs.n_part[num1][aj[i]];
-        ax2[p->calculs.t_part_en_cours] = ax[i];
-        p->calculs.t_part_en_cours++;
-      }
-      else if ((ai[i] < 6) &&
-               (aj[i] >= 6) &&
-               (p->calculs.n_part[num1][ai[i]] != UINT32_MAX) &&
-               (p->calculs.n_part[num2][aj[i]-6] != UINT32_MAX))
+      if (disp_part[i] != UINT32_MAX)
       {
-        ai2[p->calculs.t_part_en_cours] = p->calculs.n_part[num1][ai[i]];
-        aj2[p->calculs.t_part_en_cours] = p->calculs.n_part[num2][aj[i]-6];
-        ax2[p->calculs.t_part_en_cours] = ax[i];
-        p->calculs.t_part_en_cours++;
+        x_part[disp_part[i]] += k_glob[j * 144U + i];
       }
-      else if ((ai[i] >= 6) &&
-               (aj[i] < 6) &&
-               (p->calculs.n_part[num2][ai[i]-6] != UINT32_MAX) &&
-               (p->calculs.n_part[num1][aj[i]] != UINT32_MAX))
+      if (disp_reac[i] != UINT32_MAX)
       {
-        ai2[p->calculs.t_part_en_cours] = p->calculs.n_part[num2][ai[i]-6];
-        aj2[p->calculs.t_part_en_cours] = p->calculs.n_part[num1][aj[i]];
-        ax2[p->calculs.t_part_en_cours] = ax[i];
-        p->calculs.t_part_en_cours++;
+        x_reac[disp_reac[i]] += k_glob[j * 144U + i];
       }
-      else if ((ai[i] >= 6) &&
-               (aj[i] >= 6) &&
-               (p->calculs.n_part[num2][ai[i]-6] != UINT32_MAX) &&
-               (p->calculs.n_part[num2][aj[i]-6] != UINT32_MAX))
-      {
-        ai2[p->calculs.t_part_en_cours] = p->calculs.n_part[num2][ai[i]-6];
-        aj2[p->calculs.t_part_en_cours] = p->calculs.n_part[num2][aj[i]-6];
-        ax2[p->calculs.t_part_en_cours] = ax[i];
-        p->calculs.t_part_en_cours++;
-      }
-      
-      if ((ai[i] < 6) && (aj[i] < 6))
-      {
-        ai3[p->calculs.t_comp_en_cours] = p->calculs.n_comp[num1][ai[i]];
-        aj3[p->calculs.t_comp_en_cours] = p->calculs.n_comp[num1][aj[i]];
-        ax3[p->calculs.t_comp_en_cours] = ax[i];
-        p->calculs.t_comp_en_cours++;
-      }
-      else if ((ai[i] < 6) && (aj[i] >= 6))
-      {
-        ai3[p->calculs.t_comp_en_cours] = p->calculs.n_comp[num1][ai[i]];
-        aj3[p->calculs.t_comp_en_cours] = p->calculs.n_comp[num2][aj[i]-6];
-        ax3[p->calculs.t_comp_en_cours] = ax[i];
-        p->calculs.t_comp_en_cours++;
-      }
-      else if ((ai[i] >= 6) && (aj[i] < 6))
-      {
-        ai3[p->calculs.t_comp_en_cours] = p->calculs.n_comp[num2][ai[i]-6];
-        aj3[p->calculs.t_comp_en_cours] = p->calculs.n_comp[num1][aj[i]];
-        ax3[p->calculs.t_comp_en_cours] = ax[i];
-        p->calculs.t_comp_en_cours++;
-      }
-      else if ((ai[i] >= 6) && (aj[i] >= 6))
+    }
+  }
+  
+  if ((p->calculs.cond_x != NULL) &&
+      (p->calculs.cond_pos[element->indice] != SIZE_MAX))
+  {
+    uint32_t *disp_cond = &p->calculs.disp_cond[element->indice * 144U];
+    double   *k_c = &p->calculs.cond_x[p->calculs.cond_pos[element->indice]];
+    uint8_t   i;
+    
+    for (i = 0; i < 144; i++)
+    {
+      if (disp_cond[i] != UINT32_MAX)
       {
-        ai3[p->calculs.t_comp_en_cours] = p->calculs.n_comp[num2][ai[i]-6];
-        aj3[p->calculs.t_comp_en_cours] = p->calculs.n_comp[num2][aj[i]-6];
-        ax3[p->calculs.t_comp_en_cours] = ax[i];
-        p->calculs.t_comp_en_cours++;
+        x_part[disp_cond[i]] += k_c[i];
       }
     }
-    cholmod_free_triplet (&triplet, p->calculs.c);
   }
-  // FinPour
+  
+  return;
+}
+
+/**
+ * \brief Ajouter un élément à la matrice de rigidité partielle et aux lignes
+ *        de réaction.
+ * \param p : la variable projet,
+ * \param element : la barre à ajouter.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - p->calculs.disp_part == NULL,
+ *     - element == NULL,
+ *     - p->calculs.disp_reac == NULL,
+ *     - #_1992_1_1_barres_rigidite_calcule.
+ */
+bool
+_1992_1_1_barres_rigidite_ajout (Projet   *p,
+                                 EF_Barre *element)
+{
+  double *k_glob;
+  
+  BUGPARAM (p, "%p", p, false)
+  INFO (p->calculs.disp_part,
+        false,
+        (gettext ("Il est nécessaire de lancer la fonction EF_calculs_initialise avant.\n")); )
+  BUGPARAM (element, "%p", element, false)
+  INFO (p->calculs.disp_reac,
+        false,
+        (gettext ("Il est nécessaire de lancer la fonction EF_calculs_initialise avant.\n")); )
+  
+  k_glob = new double [144U * (element->nds_inter.size () + 1U)];
+  BUG (_1992_1_1_barres_rigidite_calcule (element, k_glob),
+       false,
+       delete [] k_glob; )
+  if ((p->calculs.cond_x != NULL) &&
+      (p->calculs.cond_pos[element->indice] != SIZE_MAX))
+  {
+    BUG (EF_rigidite_condense (p, element, k_glob),
+         false,
+         delete [] k_glob; )
+  }
+  _1992_1_1_barres_rigidite_disperse (p, element, k_glob);
+  delete [] k_glob;
+  
+  return true;
+}
+
+/**
+ * \brief Recalcule les matrices de rigidité élémentaires d'une barre dont la
+ *        section ou le matériau a changé et renvoie leur variation dans le
+ *        repère global, tronçon par tronçon. Les anciennes matrices sont
+ *        déduites de la matrice de rotation et des matrices locales conservées
+ *        dans la barre depuis le dernier calcul.
+ * \param element : la barre modifiée,
+ * \param dk_glob : tableau de 144 × nombre de tronçons valeurs qui recevra
+ *                  la variation de la matrice 12×12 de chaque tronçon,
+ *                  stockée colonne par colonne.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - element == NULL,
+ *     - dk_glob == NULL,
+ *     - #_1992_1_1_barres_rigidite_calcule.
+ */
+bool
+_1992_1_1_barres_rigidite_variation (EF_Barre *element,
+                                     double   *dk_glob)
+{
+  double *k_glob;
+  size_t  j;
+  uint8_t i;
+  
+  BUGPARAM (element, "%p", element, false)
+  BUGPARAM (dk_glob, "%p", dk_glob, false)
+  
+  for (j = 0; j <= element->nds_inter.size (); j++)
+  {
+    common_math_rotation_rigidite (element->rot,
+                                   element->info_EF[j].k_loc,
+                                   &dk_glob[j * 144U]);
+  }
+  
+  k_glob = new double [144U * (element->nds_inter.size () + 1U)];
+  BUG (_1992_1_1_barres_rigidite_calcule (element, k_glob),
+       false,
+       delete [] k_glob; )
+  for (j = 0; j <= element->nds_inter.size (); j++)
+  {
+    for (i = 0; i < 144; i++)
+    {
+      dk_glob[j * 144U + i] = k_glob[j * 144U + i] - dk_glob[j * 144U + i];
+    }
+  }
+  delete [] k_glob;
+  
+  return true;
+}
+
+/**
+ * \struct Barres_Rigidite
+ * \brief Données du calcul des matrices de rigidité élémentaires transmises
+ *        à #_1992_1_1_barres_rigidite_tache.
+ */
+typedef struct
+{
+  /// La variable projet.
+  Projet                   *p;
+  /// La liste des barres.
+  std::vector <EF_Barre *> *barres;
+  /// Les plages de barres.
+  /** La plage k va de barres[debut[k]] à barres[debut[k + 1] - 1].
+   */
+  std::vector <size_t>     *debut;
+  /// Les matrices élémentaires de tous les tronçons.
+  double                   *k_glob;
+} Barres_Rigidite;
+
+
+/**
+ * \brief Tâche de #common_math_parallele calculant les matrices de rigidité
+ *        élémentaires d'une plage de barres. Les résultats de chaque barre
+ *        sont écrits dans k_glob à partir de la position 144 × numéro du
+ *        premier tronçon de la barre : les zones de chaque plage sont
+ *        disjointes et aucun verrou n'est nécessaire. Les barres condensées
+ *        sont également condensées.
+ * \param donnees : le calcul (Barres_Rigidite),
+ * \param k : le numéro de la plage.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - #_1992_1_1_barres_rigidite_calcule,
+ *     - #EF_rigidite_condense.
+ */
+static bool
+_1992_1_1_barres_rigidite_tache (void  *donnees,
+                                 size_t k)
+{
+  Barres_Rigidite *r = (Barres_Rigidite *) donnees;
+  Projet          *p = r->p;
+  size_t           i;
+  
+  for (i = (*r->debut)[k]; i < (*r->debut)[k + 1]; i++)
+  {
+    EF_Barre *element = (*r->barres)[i];
+    double   *k_glob = &r->k_glob[element->info_EF[0].troncon * 144U];
+    
+    if (!_1992_1_1_barres_rigidite_calcule (element, k_glob))
+    {
+      return false;
+    }
+    if ((p->calculs.cond_x != NULL) &&
+        (p->calculs.cond_pos[element->indice] != SIZE_MAX) &&
+        (!EF_rigidite_condense (p, element, k_glob)))
+    {
+      return false;
+    }
+  }
   
   return true;
 }
 
 /**
- * \brief Ajoute à la matrice de rigidité toutes les barres.
+ * \brief Ajoute à la matrice de rigidité toutes les barres. Le calcul des
+ *        matrices élémentaires est réparti par #common_math_parallele sur
+ *        p->calculs.nb_fils fils d'exécution. Chaque fil reçoit une plage de
+ *        barres consécutives totalisant un nombre de tronçons équivalent,
+ *        déterminée à partir du numéro du premier tronçon de chaque barre
+ *        (somme cumulée calculée par #EF_calculs_initialise). Le cumul dans
+ *        les matrices de rigidité est ensuite réalisé séquentiellement.
  * \param p : la variable projet.
  * \return
  *   Succès : true.
  *   Échec : false :
  *     - p == NULL,
- *     - #_1992_1_1_barres_rigidite_ajout.
+ *     - p->calculs.disp_part == NULL,
+ *     - p->calculs.disp_reac == NULL,
+ *     - #_1992_1_1_barres_rigidite_calcule.
  */
 bool
 _1992_1_1_barres_rigidite_ajout_tout (Projet *p)
 {
-  std::list <EF_Barre *>::iterator it;
+  std::vector <EF_Barre *> barres;
+  std::vector <size_t> debut;
+  Barres_Rigidite rigidite;
+  double  *k_glob;
+  uint32_t nb_plages;
+  uint32_t i;
+  size_t   b;
+  
+  std::vector <EF_Barre *>::iterator it;
   
   BUGPARAM (p, "%p", p, false)
+  INFO (p->calculs.disp_part,
+        false,
+        (gettext ("Il est nécessaire de lancer la fonction EF_calculs_initialise avant.\n")); )
+  INFO (p->calculs.disp_reac,
+        false,
+        (gettext ("Il est nécessaire de lancer la fonction EF_calculs_initialise avant.\n")); )
   
-  it = p->modele.barres.begin ();
-  while (it != p->modele.barres.end ())
+  if (p->modele.barres.empty ())
   {
-    EF_Barre *element = *it;
+    return true;
+  }
+  
+  barres.assign (p->modele.barres.begin (), p->modele.barres.end ());
+  nb_plages = common_math_nb_fils (p->calculs.nb_fils, barres.size ());
+  
+  // Répartition des barres : la plage i commence à la première barre dont le
+  // premier tronçon est supérieur ou égal à i × nb_troncons / nb_plages.
+  debut.resize (nb_plages + 1U);
+  b = 0;
+  for (i = 0; i < nb_plages; i++)
+  {
+    uint64_t seuil = (uint64_t) i * p->calculs.nb_troncons / nb_plages;
     
-    BUG (_1992_1_1_barres_rigidite_ajout (p, element), false)
+    while ((b < barres.size ()) && (barres[b]->info_EF[0].troncon < seuil))
+    {
+      b++;
+    }
+    debut[i] = b;
+  }
+  debut[nb_plages] = barres.size ();
+  
+  k_glob = new double [p->calculs.nb_troncons * 144U];
+  
+  rigidite.p = p;
+  rigidite.barres = &barres;
+  rigidite.debut = &debut;
+  rigidite.k_glob = k_glob;
+  BUG (common_math_parallele (_1992_1_1_barres_rigidite_tache,
+                              &rigidite,
+                              nb_plages,
+                              nb_plages),
+       false,
+       delete [] k_glob; )
+  
+  for (it = barres.begin (); it != barres.end (); ++it)
+  {
+    EF_Barre *element = *it;
     
-    ++it;
+    _1992_1_1_barres_rigidite_disperse (
+                                    p,
+                                    element,
+                                    &k_glob[element->info_EF[0].troncon * 144U]);
   }
+  delete [] k_glob;
   
   return true;
 }
@@ -2352,6 +2431,32 @@ _1992_1_1_barres_supprime_liste (Projet                 *p,
     ++it2;
   }
   
+  // On remet à jour la position des noeuds et des barres restants.
+  if ((!noeuds_suppr->empty ()) || (!barres_suppr->empty ()))
+  {
+    uint32_t indice; // NS
+    
+    indice = 0;
+    it1 = p->modele.noeuds.begin ();
+    while (it1 != p->modele.noeuds.end ())
+    {
+      (*it1)->indice = indice;
+      indice++;
+      
+      ++it1;
+    }
+    
+    indice = 0;
+    it2 = p->modele.barres.begin ();
+    while (it2 != p->modele.barres.end ())
+    {
+      (*it2)->indice = indice;
+      indice++;
+      
+      ++it2;
+    }
+  }
+  
 #ifdef ENABLE_GTK
   if (UI_APP.builder != NULL)
   {
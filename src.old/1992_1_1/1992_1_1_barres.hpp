@@ -91,6 +91,9 @@ bool _1992_1_1_barres_change_relachement (EF_Barre       *barre,
 bool _1992_1_1_barres_rigidite_ajout      (Projet         *p,
                                            EF_Barre       *element)
                                        __attribute__((__warn_unused_result__));
+bool _1992_1_1_barres_rigidite_variation  (EF_Barre       *element,
+                                           double         *dk_glob)
+                                       __attribute__((__warn_unused_result__));
 bool _1992_1_1_barres_rigidite_ajout_tout (Projet         *p)
                                        __attribute__((__warn_unused_result__));
 
@@ -493,6 +493,7 @@ _1992_1_1_materiaux_ajout (Projet      *p,
   BUG (!std::isnan (m_g (data_beton->n)),
        NULL)
   data_beton->nu = m_f (COEFFICIENT_NU_BETON, FLOTTANT_ORDINATEUR);
+  data_beton->rho = m_f (MASSE_VOLUMIQUE_BETON, FLOTTANT_ORDINATEUR);
   
   materiau_nouveau->nom.assign (*nom);
   
@@ -527,6 +528,7 @@ _1992_1_1_materiaux_ajout (Projet      *p,
  * \param ec3 : nouvelle valeur de ec3, peut être NAN.
  * \param ecu3 : nouvelle valeur de ecu3, peut être NAN.
  * \param nu : nouvelle valeur de nu, peut être NAN.
+ * \param rho : nouvelle valeur de la masse volumique, peut être NAN.
  * \return
  *   Succès : true.
  *   Échec : false :
@@ -551,7 +553,8 @@ _1992_1_1_materiaux_modif (Projet      *p,
                            Flottant     n,
                            Flottant     ec3,
                            Flottant     ecu3,
-                           Flottant     nu)
+                           Flottant     nu,
+                           Flottant     rho)
 {
   Materiau_Beton *data_beton;
   
@@ -633,6 +636,10 @@ _1992_1_1_materiaux_modif (Projet      *p,
   {
     data_beton->nu = nu;
   }
+  if (!std::isnan (m_g (rho)))
+  {
+    data_beton->rho = rho;
+  }
   
   if ((!std::isnan (m_g (fck)))       || (!std::isnan (m_g (fckcube)))   ||
       (!std::isnan (m_g (fcm)))       || (!std::isnan (m_g (fctm)))      ||
@@ -641,7 +648,7 @@ _1992_1_1_materiaux_modif (Projet      *p,
       (!std::isnan (m_g (ecu1)))      || (!std::isnan (m_g (ec2)))       ||
       (!std::isnan (m_g (ecu2)))      || (!std::isnan (m_g (ec3)))       ||
       (!std::isnan (m_g (ecu3)))      || (!std::isnan (m_g (n)))         ||
-      (!std::isnan (m_g (nu))))
+      (!std::isnan (m_g (nu)))        || (!std::isnan (m_g (rho))))
   {
     std::list <EF_Materiau *> liste_materiaux;
     std::list <EF_Barre *>   *liste_barres_dep;
@@ -868,6 +875,14 @@ _1992_1_1_materiaux_get_description (EF_Materiau* materiau)
                  complement == "" ? "" : ", " +
                  format (gettext ("&#957; : %s"), tmp1.c_str ());
   }
+  if (!errrel (m_g (data_beton->rho), MASSE_VOLUMIQUE_BETON))
+  {
+    conv_f_c (data_beton->rho, &tmp1, DECIMAL_SANS_UNITE);
+    
+    complement = complement +
+                 complement == "" ? "" : ", " +
+                 format (gettext ("&#961; : %s kg/m³"), tmp1.c_str ());
+  }
   
   conv_f_c (m_f (m_g (data_beton->fck) / 1000000., data_beton->fck.type),
             &tmp1,
@@ -23,6 +23,8 @@
 #include "common_projet.hpp"
 
 #define COEFFICIENT_NU_BETON 0.2
+// Béton armé, EN 1991-1-1, Annexe A : 25 kN/m³.
+#define MASSE_VOLUMIQUE_BETON (25000. / 9.81)
 
 double _1992_1_1_materiaux_fckcube   (double fck)
                                        __attribute__((__warn_unused_result__));
@@ -78,7 +80,8 @@ bool _1992_1_1_materiaux_modif (Projet      *p,
                                 Flottant     n,
                                 Flottant     ec3,
                                 Flottant     ecu3,
-                                Flottant     nu)
+                                Flottant     nu,
+                                Flottant     rho)
                                        __attribute__((__warn_unused_result__));
 
 std::string _1992_1_1_materiaux_get_description (EF_Materiau *materiau)
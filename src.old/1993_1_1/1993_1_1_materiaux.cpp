@@ -69,6 +69,7 @@ _1993_1_1_materiaux_ajout (Projet      *p,
   data_acier->fu = m_f (m_g (fu) * 1000000., fu.type);
   data_acier->e  = m_f (MODULE_YOUNG_ACIER, FLOTTANT_ORDINATEUR);
   data_acier->nu = m_f (COEFFICIENT_NU_ACIER, FLOTTANT_ORDINATEUR);
+  data_acier->rho = m_f (MASSE_VOLUMIQUE_ACIER, FLOTTANT_ORDINATEUR);
   
   mat = materiau_nouveau.release ();
   mat->data = data_acier.release ();
@@ -90,6 +91,7 @@ _1993_1_1_materiaux_ajout (Projet      *p,
  * \param fu : nouvelle valeur de fu, peut être NAN.
  * \param e : nouvelle valeur de e, peut être NAN.
  * \param nu : nouvelle valeur de nu, peut être NAN.
+ * \param rho : nouvelle valeur de la masse volumique, peut être NAN.
  * \return
  *   Succès : true.
  *   Échec : false :
@@ -103,7 +105,8 @@ _1993_1_1_materiaux_modif (Projet      *p,
                            Flottant     fy,
                            Flottant     fu,
                            Flottant     e,
-                           Flottant     nu)
+                           Flottant     nu,
+                           Flottant     rho)
 {
   Materiau_Acier *data_acier;
   
@@ -141,9 +144,14 @@ _1993_1_1_materiaux_modif (Projet      *p,
   {
     data_acier->nu = nu;
   }
+  if (!std::isnan (m_g (rho)))
+  {
+    data_acier->rho = rho;
+  }
   
   if ((!std::isnan (m_g (fy))) || (!std::isnan (m_g (fu))) ||
-      (!std::isnan (m_g (e))) || (!std::isnan (m_g (nu))))
+      (!std::isnan (m_g (e))) || (!std::isnan (m_g (nu))) ||
+      (!std::isnan (m_g (rho))))
   {
     std::list <EF_Materiau *> liste_materiaux;
     std::list <EF_Barre *>   *liste_barres_dep;
@@ -234,6 +242,13 @@ _1993_1_1_materiaux_get_description (EF_Materiau* materiau)
     description += ", " + format (gettext ("%s, &#957; : %s"), tmp1.c_str ());
   }
   
+  if (!errrel (m_g (data_acier->rho), MASSE_VOLUMIQUE_ACIER))
+  {
+    conv_f_c (data_acier->rho, &tmp1, DECIMAL_SANS_UNITE);
+    description += ", " + format (gettext ("&#961; : %s kg/m³"),
+                                  tmp1.c_str ());
+  }
+  
   return description;
 }
 
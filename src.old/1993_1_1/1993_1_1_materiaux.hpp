@@ -24,6 +24,8 @@
 
 #define COEFFICIENT_NU_ACIER 0.3
 #define MODULE_YOUNG_ACIER 210000000000.
+// Acier, EN 1991-1-1, Annexe A : 77 kN/m³.
+#define MASSE_VOLUMIQUE_ACIER (77000. / 9.81)
 
 EF_Materiau *_1993_1_1_materiaux_ajout (Projet      *p,
                                         std::string *nom,
@@ -36,7 +38,8 @@ bool         _1993_1_1_materiaux_modif (Projet      *p,
                                         Flottant     fy,
                                         Flottant     fu,
                                         Flottant     e,
-                                        Flottant     nu)
+                                        Flottant     nu,
+                                        Flottant     rho)
                                        __attribute__((__warn_unused_result__));
 
 std::string _1993_1_1_materiaux_get_description (EF_Materiau *materiau)
@@ -21,19 +21,23 @@
 #include <algorithm>
 #include <locale>
 #include <string.h>
+#include <chrono>
 
 #include "1990_action.hpp"
 #include "common_projet.hpp"
 #include "common_erreurs.hpp"
 #include "common_math.hpp"
 #include "common_fonction.hpp"
+#include "common_text.hpp"
 #include "EF_charge_barre_ponctuelle.hpp"
 #include "EF_charge_barre_repartie_uniforme.hpp"
 #include "EF_noeuds.hpp"
 #include "EF_rigidite.hpp"
 #include "EF_sections.hpp"
+#include "EF_sous_structures.hpp"
 #include "EF_materiaux.hpp"
 #include "EF_calculs.hpp"
+#include "1992_1_1_barres.hpp"
 
 #ifdef ENABLE_GTK
 #include "common_gtk.hpp"
@@ -56,7 +60,6 @@ bool
 EF_calculs_free (Projet *p)
 {
   std::list <Action   *>::iterator it;
-  std::list <EF_Barre *>::iterator it2;
   
   BUGPARAM (p, "%p", p, false)
   
@@ -72,35 +75,6 @@ EF_calculs_free (Projet *p)
     ++it;
   }
   
-  it2 = p->modele.barres.begin ();
-  while (it2 != p->modele.barres.end ())
-  {
-    EF_Barre *barre = *it2;
-    uint16_t  i;
-    
-    for (i = 0; i <= barre->nds_inter.size (); i++)
-    {
-      if (barre->info_EF[i].m_rig_loc != NULL)
-      {
-        cholmod_free_sparse (&barre->info_EF[i].m_rig_loc, p->calculs.c);
-        barre->info_EF[i].m_rig_loc = NULL;
-      }
-    }
-    
-    if (barre->m_rot != NULL)
-    {
-      cholmod_free_sparse (&barre->m_rot, p->calculs.c);
-      barre->m_rot = NULL;
-    }
-    if (barre->m_rot_t != NULL)
-    {
-      cholmod_free_sparse (&barre->m_rot_t, p->calculs.c);
-      barre->m_rot_t = NULL;
-    }
-    
-    ++it2;
-  }
-  
 #ifdef ENABLE_GTK
   gtk_widget_set_sensitive (UI_GTK.menu_resultats_afficher, FALSE);
   
@@ -129,6 +103,452 @@ EF_calculs_free (Projet *p)
 }
 
 
+/**
+ * \brief Détermine la structure creuse de la matrice de rigidité partielle
+ *        (format CSC) et des lignes de réaction (format CSR) ainsi que les
+ *        tables de dispersion des matrices de rigidité élémentaires. Deux
+ *        noeuds reliés par un tronçon couplent leurs 6 degrés de liberté : la
+ *        structure ne dépend donc que de la connectivité et l'ajout de la
+ *        rigidité des barres se réduit à un cumul dans m_part->x et reac_x,
+ *        sans tri ni doublon. Une barre condensée ne couple dans m_part que
+ *        ses deux extrémités.
+ * \param p : la variable projet,
+ * \param nb_col_partielle : dimension de la matrice de rigidité partielle,
+ * \param nb_col_complete : dimension de la matrice de rigidité complète,
+ * \param interne : les noeuds condensés.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+static bool
+EF_calculs_structure (Projet             *p,
+                      uint32_t            nb_col_partielle,
+                      uint32_t            nb_col_complete,
+                      std::vector <bool> *interne)
+{
+  std::vector <std::vector <uint32_t> > voisins (p->calculs.nb_noeuds);
+  std::vector <std::vector <uint32_t> > voisins_part (p->calculs.nb_noeuds);
+  std::vector <uint32_t> extremites;
+  std::vector <bool> condense;
+  std::vector <uint32_t> rang_reac (nb_col_complete, UINT32_MAX);
+  size_t    nnz_part, nnz_reac, taille_cond;
+  uint32_t  i, t, r;
+  uint8_t   k;
+  int      *pp, *pi; // NS
+  int       pos_part; // NS
+  
+  std::list <EF_Barre *>::iterator it;
+  
+  // Pour chaque tronçon de chaque barre
+  //   Détermination des numéros des deux noeuds.
+  //   Chaque noeud devient voisin de lui-même et de l'autre noeud.
+  // FinPour
+  // Dans la matrice partielle, une barre condensée relie uniquement ses deux
+  // extrémités.
+  t = 0;
+  it = p->modele.barres.begin ();
+  while (it != p->modele.barres.end ())
+  {
+    EF_Barre *barre = *it;
+    EF_Noeud *noeud1, *noeud2;
+    uint16_t  j;
+    bool      cond;
+    
+    std::list <EF_Noeud *>::iterator it2;
+    
+    cond = (!barre->nds_inter.empty ()) &&
+           ((*interne)[barre->nds_inter.front ()->indice]);
+    if (cond)
+    {
+      uint32_t num1 = barre->noeud_debut->indice;
+      uint32_t num2 = barre->noeud_fin->indice;
+      
+      voisins_part[num1].push_back (num1);
+      voisins_part[num1].push_back (num2);
+      voisins_part[num2].push_back (num1);
+      voisins_part[num2].push_back (num2);
+    }
+    
+    noeud1 = barre->noeud_debut;
+    it2 = barre->nds_inter.begin ();
+    for (j = 0; j <= barre->nds_inter.size (); j++)
+    {
+      uint32_t num1, num2;
+      
+      if (it2 == barre->nds_inter.end ())
+      {
+        noeud2 = barre->noeud_fin;
+      }
+      else
+      {
+        noeud2 = *it2;
+        ++it2;
+      }
+      
+      num1 = noeud1->indice;
+      num2 = noeud2->indice;
+      BUG (num1 < p->calculs.nb_noeuds, false)
+      BUG (num2 < p->calculs.nb_noeuds, false)
+      
+      voisins[num1].push_back (num1);
+      voisins[num1].push_back (num2);
+      voisins[num2].push_back (num1);
+      voisins[num2].push_back (num2);
+      if (!cond)
+      {
+        voisins_part[num1].push_back (num1);
+        voisins_part[num1].push_back (num2);
+        voisins_part[num2].push_back (num1);
+        voisins_part[num2].push_back (num2);
+      }
+      extremites.push_back (num1);
+      extremites.push_back (num2);
+      condense.push_back (cond);
+      
+      barre->info_EF[j].troncon = t;
+      t++;
+      noeud1 = noeud2;
+    }
+    
+    ++it;
+  }
+  p->calculs.nb_troncons = t;
+  
+  // Les voisins sont triés par numéro de noeud. Comme n_part et n_comp sont
+  // croissants avec le numéro du noeud, les lignes de chaque colonne seront
+  // ainsi directement triées.
+  nnz_part = 0;
+  nnz_reac = 0;
+  r = 0;
+  // Les degrés de liberté condensés, numérotés à partir de nb_col_partielle,
+  // n'appartiennent pas à la matrice partielle.
+  for (i = 0; i < p->calculs.nb_noeuds; i++)
+  {
+    std::vector <uint32_t>::iterator it2;
+    size_t nb_libres = 0;
+    
+    std::sort (voisins[i].begin (), voisins[i].end ());
+    voisins[i].erase (std::unique (voisins[i].begin (), voisins[i].end ()),
+                      voisins[i].end ());
+    std::sort (voisins_part[i].begin (), voisins_part[i].end ());
+    voisins_part[i].erase (std::unique (voisins_part[i].begin (),
+                                        voisins_part[i].end ()),
+                           voisins_part[i].end ());
+    
+    for (it2 = voisins_part[i].begin (); it2 != voisins_part[i].end (); ++it2)
+    {
+      for (k = 0; k < 6; k++)
+      {
+        if (p->calculs.n_part[*it2][k] < nb_col_partielle)
+        {
+          nb_libres++;
+        }
+      }
+    }
+    for (k = 0; k < 6; k++)
+    {
+      if (p->calculs.n_part[i][k] < nb_col_partielle)
+      {
+        nnz_part += nb_libres;
+      }
+      else if (p->calculs.n_part[i][k] == UINT32_MAX)
+      {
+        uint8_t kk;
+        
+        for (it2 = voisins[i].begin (); it2 != voisins[i].end (); ++it2)
+        {
+          for (kk = 0; kk < 6; kk++)
+          {
+            if (p->calculs.n_part[*it2][kk] != UINT32_MAX)
+            {
+              nnz_reac++;
+            }
+          }
+        }
+        rang_reac[p->calculs.n_comp[i][k]] = r;
+        r++;
+      }
+    }
+  }
+  
+  BUGCRIT (p->calculs.m_part = cholmod_allocate_sparse (nb_col_partielle,
+                                                        nb_col_partielle,
+                                                        nnz_part,
+                                                        1,
+                                                        1,
+                                                        0,
+                                                        CHOLMOD_REAL,
+                                                        p->calculs.c),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  pp = (int *) p->calculs.m_part->p;
+  pi = (int *) p->calculs.m_part->i;
+  memset (p->calculs.m_part->x, 0, sizeof (double) * nnz_part);
+  p->calculs.nb_reactions = r;
+  p->calculs.reac_ligne = new uint32_t [r];
+  p->calculs.reac_p = new uint32_t [r + 1];
+  p->calculs.reac_i = new uint32_t [nnz_reac];
+  p->calculs.reac_x = new double [nnz_reac];
+  memset (p->calculs.reac_x, 0, sizeof (double) * nnz_reac);
+  
+  // Pour chaque noeud
+  //   Pour chaque degré de liberté du noeud
+  //     S'il est bloqué, sa ligne de réaction contient les degrés de liberté
+  //     libres de chaque voisin, triés.
+  //     S'il est libre, la colonne de la matrice partielle contient les
+  //     degrés de liberté libres de chaque voisin.
+  //   FinPour
+  // FinPour
+  pos_part = 0;
+  nnz_reac = 0;
+  for (i = 0; i < p->calculs.nb_noeuds; i++)
+  {
+    for (k = 0; k < 6; k++)
+    {
+      std::vector <uint32_t>::iterator it2;
+      uint8_t kk;
+      
+      if (p->calculs.n_part[i][k] == UINT32_MAX)
+      {
+        r = rang_reac[p->calculs.n_comp[i][k]];
+        p->calculs.reac_ligne[r] = p->calculs.n_comp[i][k];
+        p->calculs.reac_p[r] = (uint32_t) nnz_reac;
+        for (it2 = voisins[i].begin (); it2 != voisins[i].end (); ++it2)
+        {
+          for (kk = 0; kk < 6; kk++)
+          {
+            if (p->calculs.n_part[*it2][kk] != UINT32_MAX)
+            {
+              p->calculs.reac_i[nnz_reac] = p->calculs.n_part[*it2][kk];
+              nnz_reac++;
+            }
+          }
+        }
+        // Les degrés de liberté condensés ne suivent pas l'ordre des noeuds.
+        std::sort (&p->calculs.reac_i[p->calculs.reac_p[r]],
+                   &p->calculs.reac_i[nnz_reac]);
+        continue;
+      }
+      if (p->calculs.n_part[i][k] >= nb_col_partielle)
+      {
+        continue;
+      }
+      pp[p->calculs.n_part[i][k]] = pos_part;
+      for (it2 = voisins_part[i].begin ();
+           it2 != voisins_part[i].end ();
+           ++it2)
+      {
+        for (kk = 0; kk < 6; kk++)
+        {
+          if (p->calculs.n_part[*it2][kk] < nb_col_partielle)
+          {
+            pi[pos_part] = (int) p->calculs.n_part[*it2][kk];
+            pos_part++;
+          }
+        }
+      }
+    }
+  }
+  pp[nb_col_partielle] = pos_part;
+  p->calculs.reac_p[p->calculs.nb_reactions] = (uint32_t) nnz_reac;
+  
+  // Table de dispersion : pour chaque terme (ii, jj) de la matrice
+  // élémentaire de chaque tronçon, recherche dichotomique de sa position dans
+  // la colonne correspondante.
+  p->calculs.disp_part = new uint32_t [t * 144U];
+  p->calculs.disp_reac = new uint32_t [t * 144U];
+  for (i = 0; i < t; i++)
+  {
+    uint8_t ii, jj;
+    
+    for (jj = 0; jj < 12; jj++)
+    {
+      uint32_t nj = extremites[2 * i + jj / 6U];
+      uint8_t  dj = jj % 6;
+      
+      for (ii = 0; ii < 12; ii++)
+      {
+        uint32_t ni = extremites[2 * i + ii / 6U];
+        uint8_t  di = ii % 6;
+        uint32_t pos = i * 144U + jj * 12U + ii;
+        uint32_t col, lig;
+        int     *trouve; // NS
+        
+        col = p->calculs.n_part[nj][dj];
+        lig = p->calculs.n_part[ni][di];
+        if ((lig != UINT32_MAX) || (col == UINT32_MAX))
+        {
+          p->calculs.disp_reac[pos] = UINT32_MAX;
+        }
+        else
+        {
+          uint32_t *ri = p->calculs.reac_i;
+          uint32_t *reac;
+          
+          r = rang_reac[p->calculs.n_comp[ni][di]];
+          reac = std::lower_bound (ri + p->calculs.reac_p[r],
+                                   ri + p->calculs.reac_p[r + 1],
+                                   col);
+          p->calculs.disp_reac[pos] = (uint32_t) (reac - ri);
+        }
+        
+        if ((condense[i]) || (col == UINT32_MAX) || (lig == UINT32_MAX))
+        {
+          p->calculs.disp_part[pos] = UINT32_MAX;
+        }
+        else
+        {
+          trouve = std::lower_bound (pi + pp[col],
+                                     pi + pp[col + 1],
+                                     (int) lig);
+          p->calculs.disp_part[pos] = (uint32_t) (trouve - pi);
+        }
+      }
+    }
+  }
+  
+  // Pour chaque barre condensée
+  //   Réservation de ses données de condensation dans cond_x.
+  //   Table de dispersion de son super-élément reliant ses extrémités.
+  // FinPour
+  taille_cond = 0;
+  it = p->modele.barres.begin ();
+  while (it != p->modele.barres.end ())
+  {
+    EF_Barre *barre = *it;
+    
+    if (condense[barre->info_EF[0].troncon])
+    {
+      taille_cond += 144U + 144U * barre->nds_inter.size ();
+    }
+    
+    ++it;
+  }
+  if (taille_cond == 0)
+  {
+    return true;
+  }
+  
+  p->calculs.cond_x = new double [taille_cond];
+  p->calculs.cond_pos = new size_t [p->modele.barres.size ()];
+  p->calculs.disp_cond = new uint32_t [p->modele.barres.size () * 144U];
+  taille_cond = 0;
+  it = p->modele.barres.begin ();
+  while (it != p->modele.barres.end ())
+  {
+    EF_Barre *barre = *it;
+    uint32_t  nums[2] = {barre->noeud_debut->indice,
+                         barre->noeud_fin->indice};
+    uint8_t   ii, jj;
+    
+    if (!condense[barre->info_EF[0].troncon])
+    {
+      p->calculs.cond_pos[barre->indice] = SIZE_MAX;
+      ++it;
+      continue;
+    }
+    
+    p->calculs.cond_pos[barre->indice] = taille_cond;
+    taille_cond += 144U + 144U * barre->nds_inter.size ();
+    for (jj = 0; jj < 12; jj++)
+    {
+      for (ii = 0; ii < 12; ii++)
+      {
+        uint32_t col = p->calculs.n_part[nums[jj / 6U]][jj % 6U];
+        uint32_t lig = p->calculs.n_part[nums[ii / 6U]][ii % 6U];
+        uint32_t pos = barre->indice * 144U + jj * 12U + ii;
+        
+        if ((col == UINT32_MAX) || (lig == UINT32_MAX))
+        {
+          p->calculs.disp_cond[pos] = UINT32_MAX;
+        }
+        else
+        {
+          int *trouve; // NS
+          
+          trouve = std::lower_bound (pi + pp[col],
+                                     pi + pp[col + 1],
+                                     (int) lig);
+          p->calculs.disp_cond[pos] = (uint32_t) (trouve - pi);
+        }
+      }
+    }
+    
+    ++it;
+  }
+  
+  return true;
+}
+
+
+/**
+ * \brief Détermine les noeuds pouvant être condensés lorsque
+ *        p->calculs.condensation vaut true : noeuds intermédiaires sans appui
+ *        et reliés uniquement aux deux tronçons adjacents de leur barre. Une
+ *        barre n'est condensée que si tous ses noeuds intermédiaires le sont.
+ * \param p : la variable projet,
+ * \param interne : vaut true pour chaque noeud condensé (p->calculs.nb_noeuds
+ *                  valeurs initialisées à false).
+ * \return Rien.
+ */
+static void
+EF_calculs_noeuds_internes (Projet             *p,
+                            std::vector <bool> *interne)
+{
+  std::vector <uint32_t> nb_troncons (p->calculs.nb_noeuds, 0);
+  
+  std::list <EF_Barre *>::iterator it;
+  std::list <EF_Noeud *>::iterator it2;
+  
+  // Nombre d'extrémités de tronçons à chaque noeud.
+  it = p->modele.barres.begin ();
+  while (it != p->modele.barres.end ())
+  {
+    EF_Barre *barre = *it;
+    
+    nb_troncons[barre->noeud_debut->indice]++;
+    nb_troncons[barre->noeud_fin->indice]++;
+    it2 = barre->nds_inter.begin ();
+    while (it2 != barre->nds_inter.end ())
+    {
+      nb_troncons[(*it2)->indice] += 2;
+      
+      ++it2;
+    }
+    
+    ++it;
+  }
+  
+  it = p->modele.barres.begin ();
+  while (it != p->modele.barres.end ())
+  {
+    EF_Barre *barre = *it;
+    bool      cond = !barre->nds_inter.empty ();
+    
+    it2 = barre->nds_inter.begin ();
+    while ((cond) && (it2 != barre->nds_inter.end ()))
+    {
+      cond = ((*it2)->appui == NULL) && (nb_troncons[(*it2)->indice] == 2);
+      
+      ++it2;
+    }
+    
+    it2 = barre->nds_inter.begin ();
+    while ((cond) && (it2 != barre->nds_inter.end ()))
+    {
+      (*interne)[(*it2)->indice] = true;
+      
+      ++it2;
+    }
+    
+    ++it;
+  }
+  
+  return;
+}
+
+
 /**
  * \brief Initialise les diverses variables nécessaires à l'ajout des matrices
  *        de rigidité élémentaires.
@@ -144,12 +564,12 @@ EF_calculs_free (Projet *p)
 bool
 EF_calculs_initialise (Projet *p)
 {
-  uint32_t i, nnz_max;
+  uint32_t i;
   uint32_t nb_col_partielle, nb_col_complete;
   size_t   nb_noeuds;
   
   std::list <EF_Noeud *>::iterator it;
-  std::list <EF_Barre *>::iterator it2;
+  std::vector <bool> interne;
   
   BUGPARAM (p, "%p", p, false)
   INFO (!p->modele.barres.empty (),
@@ -165,6 +585,7 @@ EF_calculs_initialise (Projet *p)
   // degré de liberté des noeuds (via n_part et
   // n_comp) dans la matrice de rigidité globale partielle et
   // complète.
+  p->calculs.nb_noeuds = (uint32_t) nb_noeuds;
   p->calculs.n_part = new uint32_t * [nb_noeuds];
   memset (p->calculs.n_part, 0, sizeof (uint32_t *) * nb_noeuds);
   for (i = 0; i < nb_noeuds; i++)
@@ -177,6 +598,11 @@ EF_calculs_initialise (Projet *p)
   {
     p->calculs.n_comp[i] = new uint32_t [6];
   }
+  interne.assign (nb_noeuds, false);
+  if (p->calculs.condensation)
+  {
+    EF_calculs_noeuds_internes (p, &interne);
+  }
   // Détermination du nombre de colonnes pour la matrice de rigidité complète et
   // partielle :
   // nb_col_partielle = 0.
@@ -193,6 +619,8 @@ EF_calculs_initialise (Projet *p)
   //     FinSi
   //   FinPour
   // FinPour
+  // Les degrés de liberté des noeuds condensés sont numérotés à la suite de
+  // ceux de la matrice partielle.
   nb_col_partielle = 0;
   nb_col_complete = 0;
   it = p->modele.noeuds.begin ();
@@ -214,6 +642,14 @@ EF_calculs_initialise (Projet *p)
     p->calculs.n_comp[i][5] = nb_col_complete;
     nb_col_complete++;
     
+    if (interne[i])
+    {
+      i++;
+      
+      ++it;
+      continue;
+    }
+    
     if (noeud->appui == NULL)
     {
       p->calculs.n_part[i][0] = nb_col_partielle;
@@ -298,1330 +734,2369 @@ EF_calculs_initialise (Projet *p)
     
     ++it;
   }
-  
-  // Détermination du nombre de matrices de rigidité globale élémentaire du
-  // système (y compris la discrétisation).
-  // Détermination du nombre de triplets, soit 12*12*nombre_de_matrices.
-  nnz_max = 0;
-  it2 = p->modele.barres.begin ();
-  while (it2 != p->modele.barres.end ())
+  p->calculs.nb_ddl = nb_col_partielle;
+  for (i = 0; i < nb_noeuds; i++)
   {
-    EF_Barre *element = *it2;
+    uint8_t k;
     
-    nnz_max += 12 * 12U * (element->nds_inter.size () + 1U);
-    
-    ++it2;
+    if (!interne[i])
+    {
+      continue;
+    }
+    for (k = 0; k < 6; k++)
+    {
+      p->calculs.n_part[i][k] = p->calculs.nb_ddl;
+      p->calculs.nb_ddl++;
+    }
   }
   
-  // Allocation des triplets de la matrice de rigidité partielle (t_part) et la
-  // matrice de rigidité globale (triplet_rigidite_globale).
-  BUGCRIT (p->calculs.t_part = cholmod_allocate_triplet (nb_col_partielle,
-                                                         nb_col_partielle,
-                                                         nnz_max,
-                                                         0,
-                                                         CHOLMOD_REAL,
-                                                         p->calculs.c),
-           false,
-           (gettext ("Erreur d'allocation mémoire.\n"));
-             EF_calculs_free (p); )
-  p->calculs.t_part->nnz = nnz_max;
-  BUGCRIT (p->calculs.t_comp = cholmod_allocate_triplet (nb_col_complete,
-                                                         nb_col_complete,
-                                                         nnz_max,
-                                                         0,
-                                                         CHOLMOD_REAL,
-                                                         p->calculs.c),
-           false,
-           (gettext ("Erreur d'allocation mémoire.\n"));
-             EF_calculs_free (p); )
-  p->calculs.t_comp->nnz = nnz_max;
-  
-  // Initialisation de l'indice du triplet en cours à 0 pour la matrice de
-  // rigidité partielle (t_part_en_cours) et globale (t_comp_en_cours).
-  p->calculs.t_part_en_cours = 0;
-  p->calculs.t_comp_en_cours = 0;
+  // Détermination de la structure des matrices de rigidité partielle et
+  // complète et des tables de dispersion des matrices élémentaires.
+  BUG (EF_calculs_structure (p, nb_col_partielle, nb_col_complete, &interne),
+       false,
+       EF_calculs_free (p); )
   
   return true;
 }
 
 
 /**
- * \brief Factorisation de la matrice de rigidité.
+ * \brief Calcule l'empreinte (FNV-1a sur 64 bits) de la topologie du modèle :
+ *        numérotation des degrés de liberté (n_part et n_comp) et connectivité
+ *        des barres discrétisées ainsi que la renumérotation demandée. Deux
+ *        modèles de même empreinte ont la même structure de matrice de
+ *        rigidité et peuvent donc partager la même analyse symbolique.
  * \param p : la variable projet.
- * \return
- *   Succès : true.\n
- *   Échec : false :
- *     - p == NULL,
- *     - p->calculs.t_part == NULL,
- *     - p->calculs.t_comp == NULL,
- *     - en cas d'erreur d'allocation mémoire.
+ * \return L'empreinte.
  */
-bool
-EF_calculs_genere_mat_rig (Projet *p)
+static uint64_t
+EF_calculs_empreinte (Projet *p)
 {
-  uint32_t  i;
-  uint32_t *ai, *aj;
-  double   *ax;
-  void     *symbolic;
-  int       status; // NS
+  uint64_t cle = 14695981039346656037ULL;
+  uint32_t i;
+  uint8_t  k;
   
-  BUGPARAM (p, "%p", p, false)
-  BUGPARAM (p->calculs.t_part, "%p", p->calculs.t_part, false)
-  BUGPARAM (p->calculs.t_comp, "%p", p->calculs.t_comp, false)
+  std::list <EF_Noeud *>::iterator it;
+  std::list <EF_Barre *>::iterator it2;
   
-  ai = (uint32_t *) p->calculs.t_part->i;
-  aj = (uint32_t *) p->calculs.t_part->j;
-  ax = (double *) p->calculs.t_part->x;
-  // On initialise à 0 les valeurs non utilisées dans le triplet rigidite
-  // partiel.
-  for (i = p->calculs.t_part_en_cours; i < p->calculs.t_part->nzmax; i++)
+#define EF_CALCULS_EMPREINTE(VAL) { \
+  cle ^= (uint64_t) (VAL); \
+  cle *= 1099511628211ULL; \
+}
+  EF_CALCULS_EMPREINTE (p->calculs.ordonnancement)
+  EF_CALCULS_EMPREINTE (p->calculs.nb_noeuds)
+  i = 0;
+  it = p->modele.noeuds.begin ();
+  while (it != p->modele.noeuds.end ())
   {
-    ai[i] = 0;
-    aj[i] = 0;
-    ax[i] = 0.;
-  }
+    EF_CALCULS_EMPREINTE ((*it)->numero)
+    for (k = 0; k < 6; k++)
+    {
+      EF_CALCULS_EMPREINTE (p->calculs.n_part[i][k])
+      EF_CALCULS_EMPREINTE (p->calculs.n_comp[i][k])
+    }
     
-  // Si le nombre de lignes du triplet rigidité partielle == 0, cela signifie
-  // que tous les noeuds sont bloqués (cas d'une poutre sur deux appuis sans
-  // discrétisation) Alors
-  //   Initialisation d'un matrice de rigidité partielle vide.
-  //   Convertion du triplet de rigidité complète en matrice.
-  //   Factorisation de la matrice de rigidité partielle vide.
-  //   Fin.
-  // FinSi
-  p->calculs.t_comp->nnz = p->calculs.t_comp_en_cours;
-  if (p->calculs.t_part->nrow == 0)
-  {
-    cholmod_triplet *triplet_rigidite;
+    i++;
+    ++it;
+  }
+  
+  it2 = p->modele.barres.begin ();
+  while (it2 != p->modele.barres.end ())
+  {
+    EF_Barre *barre = *it2;
     
-    BUGCRIT (triplet_rigidite = cholmod_allocate_triplet (0,
-                                                          0,
-                                                          0,
-                                                          0,
-                                                          CHOLMOD_REAL,
-                                                          p->calculs.c),
-             false,
-             (gettext ("Erreur d'allocation mémoire.\n")); )
-    BUGCRIT (p->calculs.m_part = cholmod_triplet_to_sparse (triplet_rigidite,
-                                                            0,
-                                                            p->calculs.c),
-             false,
-             (gettext ("Erreur d'allocation mémoire.\n"));
-               cholmod_free_triplet (&triplet_rigidite, p->calculs.c); )
-    cholmod_free_triplet (&triplet_rigidite, p->calculs.c);
-    p->calculs.m_part->stype = 0;
-    BUGCRIT (p->calculs.m_comp = cholmod_triplet_to_sparse (p->calculs.t_comp,
-                                                            0,
-                                                            p->calculs.c),
-             false,
-             (gettext ("Erreur d'allocation mémoire.\n")); )
-    status = umfpack_di_symbolic (0.,
-                                  0.,
-                                  NULL,
-                                  NULL,
-                                  NULL,
-                                  &symbolic,
-                                  NULL,
-                                  NULL);
-    BUGCRIT (status == UMFPACK_OK,
-             false,
-             (gettext ("Erreur de calcul : %d\n"), status); )
-    status = umfpack_di_numeric (NULL,
-                                 NULL,
-                                 NULL,
-                                 symbolic,
-                                 &p->calculs.numeric,
-                                 NULL,
-                                 NULL);
-    BUGCRIT (status == UMFPACK_OK,
-             false,
-             (gettext ("Erreur de calcul : %d\n"), status);
-               umfpack_di_free_symbolic (&symbolic); )
-    umfpack_di_free_symbolic (&symbolic);
+    EF_CALCULS_EMPREINTE (barre->noeud_debut->numero)
+    it = barre->nds_inter.begin ();
+    while (it != barre->nds_inter.end ())
+    {
+      EF_CALCULS_EMPREINTE ((*it)->numero)
+      
+      ++it;
+    }
+    EF_CALCULS_EMPREINTE (barre->noeud_fin->numero)
     
-    return true;
+    ++it2;
   }
+#undef EF_CALCULS_EMPREINTE
   
-  BUGCRIT (p->calculs.m_part = cholmod_triplet_to_sparse (p->calculs.t_part,
-                                                          0,
-                                                          p->calculs.c),
-           false,
-           (gettext ("Erreur d'allocation mémoire.\n")); )
-  BUGCRIT (p->calculs.m_comp = cholmod_triplet_to_sparse (p->calculs.t_comp,
-                                                          0,
-                                                          p->calculs.c),
-           false,
-           (gettext ("Erreur d'allocation mémoire.\n")); )
+  return cle;
+}
+
+
+/**
+ * \brief Ajoute une ligne au rapport d'analyse de la résolution
+ *        p->calculs.rapport. Le rapport est créé s'il n'existe pas encore.
+ * \param p : la variable projet,
+ * \param analyse : la description de l'analyse,
+ * \param resultat : 0 si tout va bien, 1 pour un avertissement, 2 pour une
+ *                   erreur,
+ * \param commentaire : le commentaire de l'analyse.
+ * \return Rien.
+ */
+void
+EF_calculs_rapport_ajout (Projet            *p,
+                          const std::string &analyse,
+                          uint8_t            resultat,
+                          const std::string &commentaire)
+{
+  Analyse_Comm *ligne;
   
-  // Factorisation de la matrice de rigidité partielle.
-  p->calculs.ap = new int [p->calculs.t_part->ncol + 1];
-  p->calculs.ai = new int [p->calculs.t_part->nnz],
-  p->calculs.ax = new double [p->calculs.t_part->nnz];
-  ai = (uint32_t *) p->calculs.t_part->i;
-  aj = (uint32_t *) p->calculs.t_part->j;
-  ax = (double *) p->calculs.t_part->x;
-  status = umfpack_di_triplet_to_col ((int) p->calculs.t_part->nrow,
-                                      (int) p->calculs.t_part->ncol,
-                                      (int) p->calculs.t_part->nnz,
-                                      (int *) ai,
-                                      (int *) aj,
-                                      ax,
-                                      p->calculs.ap,
-                                      p->calculs.ai,
-                                      p->calculs.ax,
-                                      NULL);
-  BUGCRIT (status == UMFPACK_OK,
-           false,
-           (gettext ("Erreur de calcul : %d\n"), status); )
-  status = umfpack_di_symbolic ((int) p->calculs.t_part->nrow,
-                                (int) p->calculs.t_part->ncol,
-                                p->calculs.ap,
-                                p->calculs.ai,
-                                p->calculs.ax,
-                                &symbolic,
-                                NULL,
-                                NULL);
-  BUGCRIT (status == UMFPACK_OK,
-           false,
-           (gettext ("Erreur de calcul : %d\n"), status); )
-  status = umfpack_di_numeric (p->calculs.ap,
-                               p->calculs.ai,
-                               p->calculs.ax,
-                               symbolic,
-                               &p->calculs.numeric,
-                               NULL,
-                               NULL);
-  if (status == UMFPACK_WARNING_singular_matrix)
-  {
-    printf (gettext ("Attention, matrice singulière.\n"
-                "Il est possible que la modélisation ne soit pas stable.\n"));
-  }
-  else
+  if (p->calculs.rapport == NULL)
   {
-    BUGCRIT (status == UMFPACK_OK,
-             false,
-             (gettext ("Erreur de calcul : %d\n"), status);
-               umfpack_di_free_symbolic (&symbolic); )
+    p->calculs.rapport = new std::list <Analyse_Comm *> ();
   }
-  umfpack_di_free_symbolic (&symbolic);
   
-  return true;
+  ligne = new Analyse_Comm;
+  ligne->analyse = analyse;
+  ligne->resultat = resultat;
+  ligne->commentaire = commentaire;
+  p->calculs.rapport->push_back (ligne);
+  
+  return;
 }
 
 
 /**
- * \brief Calcul le moment hyperstatique correspondant à l'opposé du moment de
- *        la réaction à partir de la rotation au point A et B autour de l'axe
- *        Y.
- * \param infos : contient les paramètres ay, by, cy, kAy et kBy,
- * \param phia : rotation au noeud A,
- * \param phib : rotation au noeud B,
- * \param ma : moment au noeud A. Peut être NULL,
- * \param mb : moment au noeud B. Peut être NULL.
- * \return
- *   Succès : true.\n
- *   Échec : false :
- *     - infos == NULL.
+ * \brief Détermine la renumérotation Cuthill-McKee inverse du graphe des
+ *        noeuds de la matrice de rigidité partielle. Chaque noeud apporte
+ *        ensemble ses degrés de liberté libres. Le graphe est déduit de la
+ *        structure de p->calculs.m_part (complète, stype = 0).
+ * \param p : la variable projet,
+ * \param perm : la permutation (p->calculs.m_part->nrow valeurs) : perm[k]
+ *               est la colonne de m_part placée en position k.
+ * \return Rien.
  */
-bool
-EF_calculs_moment_hyper_y (Barre_Info_EF *infos,
-                           double         phia,
-                           double         phib,
-                           double        *ma,
-                           double        *mb)
+static void
+EF_calculs_rcm (Projet *p,
+                int    *perm)
 {
-  BUGPARAM (infos, "%p", infos, false)
+  cholmod_sparse *m = p->calculs.m_part;
+  int            *ap = (int *) m->p; // NS
+  int            *ai = (int *) m->i; // NS
+  uint32_t        nb = p->calculs.nb_noeuds;
+  std::vector <uint32_t> noeud_ddl (m->nrow);
+  std::vector <std::vector <uint32_t> > voisins (nb);
+  std::vector <uint32_t> ordre;
+  std::vector <bool> vu (nb, false);
+  uint32_t        i, j, pos;
+  uint8_t         k;
   
-  // Calcul des moments créés par les raideurs :\end{verbatim}
-  // \texttt{Référence : \cite{RDM_articulation}}\begin{align*}
-  //   M_{Ay} & = \frac{b_y \cdot \varphi_{By}+(c_y+k_{By}) \cdot
-  //           \varphi_{Ay}}{(a_y+k_{Ay}) \cdot (c_y+k_{By})-b_y^2} \nonumber\\
-  //   M_{By} & = \frac{b_y \cdot \varphi_{Ay}+(a_y+k_{Ay}) \cdot
-  //          \varphi_{By}}{(a_y+k_{Ay}) \cdot (c_y+k_{By})-b_y^2} \end{align*}
-  // \begin{verbatim}
-  if ((errrel (infos->kAy, MAXDOUBLE)) && (errrel (infos->kBy, MAXDOUBLE)))
+  // Noeud de chaque degré de liberté puis graphe des noeuds.
+  for (i = 0; i < nb; i++)
   {
-    if (ma != NULL)
-    {
-      *ma = 0.;
-    }
-    if (mb != NULL)
+    for (k = 0; k < 6; k++)
     {
-      *mb = 0.;
+      if (p->calculs.n_part[i][k] < m->nrow)
+      {
+        noeud_ddl[p->calculs.n_part[i][k]] = i;
+      }
     }
   }
-  else if (errrel (infos->kAy, MAXDOUBLE))
+  for (j = 0; j < m->ncol; j++)
   {
-    if (ma != NULL)
+    int q; // NS
+    
+    for (q = ap[j]; q < ap[j + 1]; q++)
     {
-      *ma = 0.;
+      if (noeud_ddl[(size_t) ai[q]] != noeud_ddl[j])
+      {
+        voisins[noeud_ddl[j]].push_back (noeud_ddl[(size_t) ai[q]]);
+      }
     }
-    if (mb != NULL)
+  }
+  for (i = 0; i < nb; i++)
+  {
+    std::sort (voisins[i].begin (), voisins[i].end ());
+    voisins[i].erase (std::unique (voisins[i].begin (), voisins[i].end ()),
+                      voisins[i].end ());
+    // Les noeuds entièrement bloqués ou condensés n'apparaissent pas dans
+    // m_part.
+    vu[i] = true;
+    for (k = 0; k < 6; k++)
     {
-      *mb = phib / (infos->cy + infos->kBy);
+      if (p->calculs.n_part[i][k] < m->nrow)
+      {
+        vu[i] = false;
+      }
     }
   }
-  else if (errrel (infos->kBy, MAXDOUBLE))
+  
+  // Pour chaque composante connexe
+  //   Recherche d'un noeud pseudo-périphérique : parcours en largeur depuis
+  //   le noeud de plus faible degré puis depuis le noeud de plus faible degré
+  //   du dernier niveau tant que l'excentricité augmente.
+  //   Parcours en largeur, les voisins étant visités par degré croissant.
+  // FinPour
+  while (true)
   {
-    if (ma != NULL)
+    uint32_t depart = UINT32_MAX, excentricite = 0;
+    size_t   debut;
+    
+    for (i = 0; i < nb; i++)
     {
-      *ma = phia / (infos->ay + infos->kAy);
+      if ((!vu[i]) &&
+          ((depart == UINT32_MAX) ||
+           (voisins[i].size () < voisins[depart].size ())))
+      {
+        depart = i;
+      }
     }
-    if (mb != NULL)
+    if (depart == UINT32_MAX)
     {
-      *mb = 0.;
+      break;
     }
-  }
-  else
-  {
-    if (ma != NULL)
+    
+    while (true)
     {
-      *ma = (infos->by * phib + (infos->cy + infos->kBy) * phia) /
-              ((infos->ay + infos->kAy) * (infos->cy + infos->kBy) -
-               infos->by * infos->by);
+      std::vector <uint32_t> niveau (1, depart), suivant;
+      std::vector <bool>     vu2 (vu);
+      uint32_t               nb_niveaux = 0, candidat;
+      
+      vu2[depart] = true;
+      while (true)
+      {
+        suivant.clear ();
+        for (i = 0; i < niveau.size (); i++)
+        {
+          for (j = 0; j < voisins[niveau[i]].size (); j++)
+          {
+            if (!vu2[voisins[niveau[i]][j]])
+            {
+              vu2[voisins[niveau[i]][j]] = true;
+              suivant.push_back (voisins[niveau[i]][j]);
+            }
+          }
+        }
+        if (suivant.empty ())
+        {
+          break;
+        }
+        niveau.swap (suivant);
+        nb_niveaux++;
+      }
+      if (nb_niveaux <= excentricite)
+      {
+        break;
+      }
+      excentricite = nb_niveaux;
+      candidat = niveau[0];
+      for (i = 1; i < niveau.size (); i++)
+      {
+        if (voisins[niveau[i]].size () < voisins[candidat].size ())
+        {
+          candidat = niveau[i];
+        }
+      }
+      depart = candidat;
     }
-    if (mb != NULL)
+    
+    debut = ordre.size ();
+    ordre.push_back (depart);
+    vu[depart] = true;
+    for (pos = (uint32_t) debut; pos < ordre.size (); pos++)
     {
-      *mb = (infos->by * phia + (infos->ay + infos->kAy) * phib) /
-              ((infos->ay + infos->kAy) * (infos->cy + infos->kBy) -
-               infos->by * infos->by);
+      size_t taille = ordre.size ();
+      
+      for (j = 0; j < voisins[ordre[pos]].size (); j++)
+      {
+        if (!vu[voisins[ordre[pos]][j]])
+        {
+          vu[voisins[ordre[pos]][j]] = true;
+          ordre.push_back (voisins[ordre[pos]][j]);
+        }
+      }
+      // Les voisins ajoutés sont classés par degré croissant.
+      for (j = (uint32_t) taille + 1; j < ordre.size (); j++)
+      {
+        uint32_t noeud = ordre[j];
+        size_t   l = j;
+        
+        while ((l > taille) &&
+               (voisins[ordre[l - 1]].size () > voisins[noeud].size ()))
+        {
+          ordre[l] = ordre[l - 1];
+          l--;
+        }
+        ordre[l] = noeud;
+      }
     }
   }
   
-  return true;
+  // Ordre inverse puis passage des noeuds aux degrés de liberté.
+  pos = 0;
+  for (i = (uint32_t) ordre.size (); i > 0; i--)
+  {
+    for (k = 0; k < 6; k++)
+    {
+      if (p->calculs.n_part[ordre[i - 1]][k] < p->calculs.m_part->nrow)
+      {
+        perm[pos] = (int) p->calculs.n_part[ordre[i - 1]][k];
+        pos++;
+      }
+    }
+  }
+  
+  return;
 }
 
 
 /**
- * \brief Calcul le moment hyperstatique correspondant à l'opposé du moment de
- *        la réaction à partir de la rotation au point A et B autour de l'axe
- *        Z.
- * \param infos : contient les paramètres az, bz, cz et kAz et kBz,
- * \param phia : rotation au noeud A,
- * \param phib : rotation au noeud B,
- * \param ma : moment au noeud A. Peut être NULL,
- * \param mb : moment au noeud B. Peut être NULL.
- * \return
- *   Succès : true.\n
- *   Échec : false :
- *     - infos == NULL
+ * \brief Détermine la largeur de bande d'une matrice après permutation
+ *        symétrique, soit le maximum de |pinv[i] - pinv[j]| pour les termes
+ *        (i, j) de la matrice.
+ * \param m : la matrice,
+ * \param perm : la permutation, NULL pour l'ordre naturel.
+ * \return La largeur de bande.
  */
-bool
-EF_calculs_moment_hyper_z (Barre_Info_EF *infos,
-                           double         phia,
-                           double         phib,
-                           double        *ma,
-                           double        *mb)
+static uint32_t
+EF_calculs_largeur_bande (cholmod_sparse *m,
+                          const int      *perm)
 {
-  BUGPARAM (infos, "%p", infos, false)
+  int     *ap = (int *) m->p; // NS
+  int     *ai = (int *) m->i; // NS
+  std::vector <uint32_t> pinv (m->nrow);
+  uint32_t largeur = 0;
+  size_t   j;
   
-  // Calcul des moments créés par les raideurs :\end{verbatim}
-  // \texttt{Référence : \cite{RDM_articulation}}\begin{align*}
-  //   M_{Az} & = \frac{b_z \cdot \varphi_{Bz}+(c_z+k_{Bz}) \cdot
-  //           \varphi_{Az}}{(a_z+k_{Az}) \cdot (c_z+k_{Bz})-b_z^2} \nonumber\\
-  //   M_{Bz} & = \frac{b_z \cdot \varphi_{Az}+(a_z+k_{Az}) \cdot
-  //   \varphi_{Bz}}{(a_z+k_{Az}) \cdot (c_z+k_{Bz})-b_z^2}\end{align*}
-  //   \begin{verbatim}
-  if ((errrel (infos->kAz, MAXDOUBLE)) && (errrel (infos->kBz, MAXDOUBLE)))
+  for (j = 0; j < m->nrow; j++)
   {
-    if (ma != NULL)
+    pinv[perm == NULL ? j : (size_t) perm[j]] = (uint32_t) j;
+  }
+  for (j = 0; j < m->ncol; j++)
+  {
+    int q; // NS
+    
+    for (q = ap[j]; q < ap[j + 1]; q++)
     {
-      *ma = 0.;
+      uint32_t a = pinv[(size_t) ai[q]], b = pinv[j];
+      
+      largeur = std::max (largeur, a > b ? a - b : b - a);
     }
-    if (mb != NULL)
+  }
+  
+  return largeur;
+}
+
+
+/**
+ * \brief Détermine le nombre d'opérations d'une factorisation de Cholesky
+ *        supernodale. Les termes nuls ajoutés lors du regroupement des
+ *        colonnes en supernoeuds sont comptés.
+ * \param factor : la factorisation.
+ * \return Le nombre d'opérations.
+ */
+static double
+EF_calculs_cholesky_operations (cholmod_factor *factor)
+{
+  int   *super = (int *) factor->super; // NS
+  int   *pi = (int *) factor->pi; // NS
+  double flops = 0.;
+  size_t s;
+  
+  for (s = 0; s < factor->nsuper; s++)
+  {
+    int k, nscol = super[s + 1] - super[s], nsrow = pi[s + 1] - pi[s]; // NS
+    
+    for (k = 0; k < nscol; k++)
     {
-      *mb = 0.;
+      flops += (double) (nsrow - k) * (double) (nsrow - k);
     }
   }
-  else if (errrel (infos->kAz, MAXDOUBLE))
+  
+  return flops;
+}
+
+
+/**
+ * \brief Renvoie le nom de la renumérotation demandée.
+ * \param ordre : la renumérotation.
+ * \return Le nom traduit.
+ */
+static const char *
+EF_calculs_ordonnancement_nom (EF_Ordonnancement ordre)
+{
+  switch (ordre)
   {
-    if (ma != NULL)
+    case EF_ORDRE_AMD :
     {
-      *ma = 0.;
+      return gettext ("AMD");
     }
-    if (mb != NULL)
+    case EF_ORDRE_COLAMD :
     {
-      *mb = phib / (infos->cz + infos->kBz);
+      return gettext ("COLAMD");
     }
-  }
-  else if (errrel (infos->kBz, MAXDOUBLE))
-  {
-    if (ma != NULL)
+    case EF_ORDRE_DISSECTION :
     {
-      *ma = phia / (infos->az + infos->kAz);
+      return gettext ("dissection emboîtée");
     }
-    if (mb != NULL)
+    case EF_ORDRE_RCM :
     {
-      *mb = 0.;
+      return gettext ("Cuthill-McKee inverse");
     }
-  }
-  else
-  {
-    if (ma != NULL)
+    case EF_ORDRE_DEFAUT :
+    default :
     {
-      *ma = (infos->bz * phib + (infos->cz + infos->kBz) * phia) /
-              ((infos->az + infos->kAz) * (infos->cz + infos->kBz) -
-               infos->bz * infos->bz);
-    }
-    if (mb != NULL)
-    {
-      *mb = (infos->bz * phia + (infos->az + infos->kAz) * phib) /
-              ((infos->az + infos->kAz) * (infos->cz + infos->kBz) -
-               infos->bz * infos->bz);
+      return gettext ("par défaut");
     }
   }
+}
+
+
+/**
+ * \brief Ajoute au rapport le bilan d'une factorisation : largeur de bande,
+ *        remplissage prévu et obtenu, nombre d'opérations et mémoire
+ *        maximale.
+ * \param p : la variable projet,
+ * \param methode : le nom de la factorisation,
+ * \param bande : largeur de bande de m_part dans l'ordre naturel,
+ * \param bande_perm : largeur de bande après renumérotation, UINT32_MAX si
+ *                     la permutation n'est pas connue,
+ * \param nnz : nombre de termes non nuls du facteur obtenu,
+ * \param flops : nombre d'opérations de la factorisation,
+ * \param memoire : mémoire maximale utilisée par la factorisation (octets).
+ * \return Rien.
+ */
+static void
+EF_calculs_rapport_factorisation (Projet     *p,
+                                  const char *methode,
+                                  uint32_t    bande,
+                                  uint32_t    bande_perm,
+                                  double      nnz,
+                                  double      flops,
+                                  double      memoire)
+{
+  std::string commentaire;
+  
+  if (bande_perm == UINT32_MAX)
+  {
+    commentaire = format (gettext ("Largeur de bande : %u."), bande);
+  }
+  else
+  {
+    commentaire = format (gettext ("Largeur de bande : %u (après renumérotation : %u)."),
+                          bande,
+                          bande_perm);
+  }
+  commentaire += format (gettext (" Termes non nuls du facteur : %.0f prévus, %.0f obtenus. Opérations : %.3g prévues, %.3g obtenues. Mémoire maximale : %.1f Mo prévus, %.1f Mo obtenus."),
+                         p->calculs.symbolique_prevision[0],
+                         nnz,
+                         p->calculs.symbolique_prevision[1],
+                         flops,
+                         p->calculs.symbolique_prevision[2] / 1048576.,
+                         memoire / 1048576.);
   
-  return true;
+  EF_calculs_rapport_ajout (p,
+                            format (gettext ("Factorisation %s, renumérotation %s"),
+                                    methode,
+                                    EF_calculs_ordonnancement_nom (
+                                      p->calculs.ordonnancement)),
+                            0,
+                            commentaire);
+  
+  return;
 }
 
 
 /**
- * \brief Détermine le résidu lors de la résolution du système matriciel pour
- *        obtenir les déplacements aux noeuds (A.x = b).
- * \param Ap : Matrice de rigidité,
- * \param Ai : Matrice de rigidité,
- * \param Ax : Matrice de rigidité,
- * \param b : Résultat à obtenir,
- * \param n : Nombre de ligne dans le vecteur b,
- * \param x : Résultat obtenu.
+ * \brief Analyse symbolique de Cholesky de la matrice de rigidité partielle
+ *        : renumérotation demandée par p->calculs.ordonnancement et structure
+ *        supernodale du facteur. L'analyse est conservée dans
+ *        p->calculs.symbolique_chol et n'est refaite que si elle a été
+ *        libérée (changement de topologie).
+ * \param p : la variable projet,
+ * \param m_sym : le triangle supérieur de p->calculs.m_part.
  * \return
- *   Succès : valeur du résidu.\n
- *   Échec : NAN :
- *     - Ap == NULL,
- *     - Ai == NULL,
- *     - Ax == NULL,
- *     - b == NULL,
- *     - x == NULL,
+ *   Succès : true.\n
+ *   Échec : false :
  *     - en cas d'erreur d'allocation mémoire.
  */
-double
-EF_calculs_resid (int    *Ap,
-                  int    *Ai,
-                  double *Ax,
-                  double *b,
-                  size_t  n,
-                  double *x)
+static bool
+EF_calculs_symbolique_cholesky (Projet         *p,
+                                cholmod_sparse *m_sym)
 {
-  int     p; // NS
-  size_t  j, k;
-  double  norm ;
-  double *r;
-  
-  // Fonction tirée de la librarie UMFPACK, du fichier umfpack_di_demo.c
-  BUGPARAM (Ap, "%p", Ap, NAN)
-  BUGPARAM (Ai, "%p", Ai, NAN)
-  BUGPARAM (Ax, "%p", Ax, NAN)
-  BUGPARAM (b, "%p", b, NAN)
-  BUGPARAM (x, "%p", x, NAN)
+  int  supernodal, nmethods, ordering; // NS
+  int *perm = NULL; // NS
   
-  r = new double [n];
+  if (p->calculs.symbolique_chol != NULL)
+  {
+    return true;
+  }
   
-  for (k = 0; k < n; k++)
+  supernodal = p->calculs.c->supernodal;
+  nmethods = p->calculs.c->nmethods;
+  ordering = p->calculs.c->method[0].ordering;
+  p->calculs.c->supernodal = CHOLMOD_SUPERNODAL;
+  if (p->calculs.ordonnancement != EF_ORDRE_DEFAUT)
   {
-  	r[k] = -b[k];
+    p->calculs.c->nmethods = 1;
   }
-  for (j = 0; j < n; j++)
+  switch (p->calculs.ordonnancement)
   {
-    for (p = Ap[j]; p < Ap[j + 1]; p++)
+    case EF_ORDRE_AMD :
     {
-  		r[Ai[p]] += Ax[p] * x[j];
+      p->calculs.c->method[0].ordering = CHOLMOD_AMD;
+      break;
+    }
+    case EF_ORDRE_COLAMD :
+    {
+      p->calculs.c->method[0].ordering = CHOLMOD_COLAMD;
+      break;
+    }
+    case EF_ORDRE_DISSECTION :
+    {
+      p->calculs.c->method[0].ordering = CHOLMOD_NESDIS;
+      break;
+    }
+    case EF_ORDRE_RCM :
+    {
+      p->calculs.c->method[0].ordering = CHOLMOD_GIVEN;
+      perm = new int [m_sym->nrow];
+      EF_calculs_rcm (p, perm);
+      break;
+    }
+    case EF_ORDRE_DEFAUT :
+    default :
+    {
+      break;
     }
   }
-  norm = 0.;
-  for (k = 0; k < n; k++)
+  if (perm != NULL)
   {
-  	norm = std::max (fabs (r[k]), norm);
+    p->calculs.symbolique_chol = cholmod_analyze_p (m_sym,
+                                                    perm,
+                                                    NULL,
+                                                    0,
+                                                    p->calculs.c);
   }
-  delete [] r;
+  else
+  {
+    p->calculs.symbolique_chol = cholmod_analyze (m_sym, p->calculs.c);
+  }
+  p->calculs.c->supernodal = supernodal;
+  p->calculs.c->nmethods = nmethods;
+  p->calculs.c->method[0].ordering = ordering;
+  delete [] perm;
+  BUGCRIT (p->calculs.symbolique_chol,
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
   
-  return norm;
+  // Prévisions de l'analyse : termes non nuls exacts de L, opérations et
+  // taille du facteur supernodal (valeurs et indices des lignes).
+  p->calculs.symbolique_prevision[0] = p->calculs.c->lnz;
+  p->calculs.symbolique_prevision[1] = p->calculs.c->fl;
+  p->calculs.symbolique_prevision[2] =
+    (double) (p->calculs.symbolique_chol->xsize * sizeof (double) +
+              p->calculs.symbolique_chol->ssize * sizeof (int));
+  
+  return true;
 }
 
 
 /**
- * \brief Détermine à partir de la matrice de rigidité partielle factorisée les
- *        déplacements et les efforts dans les noeuds pour l'action demandée
- *        ainsi que la courbe des sollicitations dans les barres.
+ * \brief Factorisation de Cholesky supernodale de la matrice de rigidité
+ *        partielle. En cas de succès, p->calculs.m_part est remplacée par son
+ *        seul triangle supérieur et la factorisation est stockée dans
+ *        p->calculs.factor.
  * \param p : la variable projet,
- * \param action : l'action à résoudre.
+ * \param ok : vaut false si la matrice n'est pas définie positive. Dans ce
+ *             cas, p->calculs.m_part n'est pas modifiée.
  * \return
  *   Succès : true.\n
  *   Échec : false :
- *     - p == NULL,
- *     - action == NULL,
- *     - p->calculs.numeric == NULL && matrice_partielle->nrow != 0,
  *     - en cas d'erreur d'allocation mémoire.
  */
-bool
-EF_calculs_resoud_charge (Projet *p,
-                          Action *action)
+static bool
+EF_calculs_genere_mat_rig_cholesky (Projet *p,
+                                    bool   *ok)
 {
-  cholmod_triplet *t_dep_tot, *t_dep_part;
-  cholmod_triplet *t_for_part, *t_for_comp;
-  cholmod_triplet *t_eff_loc_f, *t_eff_glo_i;
-  cholmod_triplet *t_eff_loc_i, *t_eff_glo_f;
-  uint32_t        *ai, *aj;
-  double          *ax;
-  uint32_t        *ai2, *aj2;
-  double          *ax2;
-  uint32_t        *ai3, *aj3;
-  double          *ax3;
-  uint32_t         i, j;
-  uint8_t          k;
-  cholmod_sparse  *sparse_tmp;
-  double           minusone[2] = {-1., 0.}, one[2] = {1., 0.};
+  cholmod_sparse *m_sym;
+  cholmod_factor *factor;
+  uint32_t        bande;
+  size_t          memoire;
   
-  std::list <EF_Barre *>::iterator it;
+  *ok = false;
   
-  BUGPARAM (p, "%p", p, false)
-  BUGPARAM (action, "%p", action, false)
-  BUGPARAM (p->calculs.numeric, "%p", p->calculs.numeric, false)
-  BUGPARAM (p->calculs.m_part, "%p", p->calculs.m_part, false)
-  BUGPARAM (p->calculs.m_part->nrow,
-            "%zu",
-            p->calculs.m_part->nrow != 0,
-            false)
+  bande = EF_calculs_largeur_bande (p->calculs.m_part, NULL);
   
-  // Création du triplet partiel et complet contenant les forces extérieures
-  // sur les noeuds et initialisation des valeurs à 0. Le vecteur partiel sera 
-  // utilisé dans l'équation finale : {F} = [K]{D}
-  BUG (_1990_action_fonction_init (p, action), false)
-  BUGCRIT (t_for_part = cholmod_allocate_triplet (p->calculs.m_part->nrow,
-                                                  1,
-                                                  p->calculs.m_part->nrow,
-                                                  0,
-                                                  CHOLMOD_REAL,
-                                                  p->calculs.c),
+  // Seul le triangle supérieur est conservé, la matrice étant symétrique.
+  BUGCRIT (m_sym = cholmod_copy (p->calculs.m_part, 1, 1, p->calculs.c),
            false,
            (gettext ("Erreur d'allocation mémoire.\n")); )
-  ai = (uint32_t *) t_for_part->i;
-  aj = (uint32_t *) t_for_part->j;
-  ax = (double *) t_for_part->x;
-  t_for_part->nnz = p->calculs.m_part->nrow;
-  for (i = 0; i < t_for_part->nnz; i++)
+  
+  // L'analyse symbolique (permutation et structure du facteur) n'est refaite
+  // que si la topologie a changé depuis la précédente analyse.
+  BUG (EF_calculs_symbolique_cholesky (p, m_sym),
+       false,
+       cholmod_free_sparse (&m_sym, p->calculs.c); )
+  
+  // Mémoire maximale utilisée à partir de ce point.
+  memoire = p->calculs.c->memory_inuse;
+  p->calculs.c->memory_usage = memoire;
+  BUGCRIT (factor = cholmod_copy_factor (p->calculs.symbolique_chol,
+                                         p->calculs.c),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n"));
+             cholmod_free_sparse (&m_sym, p->calculs.c); )
+  cholmod_factorize (m_sym, factor, p->calculs.c);
+  memoire = p->calculs.c->memory_usage - memoire;
+  
+  // Matrice non définie positive (mécanisme) : on laisse la main à la
+  // factorisation LU.
+  if ((p->calculs.c->status == CHOLMOD_NOT_POSDEF) ||
+      (factor->minor < factor->n))
   {
-    ai[i] = i;
-    aj[i] = 0;
-    ax[i] = 0.;
+    cholmod_free_factor (&factor, p->calculs.c);
+    cholmod_free_sparse (&m_sym, p->calculs.c);
+    
+    return true;
   }
-  BUGCRIT (t_for_comp = cholmod_allocate_triplet (p->calculs.m_comp->nrow,
-                                                  1,
-                                                  p->calculs.m_comp->nrow,
-                                                  0,
-                                                  CHOLMOD_REAL,
-                                                  p->calculs.c),
+  BUGCRIT (p->calculs.c->status == CHOLMOD_OK,
            false,
-           (gettext ("Erreur d'allocation mémoire.\n"));
-             cholmod_free_triplet (&t_for_part, p->calculs.c); )
-  ai3 = (uint32_t *) t_for_comp->i;
-  aj3 = (uint32_t *) t_for_comp->j;
-  ax3 = (double *) t_for_comp->x;
-  t_for_comp->nnz = p->calculs.m_comp->nrow;
-  for (i = 0; i < t_for_comp->nnz; i++)
+           (gettext ("Erreur de calcul : %d\n"), p->calculs.c->status);
+             cholmod_free_factor (&factor, p->calculs.c);
+             cholmod_free_sparse (&m_sym, p->calculs.c); )
+  
+  cholmod_free_sparse (&p->calculs.m_part, p->calculs.c);
+  p->calculs.m_part = m_sym;
+  p->calculs.factor = factor;
+  *ok = true;
+  
+  EF_calculs_rapport_factorisation (
+    p,
+    gettext ("de Cholesky"),
+    bande,
+    EF_calculs_largeur_bande (m_sym, (int *) factor->Perm),
+    (double) factor->xsize,
+    EF_calculs_cholesky_operations (factor),
+    (double) memoire);
+  
+  return true;
+}
+
+
+/**
+ * \brief Renvoie l'adresse du terme (i, j) d'une matrice sparse dont les
+ *        lignes de chaque colonne sont triées.
+ * \param m : la matrice,
+ * \param i : la ligne,
+ * \param j : la colonne.
+ * \return L'adresse du terme dans m->x, NULL s'il n'existe pas.
+ */
+static double *
+EF_calculs_terme (cholmod_sparse *m,
+                  uint32_t        i,
+                  uint32_t        j)
+{
+  int    *ap = (int *) m->p; // NS
+  int    *ai = (int *) m->i; // NS
+  double *ax = (double *) m->x;
+  int    *pos; // NS
+  
+  pos = std::lower_bound (&ai[ap[j]], &ai[ap[j + 1]], (int) i);
+  if ((pos == &ai[ap[j + 1]]) || (*pos != (int) i))
   {
-    ai3[i] = i;
-    aj3[i] = 0;
-    ax3[i] = 0.;
+    return NULL;
   }
   
-  // Détermination des charges aux noeuds :
-  //   Pour chaque charge dans l'action
-  if (!_1990_action_charges_vide (action))
+  return &ax[pos - ai];
+}
+
+
+/**
+ * \brief Renvoie la valeur (i, j) d'une matrice sparse dont les lignes de
+ *        chaque colonne sont triées.
+ * \param m : la matrice,
+ * \param i : la ligne,
+ * \param j : la colonne.
+ * \return La valeur, 0. si le terme n'existe pas.
+ */
+static double
+EF_calculs_valeur (cholmod_sparse *m,
+                   uint32_t        i,
+                   uint32_t        j)
+{
+  double *terme;
+  
+  terme = EF_calculs_terme (m, i, j);
+  if (terme == NULL)
   {
-    std::list <Charge *>::iterator it3;
-    
-    it3 = _1990_action_charges_renvoie (action)->begin ();
+    return 0.;
+  }
+  
+  return *terme;
+}
+
+
+/**
+ * \brief Inverse sur place une matrice symétrique définie positive de taille
+ *        m × m stockée colonne par colonne avec un pas de 6 (bloc d'un noeud).
+ *        Méthode de Gauss-Jordan sans permutation.
+ * \param bloc : la matrice,
+ * \param m : la taille de la matrice (6 au maximum).
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - la matrice n'est pas définie positive.
+ */
+static bool
+EF_calculs_inverse_bloc (double *bloc,
+                         uint8_t m)
+{
+  uint8_t i, j, k;
+  
+#define B(I, J) bloc[(J) * 6 + (I)]
+  for (k = 0; k < m; k++)
+  {
+    double pivot = B (k, k);
     
-    while (it3 != _1990_action_charges_renvoie (action)->end ())
+    if (!(pivot > 0.))
     {
-      Charge         *charge = *it3;
-      cholmod_sparse *s_eff_loc_i, *s_eff_glo_f;
-      cholmod_sparse *s_eff_loc_f;
+      return false;
+    }
+    B (k, k) = 1.;
+    for (j = 0; j < m; j++)
+    {
+      B (k, j) /= pivot;
+    }
+    for (i = 0; i < m; i++)
+    {
+      double f;
       
-      switch (charge->type)
+      if (i == k)
       {
-        case CHARGE_NOEUD :
+        continue;
+      }
+      f = B (i, k);
+      B (i, k) = 0.;
+      for (j = 0; j < m; j++)
+      {
+        B (i, j) -= f * B (k, j);
+      }
+    }
+  }
+#undef B
+  
+  return true;
+}
+
+
+/**
+ * \brief Construit le préconditionneur du gradient conjugué demandé par
+ *        p->calculs.precond. En cas d'échec (pivot nul ou négatif), le
+ *        préconditionneur de Jacobi est utilisé et le rapport le signale.
+ * \param p : la variable projet,
+ * \param ok : vaut false si même le préconditionneur de Jacobi est
+ *             impossible (diagonale non strictement positive), la
+ *             factorisation LU doit alors être utilisée.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+static bool
+EF_calculs_genere_precond (Projet *p,
+                           bool   *ok)
+{
+  cholmod_sparse *m = p->calculs.m_part;
+  size_t          n = m->nrow;
+  int            *ap = (int *) m->p; // NS
+  int            *ai = (int *) m->i; // NS
+  double         *ax = (double *) m->x;
+  uint32_t        i, j;
+  
+  *ok = false;
+  p->calculs.precond_utilise = p->calculs.precond;
+  
+  // Préconditionneur par blocs : un bloc par noeud regroupant ses degrés de
+  // liberté libres.
+  if (p->calculs.precond_utilise == EF_PRECOND_BLOC_JACOBI)
+  {
+    p->calculs.precond_x = new double [p->calculs.nb_noeuds * 36];
+    for (i = 0; i < p->calculs.nb_noeuds; i++)
+    {
+      double  *bloc = &p->calculs.precond_x[i * 36];
+      uint32_t ddl[6];
+      uint8_t  nb = 0, r, c;
+      
+      for (j = 0; j < 6; j++)
+      {
+        if (p->calculs.n_part[i][j] < m->nrow)
         {
-  //   Si la charge en cours est une charge au noeud Alors
-  //     On ajoute au vecteur des efforts les efforts aux noeuds directement
-  //     saisis par l'utilisateur dans le repère global.
-          Charge_Noeud *charge_d = (Charge_Noeud *) charge->data;
-          
-          std::list <EF_Noeud *>::iterator it2  = charge_d->noeuds.begin ();
-          
-          while (it2 != charge_d->noeuds.end ())
-          {
-            EF_Noeud *noeud = *it2;
-            size_t    num = std::distance (
-                              p->modele.noeuds.begin (),
-                              std::find (p->modele.noeuds.begin (), 
-                                         p->modele.noeuds.end (), 
-                                         noeud));
-            
-            if (p->calculs.n_part[num][0] != UINT32_MAX)
-            {
-              ax[p->calculs.n_part[num][0]] += m_g (charge_d->fx);
-            }
-            if (p->calculs.n_part[num][1] != UINT32_MAX)
-            {
-              ax[p->calculs.n_part[num][1]] += m_g (charge_d->fy);
-            }
-            if (p->calculs.n_part[num][2] != UINT32_MAX)
-            {
-              ax[p->calculs.n_part[num][2]] += m_g (charge_d->fz);
-            }
-            if (p->calculs.n_part[num][3] != UINT32_MAX)
-            {
-              ax[p->calculs.n_part[num][3]] += m_g (charge_d->mx);
-            }
-            if (p->calculs.n_part[num][4] != UINT32_MAX)
-            {
-              ax[p->calculs.n_part[num][4]] += m_g (charge_d->my);
-            }
-            if (p->calculs.n_part[num][5] != UINT32_MAX)
-            {
-              ax[p->calculs.n_part[num][5]] += m_g (charge_d->mz);
-            }
-            ax3[p->calculs.n_comp[num][0]] += m_g (charge_d->fx);
-            ax3[p->calculs.n_comp[num][1]] += m_g (charge_d->fy);
-            ax3[p->calculs.n_comp[num][2]] += m_g (charge_d->fz);
-            ax3[p->calculs.n_comp[num][3]] += m_g (charge_d->mx);
-            ax3[p->calculs.n_comp[num][4]] += m_g (charge_d->my);
-            ax3[p->calculs.n_comp[num][5]] += m_g (charge_d->mz);
-            
-            ++it2;
-          }
-          
-          break;
+          ddl[nb] = p->calculs.n_part[i][j];
+          nb++;
         }
-  //   Sinon Si la charge est une charge ponctuelle sur la barre Alors
-        case CHARGE_BARRE_PONCTUELLE :
+      }
+      memset (bloc, 0, sizeof (double) * 36);
+      for (c = 0; c < nb; c++)
+      {
+        for (r = 0; r < nb; r++)
         {
-          Charge_Barre_Ponctuelle *charge_d =
-                                      (Charge_Barre_Ponctuelle *) charge->data;
-          
-          double       l;
-          double       phiAy, phiBy, phiAz, phiBz; // Rotation sur appui
-                       // lorsque la barre est isostatique
-          double       MAx, MBx, MAy, MBy, MAz, MBz; // Moment opposé à la
-                       // réaction d'appui
-          EF_Noeud    *noeud_debut, *noeud_fin;
-          uint16_t     pos; // numéro de l'élément dans la discrétisation
-          
-          std::list <EF_Barre *>::iterator it2 = charge_d->barres.begin ();
-          
-          while (it2 != charge_d->barres.end ())
+          bloc[c * 6 + r] = EF_calculs_valeur (m, ddl[r], ddl[c]);
+        }
+      }
+      if (!EF_calculs_inverse_bloc (bloc, nb))
+      {
+        delete [] p->calculs.precond_x;
+        p->calculs.precond_x = NULL;
+        p->calculs.precond_utilise = EF_PRECOND_JACOBI;
+        break;
+      }
+    }
+  }
+  // Cholesky incomplet IC(0) : le facteur L conserve la structure du triangle
+  // inférieur de m_part, les termes de remplissage sont ignorés.
+  else if (p->calculs.precond_utilise == EF_PRECOND_CHOLESKY_INCOMPLET)
+  {
+    int     *pl, *il; // NS
+    double  *xl;
+    int     *pos; // NS
+    uint32_t k;
+    bool     echec = false;
+    
+    pl = new int [n + 1];
+    pl[0] = 0;
+    for (j = 0; j < n; j++)
+    {
+      int *debut = std::lower_bound (&ai[ap[j]], &ai[ap[j + 1]], (int) j); // NS
+      
+      pl[j + 1] = pl[j] + (int) (&ai[ap[j + 1]] - debut);
+    }
+    il = new int [pl[n]];
+    xl = new double [pl[n]];
+    for (j = 0; j < n; j++)
+    {
+      int *debut = std::lower_bound (&ai[ap[j]], &ai[ap[j + 1]], (int) j); // NS
+      
+      memcpy (&il[pl[j]], debut, sizeof (int) * (size_t) (pl[j + 1] - pl[j]));
+      memcpy (&xl[pl[j]],
+              &ax[debut - ai],
+              sizeof (double) * (size_t) (pl[j + 1] - pl[j]));
+    }
+    
+    // Pour chaque colonne k
+    //   L(k,k) = sqrt (A(k,k))
+    //   L(i,k) = L(i,k) / L(k,k) pour i > k
+    //   Pour chaque colonne j > k de la structure de la colonne k
+    //     L(i,j) -= L(i,k).L(j,k) pour i >= j si (i,j) est dans la structure
+    //   FinPour
+    // FinPour
+    pos = new int [n];
+    for (k = 0; k < n; k++)
+    {
+      pos[k] = -1;
+    }
+    for (k = 0; (k < n) && (!echec); k++)
+    {
+      int q, q2; // NS
+      
+      if ((pl[k] == pl[k + 1]) || (il[pl[k]] != (int) k) ||
+          (!(xl[pl[k]] > 0.)))
+      {
+        echec = true;
+        break;
+      }
+      xl[pl[k]] = sqrt (xl[pl[k]]);
+      for (q = pl[k] + 1; q < pl[k + 1]; q++)
+      {
+        xl[q] /= xl[pl[k]];
+      }
+      for (q = pl[k] + 1; q < pl[k + 1]; q++)
+      {
+        int jj = il[q]; // NS
+        
+        for (q2 = pl[jj]; q2 < pl[jj + 1]; q2++)
+        {
+          pos[il[q2]] = q2;
+        }
+        for (q2 = q; q2 < pl[k + 1]; q2++)
+        {
+          if (pos[il[q2]] != -1)
           {
-            double    a, b; // Position de la charge par rapport au début
-                      // et à la fin de l'élément discrétisé
-            double    debut_barre, fin_barre; // Début et fin de la barre
-                      // discrétisée par rapport à la barre complète
-            double    FAx, FBx; // Effort de compression au début et fin
-                      // de l'élément discrétisé
-            double    FAy_i, FAy_h, FBy_i, FBy_h; // Force opposée à la
-                      // réaction d'appui
-            double    FAz_i, FAz_h, FBz_i, FBz_h;
-            EF_Barre *element = *it2;
-            uint32_t  num;
-            uint32_t  num_d, num_f;
-          
-            num = std::distance (p->modele.barres.begin (),
-                                 std::find (p->modele.barres.begin (),
-                                            p->modele.barres.end (),
-                                            element));
-      //   Convertion des efforts globaux en efforts locaux si nécessaire :
-      //   \end{verbatim}\begin{center}
-      //   $\{ F \}_{local} = [R]^T \cdot \{ F \}_{global}$\end{center}
-      //   \begin{verbatim}
-            if (!charge_d->repere_local)
-            {
-              BUGCRIT (t_eff_glo_i = cholmod_allocate_triplet (12,
-                                                               1,
-                                                               12,
-                                                               0,
-                                                               CHOLMOD_REAL,
-                                                               p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_triplet (&t_for_part, p->calculs.c);
-                         cholmod_free_triplet (&t_for_comp, p->calculs.c); )
-              ai2 = (uint32_t *) t_eff_glo_i->i;
-              aj2 = (uint32_t *) t_eff_glo_i->j;
-              ax2 = (double *) t_eff_glo_i->x;
-              t_eff_glo_i->nnz = 12;
-            }
-            else
-            {
-              BUGCRIT (t_eff_loc_i = cholmod_allocate_triplet (12,
-                                                               1,
-                                                               12,
-                                                               0,
-                                                               CHOLMOD_REAL,
-                                                               p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_triplet (&t_for_part, p->calculs.c);
-                         cholmod_free_triplet (&t_for_comp, p->calculs.c); )
-              ai2 = (uint32_t *) t_eff_loc_i->i;
-              aj2 = (uint32_t *) t_eff_loc_i->j;
-              ax2 = (double *) t_eff_loc_i->x;
-              t_eff_loc_i->nnz = 12;
-            }
-            ai2[0] = 0;   aj2[0] = 0;  ax2[0] = m_g (charge_d->fx);
-            ai2[1] = 1;   aj2[1] = 0;  ax2[1] = m_g (charge_d->fy);
-            ai2[2] = 2;   aj2[2] = 0;  ax2[2] = m_g (charge_d->fz);
-            ai2[3] = 3;   aj2[3] = 0;  ax2[3] = m_g (charge_d->mx);
-            ai2[4] = 4;   aj2[4] = 0;  ax2[4] = m_g (charge_d->my);
-            ai2[5] = 5;   aj2[5] = 0;  ax2[5] = m_g (charge_d->mz);
-            ai2[6] = 6;   aj2[6] = 0;  ax2[6] = 0.;
-            ai2[7] = 7;   aj2[7] = 0;  ax2[7] = 0.;
-            ai2[8] = 8;   aj2[8] = 0;  ax2[8] = 0.;
-            ai2[9] = 9;   aj2[9] = 0;  ax2[9] = 0.;
-            ai2[10] = 10; aj2[10] = 0; ax2[10] = 0.;
-            ai2[11] = 11; aj2[11] = 0; ax2[11] = 0.;
-            if (!charge_d->repere_local)
-            {
-              cholmod_sparse *s_eff_glo_i;
-              
-              BUGCRIT (s_eff_glo_i = cholmod_triplet_to_sparse (t_eff_glo_i,
-                                                                0,
-                                                                p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_triplet (&t_for_part, p->calculs.c);
-                         cholmod_free_triplet (&t_for_comp, p->calculs.c);
-                         cholmod_free_triplet (&t_eff_glo_i, p->calculs.c); )
-              cholmod_free_triplet (&t_eff_glo_i, p->calculs.c);
-              BUGCRIT (s_eff_loc_i = cholmod_ssmult (element->m_rot_t,
-                                                     s_eff_glo_i,
-                                                     0,
-                                                     1,
-                                                     0,
-                                                     p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_triplet (&t_for_part, p->calculs.c);
-                         cholmod_free_triplet (&t_for_comp, p->calculs.c);
-                         cholmod_free_sparse (&s_eff_glo_i, p->calculs.c); )
-              cholmod_free_sparse (&s_eff_glo_i, p->calculs.c);
-              BUGCRIT (t_eff_loc_i = cholmod_sparse_to_triplet (s_eff_loc_i,
-                                                                p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_triplet (&t_for_part, p->calculs.c);
-                         cholmod_free_triplet (&t_for_comp, p->calculs.c);
-                         cholmod_free_sparse (&s_eff_loc_i, p->calculs.c); )
-              cholmod_free_sparse (&s_eff_loc_i, p->calculs.c);
-              ax2 = (double *) t_eff_loc_i->x;
-            }
-            // A ce stade ax2 pointent vers les charges dans le repère local
-            
-#define FREE_ALL cholmod_free_triplet (&t_for_part, p->calculs.c); \
-  cholmod_free_triplet (&t_for_comp, p->calculs.c); \
-  cholmod_free_triplet (&t_eff_loc_i, p->calculs.c);
-           
-      //   Détermination des deux noeuds se situant directement avant et
-      //   après la charge ponctuelle (est différent des deux noeuds
-      //   définissant la barre si elle est discrétisée).
-            if (element->nds_inter.size () == 0)
-            /* Pas de discrétisation */
-            {
-              pos = 0;
-              noeud_debut = element->noeud_debut;
-              noeud_fin = element->noeud_fin;
-            }
-            else
-            // On cherche le noeud de départ et le noeud de fin
-            {
-              pos = 0;
-              l = -1.;
-              // On regarde pour chaque noeud intermédiaire si la position de
-              // la charge devient inférieure à la distance entre le noeud de
-              // départ et le noeud intermédiaire.
-              while ((pos <= element->nds_inter.size ()) &&
-                     (l < m_g (charge_d->position)))
-              {
-                if (pos == element->nds_inter.size ())
-                {
-                  l = EF_noeuds_distance (element->noeud_fin,
-                                          element->noeud_debut);
-                }
-                else
-                {
-                  std::list <EF_Noeud *>::iterator it_t;
-                  
-                  it_t = element->nds_inter.begin ();
-                  std::advance (it_t, pos);
-                  l = EF_noeuds_distance (*it_t, element->noeud_debut);
-                }
-                BUG (!std::isnan (l), false, FREE_ALL)
-                pos++;
-              }
-              pos--;
-              // Alors la position de la charge est compris entre le début du
-              // noeud et le premier noeud intermédiaire.
-              if (pos == 0)
-              {
-                noeud_debut = element->noeud_debut;
-                noeud_fin = *element->nds_inter.begin ();
-              }
-              // Alors la position de la charge est compris entre le dernier
-              // noeud intermédiaire et le noeud de fin de la barre
-              else if (pos == element->nds_inter.size ())
-              {
-                std::list <EF_Noeud *>::iterator it_t;
-                
-                it_t = element->nds_inter.begin ();
-                std::advance (it_t, pos - 1U);
-                noeud_debut = *it_t;
-                noeud_fin = element->noeud_fin;
-              }
-              else
-              {
-                std::list <EF_Noeud *>::iterator it_t;
-                
-                it_t = element->nds_inter.begin ();
-                std::advance (it_t, pos - 1U);
-                noeud_debut = *it_t;
-                std::next (it_t);
-                noeud_fin = *it_t;
-              }
-            }
-            num_d = std::distance (p->modele.noeuds.begin (),
-                                   std::find (p->modele.noeuds.begin (), 
-                                              p->modele.noeuds.end (), 
-                                              noeud_debut));
-            num_f = std::distance (p->modele.noeuds.begin (), 
-                                   std::find (p->modele.noeuds.begin (),
-                                              p->modele.noeuds.end (),     
-                                              noeud_fin));
-            debut_barre = EF_noeuds_distance (noeud_debut,
-                                              element->noeud_debut);
-            BUG (!std::isnan (debut_barre), false, FREE_ALL)
-            a = m_g (charge_d->position) - debut_barre;
-            fin_barre = EF_noeuds_distance (noeud_fin, element->noeud_debut);
-            BUG (!std::isnan (fin_barre), false, FREE_ALL)
-            l = fabs (fin_barre - debut_barre);
-            b = l - a;
-            
-      //   Détermination des moments mx de rotation :
-            BUG (EF_charge_barre_ponctuelle_mx (element,
-                                                pos,
-                                                a,
-                                                &(element->info_EF[pos]),
-                                                ax2[3],
-                                                &MAx,
-                                                &MBx),
-                 false,
-                 FREE_ALL)
-            
-      //   Détermination de la rotation y et z aux noeuds de l'élément
-      //   discrétisé en le supposant isostatique :
-            BUG (EF_charge_barre_ponctuelle_def_ang_iso_y (element,
-                                                           pos,
-                                                           a,
-                                                           ax2[2],
-                                                           ax2[4],
-                                                           &phiAy,
-                                                           &phiBy),
-                 false,
-                 FREE_ALL)
-            BUG (EF_charge_barre_ponctuelle_def_ang_iso_z (element,
-                                                           pos,
-                                                           a,
-                                                           ax2[1],
-                                                           ax2[5],
-                                                           &phiAz,
-                                                           &phiBz),
-                 false,
-                 FREE_ALL)
-            
-      //   Calcul des moments créés par les raideurs :
-            BUG (EF_calculs_moment_hyper_y (&(element->info_EF[pos]),
-                                            phiAy,
-                                            phiBy,
-                                            &MAy,
-                                            &MBy),
-                 false,
-                 FREE_ALL)
-            BUG (EF_calculs_moment_hyper_z (&(element->info_EF[pos]),
-                                            phiAz,
-                                            phiBz,
-                                            &MAz,
-                                            &MBz),
-                 false,
-                 FREE_ALL)
-            
-      //   Réaction d'appui sur les noeuds :\end{verbatim}\begin{align*}
-            // F_{Ax} & = F_x \cdot \frac{\int_a^l \frac{1}{E \cdot S(x)}}
-            //            {\int_0^l \frac{1}{E \cdot S(x)}}\nonumber\\
-            // F_{Bx} & = F_x - F_{Ax}\nonumber\\
-            // F_{Ay_i}   & = \frac{F_y \cdot b}{l}-\frac{M_z}{l}\nonumber\\
-            // F_{Ay_h} & = \frac{M_{Bz}+M_{Az}}{l}\nonumber\\
-            // F_{By_i}   & = \frac{F_y \cdot a}{l}+\frac{M_z}{l}\nonumber\\
-            // F_{By_h} & = -\frac{M_{Bz}+M_{Az}}{l}\nonumber\\
-            // F_{Az_i}   & = \frac{F_z \cdot b}{l}+\frac{M_y}{l}\nonumber\\
-            // F_{Az_h} & = -\frac{M_{By}+M_{Ay}}{l}\nonumber\\
-            // F_{Bz_i}   & = \frac{F_z \cdot a}{l}-\frac{M_y}{l}\nonumber\\
-            // F_{Bz_h} & = \frac{M_{By}+M_{Ay}}{l}\end{align*}
-            // \begin{verbatim}
-            FAx = ax2[0] * EF_sections_es_l (element, pos, 0, l) /
-                    EF_sections_es_l (element, pos, a, l);
-            BUG (!std::isnan (FAx), false, FREE_ALL)
-            FBx = ax2[0] - FAx;
-            FAy_i = ax2[1] * b / l - ax2[5] / l;
-            FAy_h = (MBz + MAz) / l;
-            FBy_i = ax2[1] * a / l + ax2[5] / l;
-            FBy_h = -(MBz + MAz) / l;
-            FAz_i = ax2[2] * b / l + ax2[4] / l;
-            FAz_h = -(MBy + MAy) / l;
-            FBz_i = ax2[2] * a / l - ax2[4] / l;
-            FBz_h = (MBy + MAy) / l;
-            
-      //   Détermination des fonctions des efforts dus à la charge (x, a et
-      //   l sont calculés par rapport à l'élément discrétisé et non pour
-      //   toute la barre). Pour cela on calcule la sollicitation due au cas
-      //   isostatique puis on ajoute la sollicitation due à l'éventuel
-      //   encastrement (MAx, MBx, MAy, MAz, MBy, MBz) :\end{verbatim}
-      //   \begin{align*}
-            // N(x) & = -F_{Ax} & &\textrm{ pour x de 0 à a}\nonumber\\
-            // N(x) & = F_{Bx} & &\textrm{ pour x de a à l}\nonumber\\
-            
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 0, num),
-                   0.,
-                   a,
-                   -FAx,
-                   0., 0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 0, num),
-                   a,
-                   l,
-                   FBx,
-                   0., 0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            
-            // T_y(x) & = -F_{Ay_i} - F_{Ay_h} & &\textrm{ pour x de 0 à a}
-            // \nonumber\\
-            // T_y(x) & =  F_{By_i} + F_{By_h} & &\textrm{ pour x de a à l}
-            // \nonumber\\
-            
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 1, num),
-                   0.,
-                   a,
-                   -FAy_i - FAy_h,
-                   0., 0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 1, num),
-                   a,
-                   l,
-                   FBy_i + FBy_h,
-                   0., 0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            
-            // T_z(x) & = -F_{Az_i} - F_{Az_h} & &\textrm{ pour x de 0 à a}
-            // \nonumber\\
-            // T_z(x) & =  F_{Bz_i} + F_{Bz_h} & &\textrm{ pour x de a à l}
-            // \nonumber\\
-            
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 2, num),
-                   0.,
-                   a,
-                   -FAz_i - FAz_h,
-                   0., 0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 2, num),
-                   a,
-                   l,
-                   FBz_i + FBz_h,
-                   0., 0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            
-            // M_x(x) & = -M_{Ax} & &\textrm{ pour x de 0 à a}\nonumber\\
-            // M_x(x) & = M_{Bx} & &\textrm{ pour x de a à l}\nonumber\\
-            
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 3, num),
-                   0.,
-                   a,
-                   -MAx,
-                   0., 0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 3, num),
-                   a,
-                   l,
-                   MBx,
-                   0., 0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            
-            // M_y(x) & = -M_{Ay} - (F_{Az_i}+F_{Az_h}) \cdot x & 
-            //            &\textrm{ pour x de 0 à a}\nonumber\\
-            // M_y(x) & = F_{Bz_i} \cdot L - M_{Ay} + (F_{Bz_i} + F_{Bz_h})
-            //            \cdot x & &\textrm{ pour x de a à l}\nonumber\\
-            
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 4, num),
-                   0.,
-                   a,
-                   -MAy,
-                   -FAz_i - FAz_h,
-                   0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 4, num),
-                   a,
-                   l,
-                   -FBz_i * l - MAy,
-                   FBz_i + FBz_h,
-                   0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            
-            // M_z(x) & = -M_{Az} + (F_{Ay_i}+F_{Ay_h}) \cdot x &
-            //            &\textrm{ pour x de 0 à a}\nonumber\\
-            // M_z(x) & = F_{By_i} \cdot L - M_{Az} - (F_{By_i} + F_{By_h})
-            //            \cdot x & &\textrm{ pour x de a à l}
-            
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 5, num),
-                   0.,
-                   a,
-                   -MAz,
-                   FAy_i + FAy_h,
-                   0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_efforts_renvoie (action, 5, num),
-                   a,
-                   l,
-                   FBy_i * l - MAz,
-                   -FBy_i - FBy_h,
-                   0., 0., 0., 0., 0.,
-                   debut_barre),
-                 false,
-                 FREE_ALL)
-            // \end{align*}\begin{verbatim}
-            
-            
-      //   Détermination des fonctions de déformation et rotation (cas
-      //   isostatique + encastrement) :
-      //   \begin{align*}
-            BUG (EF_charge_barre_ponctuelle_fonc_rx (
-                   _1990_action_rotation_renvoie (action, 0, num),
-                   element,
-                   pos,
-                   a,
-                   MAx,
-                   MBx),
-                 false,
-                 FREE_ALL)
-            BUG (EF_charge_barre_ponctuelle_fonc_ry (
-                   _1990_action_rotation_renvoie (action, 1, num),
-                   _1990_action_deformation_renvoie (action, 2, num),
-                   element,
-                   pos,
-                   a,
-                   ax2[2],
-                   ax2[4],
-                   -MAy,
-                   -MBy),
-                 false,
-                 FREE_ALL)
-            BUG (EF_charge_barre_ponctuelle_fonc_rz (
-                   _1990_action_rotation_renvoie (action, 2, num),
-                   _1990_action_deformation_renvoie (action, 1, num),
-                   element,
-                   pos,
-                   a,
-                   ax2[1],
-                   ax2[5],
-                   -MAz,
-                   -MBz),
-                 false,
-                 FREE_ALL)
-            BUG (EF_charge_barre_ponctuelle_n (
-                   _1990_action_deformation_renvoie (action, 0, num),
-                   element,
-                   pos,
-                   a,
-                   FAx,
-                   FBx),
-                 false,
-                 FREE_ALL)
-            
-            cholmod_free_triplet (&t_eff_loc_i, p->calculs.c);
-            
-#undef FREE_ALL
-            
-      //   Convertion des réactions d'appuis locales dans le repère global :
-      //   \end{verbatim}\begin{center}
-      //     $\{ R \}_{global} = [K] \cdot \{ F \}_{local}$\end{center}
-      //     \begin{verbatim}
-            BUGCRIT (t_eff_loc_f = cholmod_allocate_triplet (12,
-                                                             1,
-                                                             12,
-                                                             0,
-                                                             CHOLMOD_REAL,
-                                                             p->calculs.c),
-                     false,
-                     (gettext ("Erreur d'allocation mémoire.\n"));
-                       cholmod_free_triplet (&t_for_part, p->calculs.c);
-                       cholmod_free_triplet (&t_for_comp, p->calculs.c); )
-            ai2 = (uint32_t *) t_eff_loc_f->i;
-            aj2 = (uint32_t *) t_eff_loc_f->j;
-            ax2 = (double *) t_eff_loc_f->x;
-            t_eff_loc_f->nnz = 12;
-            ai2[0] = 0;   aj2[0] = 0;  ax2[0] = FAx;
-            ai2[1] = 1;   aj2[1] = 0;  ax2[1] = FAy_i + FAy_h;
-            ai2[2] = 2;   aj2[2] = 0;  ax2[2] = FAz_i + FAz_h;
-            ai2[3] = 3;   aj2[3] = 0;  ax2[3] = MAx;
-            ai2[4] = 4;   aj2[4] = 0;  ax2[4] = MAy;
-            ai2[5] = 5;   aj2[5] = 0;  ax2[5] = MAz;
-            ai2[6] = 6;   aj2[6] = 0;  ax2[6] = FBx;
-            ai2[7] = 7;   aj2[7] = 0;  ax2[7] = FBy_i + FBy_h;
-            ai2[8] = 8;   aj2[8] = 0;  ax2[8] = FBz_i + FBz_h;
-            ai2[9] = 9;   aj2[9] = 0;  ax2[9] = MBx;
-            ai2[10] = 10; aj2[10] = 0; ax2[10] = MBy;
-            ai2[11] = 11; aj2[11] = 0; ax2[11] = MBz;
-            BUGCRIT (s_eff_loc_f = cholmod_triplet_to_sparse (t_eff_loc_f,
-                                                              0,
-                                                              p->calculs.c),
-                     false,
-                     (gettext ("Erreur d'allocation mémoire.\n"));
-                       cholmod_free_triplet (&t_for_part, p->calculs.c);
-                       cholmod_free_triplet (&t_for_comp, p->calculs.c);
-                       cholmod_free_triplet (&t_eff_loc_f, p->calculs.c); )
-            cholmod_free_triplet (&t_eff_loc_f, p->calculs.c);
-            BUGCRIT (s_eff_glo_f = cholmod_ssmult (element->m_rot,
-                                                   s_eff_loc_f,
-                                                   0,
-                                                   1,
-                                                   0,
-                                                   p->calculs.c),
-                     false,
-                     (gettext ("Erreur d'allocation mémoire.\n"));
-                       cholmod_free_triplet (&t_for_part, p->calculs.c);
-                       cholmod_free_triplet (&t_for_comp, p->calculs.c);
-                       cholmod_free_sparse (&s_eff_loc_f, p->calculs.c); )
-            cholmod_free_sparse (&s_eff_loc_f, p->calculs.c);
-            BUGCRIT (t_eff_glo_f = cholmod_sparse_to_triplet (s_eff_glo_f,
-                                                              p->calculs.c),
-                     false,
-                     (gettext ("Erreur d'allocation mémoire.\n"));
-                       cholmod_free_triplet (&t_for_part, p->calculs.c);
-                       cholmod_free_triplet (&t_for_comp, p->calculs.c);
-                       cholmod_free_sparse (&(s_eff_glo_f), p->calculs.c); )
-            cholmod_free_sparse (&(s_eff_glo_f), p->calculs.c);
-            ai2 = (uint32_t *) t_eff_glo_f->i;
-            ax2 = (double *) t_eff_glo_f->x;
-            
-      //   Ajout des moments et les efforts dans le vecteur des forces aux
-      //   noeuds {F}
-            for (i = 0; i < 12; i++)
-            {
-              if (ai2[i] < 6)
-              {
-                if (p->calculs.n_part[num_d][ai2[i]] != UINT32_MAX)
-                {
-                  ax[p->calculs.n_part[num_d][ai2[i]]] += ax2[i];
-                }
-                ax3[p->calculs.n_comp[num_d][ai2[i]]] += ax2[i];
-              }
-              else
-              {
-                if (p->calculs.n_part[num_f][ai2[i] - 6] != UINT32_MAX)
-                {
-                  ax[p->calculs.n_part[num_f][ai2[i] - 6]] += ax2[i];
-                }
-                ax3[p->calculs.n_comp[num_f][ai2[i] - 6]] += ax2[i];
-              }
-            }
-            cholmod_free_triplet (&t_eff_glo_f, p->calculs.c);
-            
-            ++it2;
+            xl[pos[il[q2]]] -= xl[q2] * xl[q];
           }
-          
-          break;
         }
-  //   Sinon Si la charge est une charge répartie uniforme sur la barre Alors
-        case CHARGE_BARRE_REPARTIE_UNIFORME :
+        for (q2 = pl[jj]; q2 < pl[jj + 1]; q2++)
         {
-          double   xx, yy, zz, l;
-          uint16_t j_d, j_f; // Numéro de l'élément dans la discrétisation
-          
-          Charge_Barre_Repartie_Uniforme *charge_d =
-                               (Charge_Barre_Repartie_Uniforme *) charge->data;
-          std::list <EF_Barre *>::iterator it2 = charge_d->barres.begin ();
-          
-          while (it2 != charge_d->barres.end ())
-          {
-            double    ll;
-            EF_Barre *element = *it2;
-            uint16_t pos;
-            
-            uint32_t num = std::distance (
-                             p->modele.barres.begin (),
-                             std::find (p->modele.barres.begin (), 
-                                        p->modele.barres.end (), 
-                                        element));
-            
-      //   Convertion des efforts globaux en efforts locaux si nécessaire :
-      //   \end{verbatim}\begin{center}
-      //     $\{ F \}_{local} = [R_e]^T \cdot \{ F \}_{global}$\end{center}
-      //   \begin{verbatim}
-            ll = EF_noeuds_distance_x_y_z (element->noeud_debut,
-                                           element->noeud_fin,
-                                           &xx,
-                                           &yy,
-                                           &zz);
-            BUG (!std::isnan (ll),
-                 false,
-                 cholmod_free_triplet (&t_for_part, p->calculs.c);
-                   cholmod_free_triplet (&t_for_comp, p->calculs.c); )
-            if (!charge_d->repere_local)
-            {
-              BUGCRIT (t_eff_glo_i = cholmod_allocate_triplet (12,
-                                                               1,
-                                                               12,
-                                                               0,
-                                                               CHOLMOD_REAL,
-                                                               p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_triplet (&t_for_part, p->calculs.c);
-                         cholmod_free_triplet (&t_for_comp, p->calculs.c); )
-              ai2 = (uint32_t *) t_eff_glo_i->i;
-              aj2 = (uint32_t *) t_eff_glo_i->j;
-              ax2 = (double *) t_eff_glo_i->x;
-              t_eff_glo_i->nnz = 12;
-            }
-            else
-            {
-              BUGCRIT (t_eff_loc_i = cholmod_allocate_triplet (12,
-                                                               1,
-                                                               12,
-                                                               0,
-                                                               CHOLMOD_REAL,
-                                                               p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n")); )
-              ai2 = (uint32_t *) t_eff_loc_i->i;
-              aj2 = (uint32_t *) t_eff_loc_i->j;
-              ax2 = (double *) t_eff_loc_i->x;
-              t_eff_loc_i->nnz = 12;
-            }
-            if (charge_d->projection)
-            {
-              ai2[0] = 0; aj2[0] = 0;
-              ax2[0] = m_g (charge_d->fx) * sqrt (yy * yy + zz * zz) / ll;
-              ai2[1] = 1; aj2[1] = 0;
-              ax2[1] = m_g (charge_d->fy) * sqrt (xx * xx + zz * zz) / ll;
-              ai2[2] = 2; aj2[2] = 0;
-              ax2[2] = m_g (charge_d->fz) * sqrt (xx * xx + yy * yy) / ll;
-              ai2[3] = 3; aj2[3] = 0;
-              ax2[3] = m_g (charge_d->mx) * sqrt (yy * yy + zz * zz) / ll;
-              ai2[4] = 4; aj2[4] = 0;
-              ax2[4] = m_g (charge_d->my) * sqrt (xx * xx + zz * zz) / ll;
-              ai2[5] = 5; aj2[5] = 0;
-              ax2[5] = m_g (charge_d->mz) * sqrt (xx * xx + yy * yy) / ll;
-            }
-            else
-            {
-              ai2[0] = 0; aj2[0] = 0; ax2[0] = m_g (charge_d->fx);
-              ai2[1] = 1; aj2[1] = 0; ax2[1] = m_g (charge_d->fy);
-              ai2[2] = 2; aj2[2] = 0; ax2[2] = m_g (charge_d->fz);
-              ai2[3] = 3; aj2[3] = 0; ax2[3] = m_g (charge_d->mx);
-              ai2[4] = 4; aj2[4] = 0; ax2[4] = m_g (charge_d->my);
-              ai2[5] = 5; aj2[5] = 0; ax2[5] = m_g (charge_d->mz);
-            }
-            ai2[6]  = 6;  aj2[6]  = 0; ax2[6]  = 0.;
-            ai2[7]  = 7;  aj2[7]  = 0; ax2[7]  = 0.;
-            ai2[8]  = 8;  aj2[8]  = 0; ax2[8]  = 0.;
-            ai2[9]  = 9;  aj2[9]  = 0; ax2[9]  = 0.;
-            ai2[10] = 10; aj2[10] = 0; ax2[10] = 0.;
-            ai2[11] = 11; aj2[11] = 0; ax2[11] = 0.;
-            if (!charge_d->repere_local)
-            {
-              cholmod_sparse *s_eff_glo_i;
-              
-              BUGCRIT (s_eff_glo_i = cholmod_triplet_to_sparse (t_eff_glo_i,
-                                                                0,
-                                                                p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_triplet (&t_for_part, p->calculs.c);
-                         cholmod_free_triplet (&t_for_comp, p->calculs.c);
-                         cholmod_free_triplet (&t_eff_glo_i, p->calculs.c); )
-              cholmod_free_triplet (&t_eff_glo_i, p->calculs.c);
-              BUGCRIT (s_eff_loc_i = cholmod_ssmult (element->m_rot_t,
-                                                     s_eff_glo_i,
-                                                     0,
-                                                     1,
-                                                     0,
-                                                     p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_triplet (&t_for_part, p->calculs.c);
-                         cholmod_free_triplet (&t_for_comp, p->calculs.c);
-                         cholmod_free_sparse (&s_eff_glo_i, p->calculs.c); )
-              cholmod_free_sparse (&(s_eff_glo_i), p->calculs.c);
-              BUGCRIT (t_eff_loc_i = cholmod_sparse_to_triplet (s_eff_loc_i,
-                                                                p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_triplet (&t_for_part, p->calculs.c);
-                         cholmod_free_triplet (&t_for_comp, p->calculs.c);
-                         cholmod_free_sparse (&s_eff_loc_i, p->calculs.c); )
-              cholmod_free_sparse (&(s_eff_loc_i), p->calculs.c);
-              ax2 = (double *) t_eff_loc_i->x;
-            }
-            // A ce stade ax2 pointent vers les charges dans le repère local
-            
-#define FREE_ALL cholmod_free_triplet (&t_for_part, p->calculs.c); \
-  cholmod_free_triplet (&t_for_comp, p->calculs.c); \
-  cholmod_free_triplet (&t_eff_loc_i, p->calculs.c);
-      
-      //   Détermination des deux barres discrétisées (j_d et j_f) qui
-      //   entoure la charge répartie.
-            if (element->nds_inter.size () == 0)
-            // Pas de discrétisation
-            {
-              j_d = 0;
-              j_f = 0;
-            }
-            else
-            // On cherche le noeud de départ et le noeud de fin
-            {
-              j_d = 0;
-              l = -1.;
-              // On regarde pour chaque noeud intermédiaire si la position de
+          pos[il[q2]] = -1;
+        }
+      }
+    }
+    delete [] pos;
+    
+    if (echec)
+    {
+      delete [] pl;
+      delete [] il;
+      delete [] xl;
+      p->calculs.precond_utilise = EF_PRECOND_JACOBI;
+    }
+    else
+    {
+      p->calculs.precond_p = pl;
+      p->calculs.precond_i = il;
+      p->calculs.precond_x = xl;
+    }
+  }
+  
+  if (p->calculs.precond_utilise != p->calculs.precond)
+  {
+    EF_calculs_rapport_ajout (p,
+                              gettext ("Préconditionneur du gradient conjugué"),
+                              1,
+                              gettext ("Pivot non strictement positif, le préconditionneur de Jacobi est utilisé."));
+  }
+  
+  // Préconditionneur de Jacobi.
+  if (p->calculs.precond_utilise == EF_PRECOND_JACOBI)
+  {
+    p->calculs.precond_x = new double [n];
+    for (j = 0; j < n; j++)
+    {
+      double diag = EF_calculs_valeur (m, j, j);
+      
+      if (!(diag > 0.))
+      {
+        delete [] p->calculs.precond_x;
+        p->calculs.precond_x = NULL;
+        EF_calculs_rapport_ajout (p,
+                                  gettext ("Préconditionneur du gradient conjugué"),
+                                  1,
+                                  gettext ("Diagonale non strictement positive, la factorisation LU est utilisée."));
+        
+        return true;
+      }
+      p->calculs.precond_x[j] = 1. / diag;
+    }
+  }
+  
+  *ok = true;
+  
+  return true;
+}
+
+
+/**
+ * \brief Factorisation de Cholesky en simple précision de la matrice de
+ *        rigidité partielle pour le solveur EF_SOLVEUR_PRECISION_MIXTE. La
+ *        renumérotation et la structure du facteur sont celles de l'analyse
+ *        symbolique p->calculs.symbolique_chol, partagée avec
+ *        #EF_calculs_genere_mat_rig_cholesky. Le facteur [L] est calculé
+ *        colonne par colonne (méthode gauche) directement en simple
+ *        précision, les combinaisons de chaque colonne étant cumulées en
+ *        double précision. Aucun facteur en double précision n'est construit.
+ * \param p : la variable projet,
+ * \param ok : vaut false si la matrice n'est pas définie positive, la
+ *             factorisation LU doit alors être utilisée.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+static bool
+EF_calculs_genere_mixte (Projet *p,
+                         bool   *ok)
+{
+  cholmod_sparse *m_sym;
+  cholmod_factor *symbolique;
+  size_t          n = p->calculs.m_part->nrow;
+  int            *ap = (int *) p->calculs.m_part->p; // NS
+  int            *ai = (int *) p->calculs.m_part->i; // NS
+  double         *ax = (double *) p->calculs.m_part->x;
+  int            *super, *pi, *ls, *fperm; // NS
+  size_t         *pos;
+  uint32_t       *ligne;
+  float          *l;
+  int            *perm; // NS
+  std::vector <uint32_t> pinv (n), liste (n, UINT32_MAX), chaine (n);
+  std::vector <size_t>   suivant (n);
+  std::vector <double>   x (n, 0.);
+  uint32_t        bande;
+  size_t          s, j, q;
+  
+  *ok = false;
+  
+  bande = EF_calculs_largeur_bande (p->calculs.m_part, NULL);
+  
+  // Le triangle supérieur n'est nécessaire que pour l'analyse symbolique, si
+  // elle n'a pas encore été faite pour cette topologie.
+  if (p->calculs.symbolique_chol == NULL)
+  {
+    BUGCRIT (m_sym = cholmod_copy (p->calculs.m_part, 1, 1, p->calculs.c),
+             false,
+             (gettext ("Erreur d'allocation mémoire.\n")); )
+    BUG (EF_calculs_symbolique_cholesky (p, m_sym),
+         false,
+         cholmod_free_sparse (&m_sym, p->calculs.c); )
+    cholmod_free_sparse (&m_sym, p->calculs.c);
+  }
+  symbolique = p->calculs.symbolique_chol;
+  super = (int *) symbolique->super;
+  pi = (int *) symbolique->pi;
+  ls = (int *) symbolique->s;
+  fperm = (int *) symbolique->Perm;
+  
+  // Structure de chaque colonne de [L] : les lignes de son supernoeud à
+  // partir de la diagonale, triées. Le terme diagonal est le premier de
+  // chaque colonne.
+  pos = new size_t [n + 1];
+  pos[0] = 0;
+  for (s = 0; s < symbolique->nsuper; s++)
+  {
+    for (j = (size_t) super[s]; j < (size_t) super[s + 1]; j++)
+    {
+      pos[j + 1] = pos[j] + (size_t) (pi[s + 1] - pi[s]) -
+                   (j - (size_t) super[s]);
+    }
+  }
+  ligne = new uint32_t [pos[n]];
+  l = new float [pos[n]];
+  perm = new int [n];
+  for (s = 0; s < symbolique->nsuper; s++)
+  {
+    for (j = (size_t) super[s]; j < (size_t) super[s + 1]; j++)
+    {
+      for (q = pos[j]; q < pos[j + 1]; q++)
+      {
+        ligne[q] = (uint32_t) ls[(size_t) pi[s] + (j - (size_t) super[s]) +
+                                 (q - pos[j])];
+      }
+      std::sort (ligne + pos[j], ligne + pos[j + 1]);
+    }
+  }
+  for (j = 0; j < n; j++)
+  {
+    perm[j] = fperm[j];
+    pinv[(size_t) fperm[j]] = (uint32_t) j;
+  }
+  
+  // Pour chaque colonne j
+  //   x = triangle inférieur de la colonne j de [A] renumérotée.
+  //   Pour chaque colonne k < j dont le terme L(j, k) est non nul
+  //     x = x - L(j:n, k) L(j, k).
+  //   FinPour
+  //   L(j, j) = sqrt (x(j)), L(j+1:n, j) = x(j+1:n) / L(j, j).
+  // FinPour
+  // Les colonnes k sont chaînées dans liste (tête) et chaine (suite) selon
+  // la ligne de leur prochain terme, situé en suivant[k].
+  for (j = 0; j < n; j++)
+  {
+    uint32_t k;
+    double   diag;
+    int      r; // NS
+    
+    for (r = ap[fperm[j]]; r < ap[fperm[j] + 1]; r++)
+    {
+      if (pinv[(size_t) ai[r]] >= j)
+      {
+        x[pinv[(size_t) ai[r]]] += ax[r];
+      }
+    }
+    
+    k = liste[j];
+    while (k != UINT32_MAX)
+    {
+      uint32_t k_suivant = chaine[k];
+      double   ljk = (double) l[suivant[k]];
+      
+      for (q = suivant[k]; q < pos[k + 1]; q++)
+      {
+        x[ligne[q]] -= (double) l[q] * ljk;
+      }
+      suivant[k]++;
+      if (suivant[k] < pos[k + 1])
+      {
+        chaine[k] = liste[ligne[suivant[k]]];
+        liste[ligne[suivant[k]]] = k;
+      }
+      k = k_suivant;
+    }
+    
+    // Matrice non définie positive (mécanisme) : on laisse la main à la
+    // factorisation LU.
+    diag = x[j];
+    if (!(diag > 0.))
+    {
+      delete [] pos;
+      delete [] ligne;
+      delete [] l;
+      delete [] perm;
+      
+      EF_calculs_rapport_ajout (p,
+                                gettext ("Factorisation en simple précision"),
+                                1,
+                                gettext ("Matrice non définie positive, la factorisation LU est utilisée."));
+      
+      return true;
+    }
+    diag = sqrt (diag);
+    l[pos[j]] = (float) diag;
+    x[j] = 0.;
+    for (q = pos[j] + 1; q < pos[j + 1]; q++)
+    {
+      l[q] = (float) (x[ligne[q]] / diag);
+      x[ligne[q]] = 0.;
+    }
+    if (pos[j] + 1 < pos[j + 1])
+    {
+      suivant[j] = pos[j] + 1;
+      chaine[j] = liste[ligne[pos[j] + 1]];
+      liste[ligne[pos[j] + 1]] = (uint32_t) j;
+    }
+  }
+  
+  p->calculs.mixte_x = l;
+  p->calculs.mixte_pos = pos;
+  p->calculs.mixte_ligne = ligne;
+  p->calculs.mixte_perm = perm;
+  
+  // Mémoire : le facteur en simple précision et son tableau de travail.
+  EF_calculs_rapport_factorisation (
+    p,
+    gettext ("de Cholesky en simple précision"),
+    bande,
+    EF_calculs_largeur_bande (p->calculs.m_part, perm),
+    (double) pos[n],
+    EF_calculs_cholesky_operations (symbolique),
+    (double) (pos[n] * (sizeof (float) + sizeof (uint32_t)) +
+              (n + 1) * sizeof (size_t) +
+              n * (sizeof (int) + 3 * sizeof (uint32_t) + sizeof (size_t) +
+                   sizeof (double))));
+  
+  *ok = true;
+  
+  return true;
+}
+
+
+/**
+ * \brief Factorisation de la matrice de rigidité. La factorisation de
+ *        Cholesky est utilisée si p->calculs.solveur le demande et si la
+ *        matrice est définie positive, la factorisation LU sinon. Avec le
+ *        solveur EF_SOLVEUR_GRADIENT_CONJUGUE, seul le préconditionneur est
+ *        construit.
+ * \param p : la variable projet.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - p->calculs.m_part == NULL,
+ *     - p->calculs.reac_p == NULL,
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+bool
+EF_calculs_genere_mat_rig (Projet *p)
+{
+  void     *symbolic;
+  int       status; // NS
+  uint64_t  cle;
+  size_t    nnz;
+  double    control[UMFPACK_CONTROL], info[UMFPACK_INFO];
+  uint32_t  bande, bande_perm;
+  
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (p->calculs.m_part, "%p", p->calculs.m_part, false)
+  BUGPARAM (p->calculs.reac_p, "%p", p->calculs.reac_p, false)
+  
+  // Si la matrice de rigidité partielle est vide, cela signifie que tous les
+  // noeuds sont bloqués (cas d'une poutre sur deux appuis sans
+  // discrétisation) Alors
+  //   Factorisation de la matrice de rigidité partielle vide.
+  //   Fin.
+  // FinSi
+  if (p->calculs.m_part->nrow == 0)
+  {
+    status = umfpack_di_symbolic (0.,
+                                  0.,
+                                  NULL,
+                                  NULL,
+                                  NULL,
+                                  &symbolic,
+                                  NULL,
+                                  NULL);
+    BUGCRIT (status == UMFPACK_OK,
+             false,
+             (gettext ("Erreur de calcul : %d\n"), status); )
+    status = umfpack_di_numeric (NULL,
+                                 NULL,
+                                 NULL,
+                                 symbolic,
+                                 &p->calculs.numeric,
+                                 NULL,
+                                 NULL);
+    BUGCRIT (status == UMFPACK_OK,
+             false,
+             (gettext ("Erreur de calcul : %d\n"), status);
+               umfpack_di_free_symbolic (&symbolic); )
+    umfpack_di_free_symbolic (&symbolic);
+    
+    return true;
+  }
+  
+  // Les analyses symboliques conservées ne sont valables que pour une
+  // topologie identique.
+  cle = EF_calculs_empreinte (p);
+  if (cle != p->calculs.symbolique_cle)
+  {
+    BUG (EF_rigidite_free_symbolique (p), false)
+    p->calculs.symbolique_cle = cle;
+  }
+  
+  // La matrice de rigidité partielle est symétrique définie positive dès que
+  // la structure est stable : on tente d'abord la factorisation de Cholesky.
+  if (p->calculs.solveur == EF_SOLVEUR_CHOLESKY)
+  {
+    bool ok;
+    
+    BUG (EF_calculs_genere_mat_rig_cholesky (p, &ok), false)
+    if (ok)
+    {
+      return true;
+    }
+  }
+  // Méthode itérative : ni factorisation, ni remplissage.
+  else if (p->calculs.solveur == EF_SOLVEUR_GRADIENT_CONJUGUE)
+  {
+    bool ok;
+    
+    BUG (EF_calculs_genere_precond (p, &ok), false)
+    if (ok)
+    {
+      return true;
+    }
+  }
+  // Factorisation en simple précision, la précision étant retrouvée lors de
+  // la résolution par raffinement itératif.
+  else if (p->calculs.solveur == EF_SOLVEUR_PRECISION_MIXTE)
+  {
+    bool ok;
+    
+    BUG (EF_calculs_genere_mixte (p, &ok), false)
+    if (ok)
+    {
+      return true;
+    }
+  }
+  // Sous-structuration : les intérieurs sont factorisés en parallèle puis
+  // le complément de Schur de l'interface est factorisé.
+  else if (p->calculs.solveur == EF_SOLVEUR_SOUS_STRUCTURES)
+  {
+    bool ok;
+    
+    BUG (EF_sous_structures_factorise (p, &ok), false)
+    if (ok)
+    {
+      EF_calculs_rapport_ajout (p,
+                                format (gettext ("Sous-structuration : %zu sous-structures, %zu degrés de liberté d'interface"),
+                                        p->calculs.sous_structures->parties.size (),
+                                        p->calculs.sous_structures->interface.size ()),
+                                0,
+                                "");
+      
+      return true;
+    }
+    EF_calculs_rapport_ajout (p,
+                              gettext ("Sous-structuration"),
+                              1,
+                              gettext ("Matrice non définie positive, la factorisation LU est utilisée."));
+  }
+  
+  // Paramètres de la renumérotation d'UMFPACK. La dissection emboîtée et
+  // Cuthill-McKee inverse sont calculées ici et imposées à UMFPACK.
+  umfpack_di_defaults (control);
+  switch (p->calculs.ordonnancement)
+  {
+    case EF_ORDRE_AMD :
+    {
+      control[UMFPACK_STRATEGY] = UMFPACK_STRATEGY_SYMMETRIC;
+      control[UMFPACK_ORDERING] = UMFPACK_ORDERING_AMD;
+      break;
+    }
+    case EF_ORDRE_COLAMD :
+    {
+      control[UMFPACK_STRATEGY] = UMFPACK_STRATEGY_UNSYMMETRIC;
+      control[UMFPACK_ORDERING] = UMFPACK_ORDERING_AMD;
+      break;
+    }
+    case EF_ORDRE_DISSECTION :
+    case EF_ORDRE_RCM :
+    {
+      control[UMFPACK_STRATEGY] = UMFPACK_STRATEGY_SYMMETRIC;
+      control[UMFPACK_ORDERING] = UMFPACK_ORDERING_GIVEN;
+      break;
+    }
+    case EF_ORDRE_DEFAUT :
+    default :
+    {
+      break;
+    }
+  }
+  bande = EF_calculs_largeur_bande (p->calculs.m_part, NULL);
+  bande_perm = UINT32_MAX;
+  
+  // Factorisation de la matrice de rigidité partielle. m_part étant déjà au
+  // format colonne, il suffit d'en copier la structure et les valeurs.
+  nnz = (size_t) ((int *) p->calculs.m_part->p)[p->calculs.m_part->ncol];
+  p->calculs.ap = new int [p->calculs.m_part->ncol + 1];
+  p->calculs.ai = new int [nnz];
+  p->calculs.ax = new double [nnz];
+  memcpy (p->calculs.ap,
+          p->calculs.m_part->p,
+          sizeof (int) * (p->calculs.m_part->ncol + 1));
+  memcpy (p->calculs.ai, p->calculs.m_part->i, sizeof (int) * nnz);
+  memcpy (p->calculs.ax, p->calculs.m_part->x, sizeof (double) * nnz);
+  if (control[UMFPACK_ORDERING] == UMFPACK_ORDERING_GIVEN)
+  {
+    int *perm; // NS
+    
+    perm = new int [p->calculs.m_part->nrow];
+    if (p->calculs.ordonnancement == EF_ORDRE_RCM)
+    {
+      EF_calculs_rcm (p, perm);
+    }
+    else
+    {
+      cholmod_sparse m_sym;
+      int           *cparent, *cmember; // NS
+      long           nb_comp;
+      
+      // Vue symétrique de m_part (triangle supérieur) sans copie.
+      m_sym = *p->calculs.m_part;
+      m_sym.stype = 1;
+      cparent = new int [p->calculs.m_part->nrow];
+      cmember = new int [p->calculs.m_part->nrow];
+      nb_comp = cholmod_nested_dissection (&m_sym,
+                                           NULL,
+                                           0,
+                                           perm,
+                                           cparent,
+                                           cmember,
+                                           p->calculs.c);
+      delete [] cparent;
+      delete [] cmember;
+      BUGCRIT (nb_comp >= 0,
+               false,
+               (gettext ("Erreur de calcul : %d\n"), p->calculs.c->status);
+                 delete [] perm; )
+    }
+    bande_perm = EF_calculs_largeur_bande (p->calculs.m_part, perm);
+    if (p->calculs.symbolique_lu == NULL)
+    {
+      status = umfpack_di_qsymbolic ((int) p->calculs.m_part->nrow,
+                                     (int) p->calculs.m_part->ncol,
+                                     p->calculs.ap,
+                                     p->calculs.ai,
+                                     p->calculs.ax,
+                                     perm,
+                                     &p->calculs.symbolique_lu,
+                                     control,
+                                     info);
+      BUGCRIT (status == UMFPACK_OK,
+               false,
+               (gettext ("Erreur de calcul : %d\n"), status);
+                 delete [] perm; )
+      p->calculs.symbolique_prevision[0] = info[UMFPACK_LNZ_ESTIMATE] +
+                                           info[UMFPACK_UNZ_ESTIMATE];
+      p->calculs.symbolique_prevision[1] = info[UMFPACK_FLOPS_ESTIMATE];
+      p->calculs.symbolique_prevision[2] = info[UMFPACK_PEAK_MEMORY_ESTIMATE] *
+                                           info[UMFPACK_SIZE_OF_UNIT];
+    }
+    delete [] perm;
+  }
+  else if (p->calculs.symbolique_lu == NULL)
+  {
+    status = umfpack_di_symbolic ((int) p->calculs.m_part->nrow,
+                                  (int) p->calculs.m_part->ncol,
+                                  p->calculs.ap,
+                                  p->calculs.ai,
+                                  p->calculs.ax,
+                                  &p->calculs.symbolique_lu,
+                                  control,
+                                  info);
+    BUGCRIT (status == UMFPACK_OK,
+             false,
+             (gettext ("Erreur de calcul : %d\n"), status); )
+    p->calculs.symbolique_prevision[0] = info[UMFPACK_LNZ_ESTIMATE] +
+                                         info[UMFPACK_UNZ_ESTIMATE];
+    p->calculs.symbolique_prevision[1] = info[UMFPACK_FLOPS_ESTIMATE];
+    p->calculs.symbolique_prevision[2] = info[UMFPACK_PEAK_MEMORY_ESTIMATE] *
+                                         info[UMFPACK_SIZE_OF_UNIT];
+  }
+  status = umfpack_di_numeric (p->calculs.ap,
+                               p->calculs.ai,
+                               p->calculs.ax,
+                               p->calculs.symbolique_lu,
+                               &p->calculs.numeric,
+                               control,
+                               info);
+  if (status == UMFPACK_WARNING_singular_matrix)
+  {
+    printf (gettext ("Attention, matrice singulière.\n"
+                "Il est possible que la modélisation ne soit pas stable.\n"));
+  }
+  else
+  {
+    BUGCRIT (status == UMFPACK_OK,
+             false,
+             (gettext ("Erreur de calcul : %d\n"), status); )
+  }
+  
+  EF_calculs_rapport_factorisation (p,
+                                    gettext ("LU"),
+                                    bande,
+                                    bande_perm,
+                                    info[UMFPACK_LNZ] + info[UMFPACK_UNZ],
+                                    info[UMFPACK_FLOPS],
+                                    info[UMFPACK_PEAK_MEMORY] *
+                                      info[UMFPACK_SIZE_OF_UNIT]);
+  
+  return true;
+}
+
+
+/**
+ * \brief Calcul le moment hyperstatique correspondant à l'opposé du moment de
+ *        la réaction à partir de la rotation au point A et B autour de l'axe
+ *        Y.
+ * \param infos : contient les paramètres ay, by, cy, kAy et kBy,
+ * \param phia : rotation au noeud A,
+ * \param phib : rotation au noeud B,
+ * \param ma : moment au noeud A. Peut être NULL,
+ * \param mb : moment au noeud B. Peut être NULL.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - infos == NULL.
+ */
+bool
+EF_calculs_moment_hyper_y (Barre_Info_EF *infos,
+                           double         phia,
+                           double         phib,
+                           double        *ma,
+                           double        *mb)
+{
+  BUGPARAM (infos, "%p", infos, false)
+  
+  // Calcul des moments créés par les raideurs :\end{verbatim}
+  // \texttt{Référence : \cite{RDM_articulation}}\begin{align*}
+  //   M_{Ay} & = \frac{b_y \cdot \varphi_{By}+(c_y+k_{By}) \cdot
+  //           \varphi_{Ay}}{(a_y+k_{Ay}) \cdot (c_y+k_{By})-b_y^2} \nonumber\\
+  //   M_{By} & = \frac{b_y \cdot \varphi_{Ay}+(a_y+k_{Ay}) \cdot
+  //          \varphi_{By}}{(a_y+k_{Ay}) \cdot (c_y+k_{By})-b_y^2} \end{align*}
+  // \begin{verbatim}
+  if ((errrel (infos->kAy, MAXDOUBLE)) && (errrel (infos->kBy, MAXDOUBLE)))
+  {
+    if (ma != NULL)
+    {
+      *ma = 0.;
+    }
+    if (mb != NULL)
+    {
+      *mb = 0.;
+    }
+  }
+  else if (errrel (infos->kAy, MAXDOUBLE))
+  {
+    if (ma != NULL)
+    {
+      *ma = 0.;
+    }
+    if (mb != NULL)
+    {
+      *mb = phib / (infos->cy + infos->kBy);
+    }
+  }
+  else if (errrel (infos->kBy, MAXDOUBLE))
+  {
+    if (ma != NULL)
+    {
+      *ma = phia / (infos->ay + infos->kAy);
+    }
+    if (mb != NULL)
+    {
+      *mb = 0.;
+    }
+  }
+  else
+  {
+    if (ma != NULL)
+    {
+      *ma = (infos->by * phib + (infos->cy + infos->kBy) * phia) /
+              ((infos->ay + infos->kAy) * (infos->cy + infos->kBy) -
+               infos->by * infos->by);
+    }
+    if (mb != NULL)
+    {
+      *mb = (infos->by * phia + (infos->ay + infos->kAy) * phib) /
+              ((infos->ay + infos->kAy) * (infos->cy + infos->kBy) -
+               infos->by * infos->by);
+    }
+  }
+  
+  return true;
+}
+
+
+/**
+ * \brief Calcul le moment hyperstatique correspondant à l'opposé du moment de
+ *        la réaction à partir de la rotation au point A et B autour de l'axe
+ *        Z.
+ * \param infos : contient les paramètres az, bz, cz et kAz et kBz,
+ * \param phia : rotation au noeud A,
+ * \param phib : rotation au noeud B,
+ * \param ma : moment au noeud A. Peut être NULL,
+ * \param mb : moment au noeud B. Peut être NULL.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - infos == NULL
+ */
+bool
+EF_calculs_moment_hyper_z (Barre_Info_EF *infos,
+                           double         phia,
+                           double         phib,
+                           double        *ma,
+                           double        *mb)
+{
+  BUGPARAM (infos, "%p", infos, false)
+  
+  // Calcul des moments créés par les raideurs :\end{verbatim}
+  // \texttt{Référence : \cite{RDM_articulation}}\begin{align*}
+  //   M_{Az} & = \frac{b_z \cdot \varphi_{Bz}+(c_z+k_{Bz}) \cdot
+  //           \varphi_{Az}}{(a_z+k_{Az}) \cdot (c_z+k_{Bz})-b_z^2} \nonumber\\
+  //   M_{Bz} & = \frac{b_z \cdot \varphi_{Az}+(a_z+k_{Az}) \cdot
+  //   \varphi_{Bz}}{(a_z+k_{Az}) \cdot (c_z+k_{Bz})-b_z^2}\end{align*}
+  //   \begin{verbatim}
+  if ((errrel (infos->kAz, MAXDOUBLE)) && (errrel (infos->kBz, MAXDOUBLE)))
+  {
+    if (ma != NULL)
+    {
+      *ma = 0.;
+    }
+    if (mb != NULL)
+    {
+      *mb = 0.;
+    }
+  }
+  else if (errrel (infos->kAz, MAXDOUBLE))
+  {
+    if (ma != NULL)
+    {
+      *ma = 0.;
+    }
+    if (mb != NULL)
+    {
+      *mb = phib / (infos->cz + infos->kBz);
+    }
+  }
+  else if (errrel (infos->kBz, MAXDOUBLE))
+  {
+    if (ma != NULL)
+    {
+      *ma = phia / (infos->az + infos->kAz);
+    }
+    if (mb != NULL)
+    {
+      *mb = 0.;
+    }
+  }
+  else
+  {
+    if (ma != NULL)
+    {
+      *ma = (infos->bz * phib + (infos->cz + infos->kBz) * phia) /
+              ((infos->az + infos->kAz) * (infos->cz + infos->kBz) -
+               infos->bz * infos->bz);
+    }
+    if (mb != NULL)
+    {
+      *mb = (infos->bz * phia + (infos->az + infos->kAz) * phib) /
+              ((infos->az + infos->kAz) * (infos->cz + infos->kBz) -
+               infos->bz * infos->bz);
+    }
+  }
+  
+  return true;
+}
+
+
+/**
+ * \brief Détermine le résidu {r} = [A]{x} - {b} lors de la résolution du
+ *        système matriciel pour obtenir les déplacements aux noeuds
+ *        (A.x = b).
+ * \param Ap : Matrice de rigidité,
+ * \param Ai : Matrice de rigidité,
+ * \param Ax : Matrice de rigidité,
+ * \param b : Résultat à obtenir,
+ * \param n : Nombre de ligne dans le vecteur b,
+ * \param x : Résultat obtenu,
+ * \param r : Le résidu (n valeurs).
+ * \return La norme infinie du résidu.
+ */
+static double
+EF_calculs_resid_vecteur (int    *Ap,
+                          int    *Ai,
+                          double *Ax,
+                          double *b,
+                          size_t  n,
+                          double *x,
+                          double *r)
+{
+  int     p; // NS
+  size_t  j, k;
+  double  norm ;
+  
+  // Fonction tirée de la librarie UMFPACK, du fichier umfpack_di_demo.c
+  for (k = 0; k < n; k++)
+  {
+  	r[k] = -b[k];
+  }
+  for (j = 0; j < n; j++)
+  {
+    for (p = Ap[j]; p < Ap[j + 1]; p++)
+    {
+  		r[Ai[p]] += Ax[p] * x[j];
+    }
+  }
+  norm = 0.;
+  for (k = 0; k < n; k++)
+  {
+  	norm = std::max (fabs (r[k]), norm);
+  }
+  
+  return norm;
+}
+
+
+/**
+ * \brief Détermine le résidu lors de la résolution du système matriciel pour
+ *        obtenir les déplacements aux noeuds (A.x = b).
+ * \param Ap : Matrice de rigidité,
+ * \param Ai : Matrice de rigidité,
+ * \param Ax : Matrice de rigidité,
+ * \param b : Résultat à obtenir,
+ * \param n : Nombre de ligne dans le vecteur b,
+ * \param x : Résultat obtenu.
+ * \return
+ *   Succès : valeur du résidu.\n
+ *   Échec : NAN :
+ *     - Ap == NULL,
+ *     - Ai == NULL,
+ *     - Ax == NULL,
+ *     - b == NULL,
+ *     - x == NULL,
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+double
+EF_calculs_resid (int    *Ap,
+                  int    *Ai,
+                  double *Ax,
+                  double *b,
+                  size_t  n,
+                  double *x)
+{
+  double  norm ;
+  double *r;
+  
+  BUGPARAM (Ap, "%p", Ap, NAN)
+  BUGPARAM (Ai, "%p", Ai, NAN)
+  BUGPARAM (Ax, "%p", Ax, NAN)
+  BUGPARAM (b, "%p", b, NAN)
+  BUGPARAM (x, "%p", x, NAN)
+  
+  r = new double [n];
+  norm = EF_calculs_resid_vecteur (Ap, Ai, Ax, b, n, x, r);
+  delete [] r;
+  
+  return norm;
+}
+
+
+/**
+ * \brief Ajoute les réactions d'appui d'un élément discrétisé, exprimées dans
+ *        le repère global, aux vecteurs des forces partiel et complet.
+ * \param p : la variable projet,
+ * \param num_d : l'indice du noeud de début de l'élément,
+ * \param num_f : l'indice du noeud de fin de l'élément,
+ * \param eff : les 12 efforts aux extrémités de l'élément,
+ * \param for_part : le vecteur des forces partiel,
+ * \param for_comp : le vecteur des forces complet.
+ * \return Rien.
+ */
+static void
+EF_calculs_resoud_charge_ajout (Projet      *p,
+                                uint32_t     num_d,
+                                uint32_t     num_f,
+                                const double eff[12],
+                                double      *for_part,
+                                double      *for_comp)
+{
+  uint8_t i;
+  
+  for (i = 0; i < 6; i++)
+  {
+    if (p->calculs.n_part[num_d][i] != UINT32_MAX)
+    {
+      for_part[p->calculs.n_part[num_d][i]] += eff[i];
+    }
+    for_comp[p->calculs.n_comp[num_d][i]] += eff[i];
+    
+    if (p->calculs.n_part[num_f][i] != UINT32_MAX)
+    {
+      for_part[p->calculs.n_part[num_f][i]] += eff[i + 6];
+    }
+    for_comp[p->calculs.n_comp[num_f][i]] += eff[i + 6];
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Détermine les efforts aux noeuds de l'action dans le repère global.
+ *        Le vecteur complet est conservé dans l'action, le vecteur partiel est
+ *        écrit dans for_part et les sollicitations dues aux charges sur les
+ *        barres (supposées bi-encastrées) sont ajoutées aux courbes de
+ *        l'action.
+ * \param p : la variable projet,
+ * \param action : l'action dont on calcule les efforts,
+ * \param for_part : vecteur de p->calculs.nb_ddl valeurs. Il est
+ *                   initialisé à 0 par la fonction.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+static bool
+EF_calculs_resoud_charge_forces (Projet *p,
+                                 Action *action,
+                                 double *for_part)
+{
+  cholmod_triplet *t_for_comp;
+  double           eff_glo_i[12], eff_loc_i[12]; // Charge sur l'élément
+  double           eff_loc_f[12], eff_glo_f[12]; // Réactions d'appui
+  double          *ax;
+  double          *ax2;
+  uint32_t        *ai3, *aj3;
+  double          *ax3;
+  uint32_t         i;
+  
+  // Initialisation du vecteur partiel et création du triplet complet
+  // contenant les forces extérieures sur les noeuds. Le vecteur partiel sera
+  // utilisé dans l'équation finale : {F} = [K]{D}
+  BUG (_1990_action_fonction_init (p, action), false)
+  ax = for_part;
+  memset (ax, 0, sizeof (double) * p->calculs.nb_ddl);
+  BUGCRIT (t_for_comp = cholmod_allocate_triplet (6 * p->calculs.nb_noeuds,
+                                                  1,
+                                                  6 * p->calculs.nb_noeuds,
+                                                  0,
+                                                  CHOLMOD_REAL,
+                                                  p->calculs.c),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  ai3 = (uint32_t *) t_for_comp->i;
+  aj3 = (uint32_t *) t_for_comp->j;
+  ax3 = (double *) t_for_comp->x;
+  t_for_comp->nnz = 6 * p->calculs.nb_noeuds;
+  for (i = 0; i < t_for_comp->nnz; i++)
+  {
+    ai3[i] = i;
+    aj3[i] = 0;
+    ax3[i] = 0.;
+  }
+  
+  // Détermination des charges aux noeuds :
+  //   Pour chaque charge dans l'action
+  if (!_1990_action_charges_vide (action))
+  {
+    std::list <Charge *>::iterator it3;
+    
+    it3 = _1990_action_charges_renvoie (action)->begin ();
+    
+    while (it3 != _1990_action_charges_renvoie (action)->end ())
+    {
+      Charge *charge = *it3;
+      
+      switch (charge->type)
+      {
+        case CHARGE_NOEUD :
+        {
+  //   Si la charge en cours est une charge au noeud Alors
+  //     On ajoute au vecteur des efforts les efforts aux noeuds directement
+  //     saisis par l'utilisateur dans le repère global.
+          Charge_Noeud *charge_d = (Charge_Noeud *) charge->data;
+          
+          std::list <EF_Noeud *>::iterator it2  = charge_d->noeuds.begin ();
+          
+          while (it2 != charge_d->noeuds.end ())
+          {
+            EF_Noeud *noeud = *it2;
+            size_t    num = noeud->indice;
+            
+            if (p->calculs.n_part[num][0] != UINT32_MAX)
+            {
+              ax[p->calculs.n_part[num][0]] += m_g (charge_d->fx);
+            }
+            if (p->calculs.n_part[num][1] != UINT32_MAX)
+            {
+              ax[p->calculs.n_part[num][1]] += m_g (charge_d->fy);
+            }
+            if (p->calculs.n_part[num][2] != UINT32_MAX)
+            {
+              ax[p->calculs.n_part[num][2]] += m_g (charge_d->fz);
+            }
+            if (p->calculs.n_part[num][3] != UINT32_MAX)
+            {
+              ax[p->calculs.n_part[num][3]] += m_g (charge_d->mx);
+            }
+            if (p->calculs.n_part[num][4] != UINT32_MAX)
+            {
+              ax[p->calculs.n_part[num][4]] += m_g (charge_d->my);
+            }
+            if (p->calculs.n_part[num][5] != UINT32_MAX)
+            {
+              ax[p->calculs.n_part[num][5]] += m_g (charge_d->mz);
+            }
+            ax3[p->calculs.n_comp[num][0]] += m_g (charge_d->fx);
+            ax3[p->calculs.n_comp[num][1]] += m_g (charge_d->fy);
+            ax3[p->calculs.n_comp[num][2]] += m_g (charge_d->fz);
+            ax3[p->calculs.n_comp[num][3]] += m_g (charge_d->mx);
+            ax3[p->calculs.n_comp[num][4]] += m_g (charge_d->my);
+            ax3[p->calculs.n_comp[num][5]] += m_g (charge_d->mz);
+            
+            ++it2;
+          }
+          
+          break;
+        }
+  //   Sinon Si la charge est une charge ponctuelle sur la barre Alors
+        case CHARGE_BARRE_PONCTUELLE :
+        {
+          Charge_Barre_Ponctuelle *charge_d =
+                                      (Charge_Barre_Ponctuelle *) charge->data;
+          
+          double       l;
+          double       phiAy, phiBy, phiAz, phiBz; // Rotation sur appui
+                       // lorsque la barre est isostatique
+          double       MAx, MBx, MAy, MBy, MAz, MBz; // Moment opposé à la
+                       // réaction d'appui
+          EF_Noeud    *noeud_debut, *noeud_fin;
+          uint16_t     pos; // numéro de l'élément dans la discrétisation
+          
+          std::list <EF_Barre *>::iterator it2 = charge_d->barres.begin ();
+          
+          while (it2 != charge_d->barres.end ())
+          {
+            double    a, b; // Position de la charge par rapport au début
+                      // et à la fin de l'élément discrétisé
+            double    debut_barre, fin_barre; // Début et fin de la barre
+                      // discrétisée par rapport à la barre complète
+            double    FAx, FBx; // Effort de compression au début et fin
+                      // de l'élément discrétisé
+            double    FAy_i, FAy_h, FBy_i, FBy_h; // Force opposée à la
+                      // réaction d'appui
+            double    FAz_i, FAz_h, FBz_i, FBz_h;
+            EF_Barre *element = *it2;
+            uint32_t  num;
+            uint32_t  num_d, num_f;
+          
+            num = element->indice;
+      //   Convertion des efforts globaux en efforts locaux si nécessaire :
+      //   \end{verbatim}\begin{center}
+      //   $\{ F \}_{local} = [R]^T \cdot \{ F \}_{global}$\end{center}
+      //   \begin{verbatim}
+            if (!charge_d->repere_local)
+            {
+              ax2 = eff_glo_i;
+            }
+            else
+            {
+              ax2 = eff_loc_i;
+            }
+            ax2[0] = m_g (charge_d->fx);
+            ax2[1] = m_g (charge_d->fy);
+            ax2[2] = m_g (charge_d->fz);
+            ax2[3] = m_g (charge_d->mx);
+            ax2[4] = m_g (charge_d->my);
+            ax2[5] = m_g (charge_d->mz);
+            memset (&ax2[6], 0, sizeof (double) * 6);
+            if (!charge_d->repere_local)
+            {
+              common_math_rotation_vecteur (element->rot,
+                                            true,
+                                            eff_glo_i,
+                                            eff_loc_i);
+              ax2 = eff_loc_i;
+            }
+            // A ce stade ax2 pointent vers les charges dans le repère local
+            
+#define FREE_ALL cholmod_free_triplet (&t_for_comp, p->calculs.c);
+           
+      //   Détermination des deux noeuds se situant directement avant et
+      //   après la charge ponctuelle (est différent des deux noeuds
+      //   définissant la barre si elle est discrétisée).
+            if (element->nds_inter.size () == 0)
+            /* Pas de discrétisation */
+            {
+              pos = 0;
+              noeud_debut = element->noeud_debut;
+              noeud_fin = element->noeud_fin;
+            }
+            else
+            // On cherche le noeud de départ et le noeud de fin
+            {
+              pos = 0;
+              l = -1.;
+              // On regarde pour chaque noeud intermédiaire si la position de
+              // la charge devient inférieure à la distance entre le noeud de
+              // départ et le noeud intermédiaire.
+              while ((pos <= element->nds_inter.size ()) &&
+                     (l < m_g (charge_d->position)))
+              {
+                if (pos == element->nds_inter.size ())
+                {
+                  l = EF_noeuds_distance (element->noeud_fin,
+                                          element->noeud_debut);
+                }
+                else
+                {
+                  std::list <EF_Noeud *>::iterator it_t;
+                  
+                  it_t = element->nds_inter.begin ();
+                  std::advance (it_t, pos);
+                  l = EF_noeuds_distance (*it_t, element->noeud_debut);
+                }
+                BUG (!std::isnan (l), false, FREE_ALL)
+                pos++;
+              }
+              pos--;
+              // Alors la position de la charge est compris entre le début du
+              // noeud et le premier noeud intermédiaire.
+              if (pos == 0)
+              {
+                noeud_debut = element->noeud_debut;
+                noeud_fin = *element->nds_inter.begin ();
+              }
+              // Alors la position de la charge est compris entre le dernier
+              // noeud intermédiaire et le noeud de fin de la barre
+              else if (pos == element->nds_inter.size ())
+              {
+                std::list <EF_Noeud *>::iterator it_t;
+                
+                it_t = element->nds_inter.begin ();
+                std::advance (it_t, pos - 1U);
+                noeud_debut = *it_t;
+                noeud_fin = element->noeud_fin;
+              }
+              else
+              {
+                std::list <EF_Noeud *>::iterator it_t;
+                
+                it_t = element->nds_inter.begin ();
+                std::advance (it_t, pos - 1U);
+                noeud_debut = *it_t;
+                std::next (it_t);
+                noeud_fin = *it_t;
+              }
+            }
+            num_d = noeud_debut->indice;
+            num_f = noeud_fin->indice;
+            debut_barre = EF_noeuds_distance (noeud_debut,
+                                              element->noeud_debut);
+            BUG (!std::isnan (debut_barre), false, FREE_ALL)
+            a = m_g (charge_d->position) - debut_barre;
+            fin_barre = EF_noeuds_distance (noeud_fin, element->noeud_debut);
+            BUG (!std::isnan (fin_barre), false, FREE_ALL)
+            l = fabs (fin_barre - debut_barre);
+            b = l - a;
+            
+      //   Détermination des moments mx de rotation :
+            BUG (EF_charge_barre_ponctuelle_mx (element,
+                                                pos,
+                                                a,
+                                                &(element->info_EF[pos]),
+                                                ax2[3],
+                                                &MAx,
+                                                &MBx),
+                 false,
+                 FREE_ALL)
+            
+      //   Détermination de la rotation y et z aux noeuds de l'élément
+      //   discrétisé en le supposant isostatique :
+            BUG (EF_charge_barre_ponctuelle_def_ang_iso_y (element,
+                                                           pos,
+                                                           a,
+                                                           ax2[2],
+                                                           ax2[4],
+                                                           &phiAy,
+                                                           &phiBy),
+                 false,
+                 FREE_ALL)
+            BUG (EF_charge_barre_ponctuelle_def_ang_iso_z (element,
+                                                           pos,
+                                                           a,
+                                                           ax2[1],
+                                                           ax2[5],
+                                                           &phiAz,
+                                                           &phiBz),
+                 false,
+                 FREE_ALL)
+            
+      //   Calcul des moments créés par les raideurs :
+            BUG (EF_calculs_moment_hyper_y (&(element->info_EF[pos]),
+                                            phiAy,
+                                            phiBy,
+                                            &MAy,
+                                            &MBy),
+                 false,
+                 FREE_ALL)
+            BUG (EF_calculs_moment_hyper_z (&(element->info_EF[pos]),
+                                            phiAz,
+                                            phiBz,
+                                            &MAz,
+                                            &MBz),
+                 false,
+                 FREE_ALL)
+            
+      //   Réaction d'appui sur les noeuds :\end{verbatim}\begin{align*}
+            // F_{Ax} & = F_x \cdot \frac{\int_a^l \frac{1}{E \cdot S(x)}}
+            //            {\int_0^l \frac{1}{E \cdot S(x)}}\nonumber\\
+            // F_{Bx} & = F_x - F_{Ax}\nonumber\\
+            // F_{Ay_i}   & = \frac{F_y \cdot b}{l}-\frac{M_z}{l}\nonumber\\
+            // F_{Ay_h} & = \frac{M_{Bz}+M_{Az}}{l}\nonumber\\
+            // F_{By_i}   & = \frac{F_y \cdot a}{l}+\frac{M_z}{l}\nonumber\\
+            // F_{By_h} & = -\frac{M_{Bz}+M_{Az}}{l}\nonumber\\
+            // F_{Az_i}   & = \frac{F_z \cdot b}{l}+\frac{M_y}{l}\nonumber\\
+            // F_{Az_h} & = -\frac{M_{By}+M_{Ay}}{l}\nonumber\\
+            // F_{Bz_i}   & = \frac{F_z \cdot a}{l}-\frac{M_y}{l}\nonumber\\
+            // F_{Bz_h} & = \frac{M_{By}+M_{Ay}}{l}\end{align*}
+            // \begin{verbatim}
+            FAx = ax2[0] * EF_sections_es_l (element, pos, 0, l) /
+                    EF_sections_es_l (element, pos, a, l);
+            BUG (!std::isnan (FAx), false, FREE_ALL)
+            FBx = ax2[0] - FAx;
+            FAy_i = ax2[1] * b / l - ax2[5] / l;
+            FAy_h = (MBz + MAz) / l;
+            FBy_i = ax2[1] * a / l + ax2[5] / l;
+            FBy_h = -(MBz + MAz) / l;
+            FAz_i = ax2[2] * b / l + ax2[4] / l;
+            FAz_h = -(MBy + MAy) / l;
+            FBz_i = ax2[2] * a / l - ax2[4] / l;
+            FBz_h = (MBy + MAy) / l;
+            
+      //   Détermination des fonctions des efforts dus à la charge (x, a et
+      //   l sont calculés par rapport à l'élément discrétisé et non pour
+      //   toute la barre). Pour cela on calcule la sollicitation due au cas
+      //   isostatique puis on ajoute la sollicitation due à l'éventuel
+      //   encastrement (MAx, MBx, MAy, MAz, MBy, MBz) :\end{verbatim}
+      //   \begin{align*}
+            // N(x) & = -F_{Ax} & &\textrm{ pour x de 0 à a}\nonumber\\
+            // N(x) & = F_{Bx} & &\textrm{ pour x de a à l}\nonumber\\
+            
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 0, num),
+                   0.,
+                   a,
+                   -FAx,
+                   0., 0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 0, num),
+                   a,
+                   l,
+                   FBx,
+                   0., 0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            
+            // T_y(x) & = -F_{Ay_i} - F_{Ay_h} & &\textrm{ pour x de 0 à a}
+            // \nonumber\\
+            // T_y(x) & =  F_{By_i} + F_{By_h} & &\textrm{ pour x de a à l}
+            // \nonumber\\
+            
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 1, num),
+                   0.,
+                   a,
+                   -FAy_i - FAy_h,
+                   0., 0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 1, num),
+                   a,
+                   l,
+                   FBy_i + FBy_h,
+                   0., 0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            
+            // T_z(x) & = -F_{Az_i} - F_{Az_h} & &\textrm{ pour x de 0 à a}
+            // \nonumber\\
+            // T_z(x) & =  F_{Bz_i} + F_{Bz_h} & &\textrm{ pour x de a à l}
+            // \nonumber\\
+            
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 2, num),
+                   0.,
+                   a,
+                   -FAz_i - FAz_h,
+                   0., 0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 2, num),
+                   a,
+                   l,
+                   FBz_i + FBz_h,
+                   0., 0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            
+            // M_x(x) & = -M_{Ax} & &\textrm{ pour x de 0 à a}\nonumber\\
+            // M_x(x) & = M_{Bx} & &\textrm{ pour x de a à l}\nonumber\\
+            
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 3, num),
+                   0.,
+                   a,
+                   -MAx,
+                   0., 0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 3, num),
+                   a,
+                   l,
+                   MBx,
+                   0., 0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            
+            // M_y(x) & = -M_{Ay} - (F_{Az_i}+F_{Az_h}) \cdot x & 
+            //            &\textrm{ pour x de 0 à a}\nonumber\\
+            // M_y(x) & = F_{Bz_i} \cdot L - M_{Ay} + (F_{Bz_i} + F_{Bz_h})
+            //            \cdot x & &\textrm{ pour x de a à l}\nonumber\\
+            
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 4, num),
+                   0.,
+                   a,
+                   -MAy,
+                   -FAz_i - FAz_h,
+                   0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 4, num),
+                   a,
+                   l,
+                   -FBz_i * l - MAy,
+                   FBz_i + FBz_h,
+                   0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            
+            // M_z(x) & = -M_{Az} + (F_{Ay_i}+F_{Ay_h}) \cdot x &
+            //            &\textrm{ pour x de 0 à a}\nonumber\\
+            // M_z(x) & = F_{By_i} \cdot L - M_{Az} - (F_{By_i} + F_{By_h})
+            //            \cdot x & &\textrm{ pour x de a à l}
+            
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 5, num),
+                   0.,
+                   a,
+                   -MAz,
+                   FAy_i + FAy_h,
+                   0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_efforts_renvoie (action, 5, num),
+                   a,
+                   l,
+                   FBy_i * l - MAz,
+                   -FBy_i - FBy_h,
+                   0., 0., 0., 0., 0.,
+                   debut_barre),
+                 false,
+                 FREE_ALL)
+            // \end{align*}\begin{verbatim}
+            
+            
+      //   Détermination des fonctions de déformation et rotation (cas
+      //   isostatique + encastrement) :
+      //   \begin{align*}
+            BUG (EF_charge_barre_ponctuelle_fonc_rx (
+                   _1990_action_rotation_renvoie (action, 0, num),
+                   element,
+                   pos,
+                   a,
+                   MAx,
+                   MBx),
+                 false,
+                 FREE_ALL)
+            BUG (EF_charge_barre_ponctuelle_fonc_ry (
+                   _1990_action_rotation_renvoie (action, 1, num),
+                   _1990_action_deformation_renvoie (action, 2, num),
+                   element,
+                   pos,
+                   a,
+                   ax2[2],
+                   ax2[4],
+                   -MAy,
+                   -MBy),
+                 false,
+                 FREE_ALL)
+            BUG (EF_charge_barre_ponctuelle_fonc_rz (
+                   _1990_action_rotation_renvoie (action, 2, num),
+                   _1990_action_deformation_renvoie (action, 1, num),
+                   element,
+                   pos,
+                   a,
+                   ax2[1],
+                   ax2[5],
+                   -MAz,
+                   -MBz),
+                 false,
+                 FREE_ALL)
+            BUG (EF_charge_barre_ponctuelle_n (
+                   _1990_action_deformation_renvoie (action, 0, num),
+                   element,
+                   pos,
+                   a,
+                   FAx,
+                   FBx),
+                 false,
+                 FREE_ALL)
+            
+#undef FREE_ALL
+            
+      //   Convertion des réactions d'appuis locales dans le repère global :
+      //   \end{verbatim}\begin{center}
+      //     $\{ R \}_{global} = [K] \cdot \{ F \}_{local}$\end{center}
+      //     \begin{verbatim}
+            eff_loc_f[0] = FAx;
+            eff_loc_f[1] = FAy_i + FAy_h;
+            eff_loc_f[2] = FAz_i + FAz_h;
+            eff_loc_f[3] = MAx;
+            eff_loc_f[4] = MAy;
+            eff_loc_f[5] = MAz;
+            eff_loc_f[6] = FBx;
+            eff_loc_f[7] = FBy_i + FBy_h;
+            eff_loc_f[8] = FBz_i + FBz_h;
+            eff_loc_f[9] = MBx;
+            eff_loc_f[10] = MBy;
+            eff_loc_f[11] = MBz;
+            common_math_rotation_vecteur (element->rot,
+                                          false,
+                                          eff_loc_f,
+                                          eff_glo_f);
+            
+      //   Ajout des moments et les efforts dans le vecteur des forces aux
+      //   noeuds {F}
+            EF_calculs_resoud_charge_ajout (p, num_d, num_f, eff_glo_f, ax, ax3);
+            
+            ++it2;
+          }
+          
+          break;
+        }
+  //   Sinon Si la charge est une charge répartie uniforme sur la barre Alors
+        case CHARGE_BARRE_REPARTIE_UNIFORME :
+        {
+          double   xx, yy, zz, l;
+          uint16_t j_d, j_f; // Numéro de l'élément dans la discrétisation
+          
+          Charge_Barre_Repartie_Uniforme *charge_d =
+                               (Charge_Barre_Repartie_Uniforme *) charge->data;
+          std::list <EF_Barre *>::iterator it2 = charge_d->barres.begin ();
+          
+          while (it2 != charge_d->barres.end ())
+          {
+            double    ll;
+            EF_Barre *element = *it2;
+            uint16_t pos;
+            
+            uint32_t num = element->indice;
+            
+      //   Convertion des efforts globaux en efforts locaux si nécessaire :
+      //   \end{verbatim}\begin{center}
+      //     $\{ F \}_{local} = [R_e]^T \cdot \{ F \}_{global}$\end{center}
+      //   \begin{verbatim}
+            ll = EF_noeuds_distance_x_y_z (element->noeud_debut,
+                                           element->noeud_fin,
+                                           &xx,
+                                           &yy,
+                                           &zz);
+            BUG (!std::isnan (ll),
+                 false,
+                 cholmod_free_triplet (&t_for_comp, p->calculs.c); )
+            if (!charge_d->repere_local)
+            {
+              ax2 = eff_glo_i;
+            }
+            else
+            {
+              ax2 = eff_loc_i;
+            }
+            if (charge_d->projection)
+            {
+              ax2[0] = m_g (charge_d->fx) * sqrt (yy * yy + zz * zz) / ll;
+              ax2[1] = m_g (charge_d->fy) * sqrt (xx * xx + zz * zz) / ll;
+              ax2[2] = m_g (charge_d->fz) * sqrt (xx * xx + yy * yy) / ll;
+              ax2[3] = m_g (charge_d->mx) * sqrt (yy * yy + zz * zz) / ll;
+              ax2[4] = m_g (charge_d->my) * sqrt (xx * xx + zz * zz) / ll;
+              ax2[5] = m_g (charge_d->mz) * sqrt (xx * xx + yy * yy) / ll;
+            }
+            else
+            {
+              ax2[0] = m_g (charge_d->fx);
+              ax2[1] = m_g (charge_d->fy);
+              ax2[2] = m_g (charge_d->fz);
+              ax2[3] = m_g (charge_d->mx);
+              ax2[4] = m_g (charge_d->my);
+              ax2[5] = m_g (charge_d->mz);
+            }
+            memset (&ax2[6], 0, sizeof (double) * 6);
+            if (!charge_d->repere_local)
+            {
+              common_math_rotation_vecteur (element->rot,
+                                            true,
+                                            eff_glo_i,
+                                            eff_loc_i);
+              ax2 = eff_loc_i;
+            }
+            // A ce stade ax2 pointent vers les charges dans le repère local
+            
+#define FREE_ALL cholmod_free_triplet (&t_for_comp, p->calculs.c);
+      
+      //   Détermination des deux barres discrétisées (j_d et j_f) qui
+      //   entoure la charge répartie.
+            if (element->nds_inter.size () == 0)
+            // Pas de discrétisation
+            {
+              j_d = 0;
+              j_f = 0;
+            }
+            else
+            // On cherche le noeud de départ et le noeud de fin
+            {
+              j_d = 0;
+              l = -1.;
+              // On regarde pour chaque noeud intermédiaire si la position de
               // la charge devient inférieure à la distance entre le noeud de
               // départ et le noeud intermédiaire.
               while ((j_d <= element->nds_inter.size ()) && 
@@ -1685,8 +3160,6 @@ EF_calculs_resoud_charge (Projet *p,
               double    FAx, FBx;
               double    FAy_i, FAy_h, FBy_i, FBy_h; // Réactions d'appui
               double    FAz_i, FAz_h, FBz_i, FBz_h;
-              uint32_t *ai4, *aj4;
-              double   *ax4;
               EF_Noeud *noeud_debut, *noeud_fin;
               uint32_t  num_d, num_f;
               
@@ -1740,14 +3213,8 @@ EF_calculs_resoud_charge (Projet *p,
                 b = 0.;
               }
               
-              num_d = std::distance (p->modele.noeuds.begin (),
-                                     std::find (p->modele.noeuds.begin (), 
-                                                p->modele.noeuds.end (),
-                                                noeud_debut));
-              num_f = std::distance (p->modele.noeuds.begin (),
-                                     std::find (p->modele.noeuds.begin (),
-                                                p->modele.noeuds.end (),
-                                                noeud_fin));
+              num_d = noeud_debut->indice;
+              num_f = noeud_fin->indice;
               
       //     Détermination des moments mx de rotation :
               BUG (EF_charge_barre_repartie_uniforme_mx (element,
@@ -2137,658 +3604,2704 @@ EF_calculs_resoud_charge (Projet *p,
       //     :\end{verbatim}\begin{center}
       //     $\{ R \}_{global} = [K] \cdot \{ F \}_{local}$\end{center}
       //     \begin{verbatim}
-              BUGCRIT (t_eff_loc_f = cholmod_allocate_triplet (12,
-                                                               1,
-                                                               12,
-                                                               0,
-                                                               CHOLMOD_REAL,
-                                                               p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         FREE_ALL)
-              ai4 = (uint32_t *) t_eff_loc_f->i;
-              aj4 = (uint32_t *) t_eff_loc_f->j;
-              ax4 = (double *) t_eff_loc_f->x;
-              t_eff_loc_f->nnz = 12;
-              ai4[0] = 0;   aj4[0] = 0;  ax4[0] = FAx;
-              ai4[1] = 1;   aj4[1] = 0;  ax4[1] = FAy_i + FAy_h;
-              ai4[2] = 2;   aj4[2] = 0;  ax4[2] = FAz_i + FAz_h;
-              ai4[3] = 3;   aj4[3] = 0;  ax4[3] = MAx;
-              ai4[4] = 4;   aj4[4] = 0;  ax4[4] = MAy;
-              ai4[5] = 5;   aj4[5] = 0;  ax4[5] = MAz;
-              ai4[6] = 6;   aj4[6] = 0;  ax4[6] = FBx;
-              ai4[7] = 7;   aj4[7] = 0;  ax4[7] = FBy_i + FBy_h;
-              ai4[8] = 8;   aj4[8] = 0;  ax4[8] = FBz_i + FBz_h;
-              ai4[9] = 9;   aj4[9] = 0;  ax4[9] = MBx;
-              ai4[10] = 10; aj4[10] = 0; ax4[10] = MBy;
-              ai4[11] = 11; aj4[11] = 0; ax4[11] = MBz;
-              BUGCRIT (s_eff_loc_f = cholmod_triplet_to_sparse (t_eff_loc_f,
-                                                                0,
-                                                                p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_triplet (&t_eff_loc_f, p->calculs.c);
-                         FREE_ALL)
-              cholmod_free_triplet (&t_eff_loc_f, p->calculs.c);
-              BUGCRIT (s_eff_glo_f = cholmod_ssmult (element->m_rot,
-                                                     s_eff_loc_f,
-                                                     0,
-                                                     1,
-                                                     0,
-                                                     p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_sparse (&s_eff_loc_f, p->calculs.c);
-                         FREE_ALL)
-              cholmod_free_sparse (&s_eff_loc_f, p->calculs.c);
-              BUGCRIT (t_eff_glo_f = cholmod_sparse_to_triplet (s_eff_glo_f,
-                                                                p->calculs.c),
-                       false,
-                       (gettext ("Erreur d'allocation mémoire.\n"));
-                         cholmod_free_sparse (&s_eff_glo_f, p->calculs.c);
-                         FREE_ALL)
-              cholmod_free_sparse (&s_eff_glo_f, p->calculs.c);
-              ai4 = (uint32_t *) t_eff_glo_f->i;
-              ax4 = (double *) t_eff_glo_f->x;
+              eff_loc_f[0] = FAx;
+              eff_loc_f[1] = FAy_i + FAy_h;
+              eff_loc_f[2] = FAz_i + FAz_h;
+              eff_loc_f[3] = MAx;
+              eff_loc_f[4] = MAy;
+              eff_loc_f[5] = MAz;
+              eff_loc_f[6] = FBx;
+              eff_loc_f[7] = FBy_i + FBy_h;
+              eff_loc_f[8] = FBz_i + FBz_h;
+              eff_loc_f[9] = MBx;
+              eff_loc_f[10] = MBy;
+              eff_loc_f[11] = MBz;
+              common_math_rotation_vecteur (element->rot,
+                                            false,
+                                            eff_loc_f,
+                                            eff_glo_f);
             
       //     Ajout des moments et les efforts dans le vecteur des forces aux
       //     noeuds {F}
-              for (j = 0; j < 12; j++)
-              {
-                if (ai4[j] < 6)
-                {
-                  if (p->calculs.n_part[num_d][ai4[j]] != UINT32_MAX)
-                  {
-                    ax[p->calculs.n_part[num_d][ai4[j]]] += ax4[j];
-                  }
-                  ax3[p->calculs.n_comp[num_d][ai4[j]]] += ax4[j];
-                }
-                else
-                {
-                  if (p->calculs.n_part[num_f][ai4[j] - 6] != UINT32_MAX)
-                  {
-                    ax[p->calculs.n_part[num_f][ai4[j] - 6]] += ax4[j];
-                  }
-                  ax3[p->calculs.n_comp[num_f][ai4[j] - 6]] += ax4[j];
-                }
-              }
-              cholmod_free_triplet (&t_eff_glo_f, p->calculs.c);
+              EF_calculs_resoud_charge_ajout (p,
+                                              num_d,
+                                              num_f,
+                                              eff_glo_f,
+                                              ax,
+                                              ax3);
             }
       //   FinPour
-            cholmod_free_triplet (&t_eff_loc_i, p->calculs.c);
 #undef FREE_ALL
-            
-            ++it2;
+            
+            ++it2;
+          }
+          
+          break;
+        }
+  //   FinSi
+        /* Charge inconnue */
+        default :
+        {
+          FAILCRIT (false,
+                    (gettext ("Type de charge %d inconnu.\n"), charge->type); )
+          break;
+        }
+      }
+      
+      ++it3;
+    }
+  }
+  // FinPour
+  
+  // On converti les données dans des structures permettant les calculs via les
+  // libraries.
+  BUGCRIT (_1990_action_forces_change (action,
+                                       cholmod_triplet_to_sparse (t_for_comp,
+                                                                  0,
+                                                                p->calculs.c)),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n"));
+             cholmod_free_triplet (&t_for_comp, p->calculs.c); )
+  cholmod_free_triplet (&t_for_comp, p->calculs.c);
+  
+  return true;
+}
+
+
+/**
+ * \brief Détermine à partir des déplacements de la matrice de rigidité
+ *        partielle les déplacements complets, les efforts dans les noeuds et
+ *        la courbe des sollicitations dans les barres pour l'action.
+ * \param p : la variable projet,
+ * \param action : l'action dont les efforts ont été calculés par
+ *                 #EF_calculs_resoud_charge_forces,
+ * \param dep_part : les déplacements solution de [K]{D} = {F}, soit
+ *                   p->calculs.nb_ddl valeurs.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+static bool
+EF_calculs_resoud_charge_resultats (Projet *p,
+                                    Action *action,
+                                    double *dep_part)
+{
+  cholmod_triplet *t_dep_tot;
+  double          *ax;
+  uint32_t        *ai2, *aj2;
+  double          *ax2;
+  uint32_t         i, j;
+  uint8_t          k;
+  cholmod_sparse  *forces, *efforts;
+  int             *ep, *ei; // NS
+  double          *ex;
+  
+  std::list <EF_Barre *>::iterator it;
+  
+  // Création du vecteur déplacement complet
+  BUGCRIT (t_dep_tot = cholmod_allocate_triplet (
+                         _1990_action_forces_renvoie(action)->nrow,
+                         1,
+                         _1990_action_forces_renvoie (action)->nrow,
+                         0,
+                         CHOLMOD_REAL,
+                         p->calculs.c),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  t_dep_tot->nnz = _1990_action_forces_renvoie (action)->nrow;
+  ai2 = (uint32_t *) t_dep_tot->i;
+  aj2 = (uint32_t *) t_dep_tot->j;
+  ax2 = (double *) t_dep_tot->x;
+  for (i = 0; i < p->modele.noeuds.size (); i++)
+  {
+    for (k = 0; k < 6; k++)
+    {
+      ai2[i * 6 + k] = i * 6 + k; aj2[i * 6 + k] = 0;
+      if (p->calculs.n_part[i][k] == UINT32_MAX)
+      {
+        ax2[i * 6 + k] = 0.;
+      }
+      else
+      {
+        ax2[i * 6 + k] = dep_part[p->calculs.n_part[i][k]];
+      }
+    }
+  }
+  BUGCRIT (_1990_action_deplacement_change (action,
+                                          cholmod_triplet_to_sparse (t_dep_tot,
+                                                                     0,
+                                                                p->calculs.c)),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n"));
+             cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
+  
+  // Calcule des réactions d'appuis à partir des seules lignes bloquées de la
+  // matrice de rigidité complète :\end{verbatim}\begin{displaymath}
+  // \{R\} = [K_b] \cdot \{D\} - \{F_b\} \end{displaymath}\begin{verbatim}
+  // Les efforts aux noeuds des degrés de liberté libres sont nuls à
+  // l'équilibre.
+  forces = _1990_action_forces_renvoie (action);
+  BUGCRIT (efforts = cholmod_allocate_sparse (forces->nrow,
+                                              1,
+                                              forces->nrow,
+                                              true,
+                                              true,
+                                              0,
+                                              CHOLMOD_REAL,
+                                              p->calculs.c),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n"));
+             cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
+  ep = (int *) efforts->p;
+  ei = (int *) efforts->i;
+  ex = (double *) efforts->x;
+  ep[0] = 0;
+  ep[1] = (int) forces->nrow;
+  for (i = 0; i < forces->nrow; i++)
+  {
+    ei[i] = (int) i;
+    ex[i] = 0.;
+  }
+  for (i = 0; i < p->calculs.nb_reactions; i++)
+  {
+    double somme = 0.;
+    
+    for (j = p->calculs.reac_p[i]; j < p->calculs.reac_p[i + 1]; j++)
+    {
+      somme += p->calculs.reac_x[j] * dep_part[p->calculs.reac_i[j]];
+    }
+    ex[p->calculs.reac_ligne[i]] = somme;
+  }
+  for (j = 0; j < (uint32_t) ((int *) forces->p)[1]; j++)
+  {
+    i = (uint32_t) ((int *) forces->i)[j];
+    if (p->calculs.n_part[i / 6U][i % 6U] == UINT32_MAX)
+    {
+      ex[i] -= ((double *) forces->x)[j];
+    }
+  }
+  BUG (_1990_action_efforts_noeuds_change (action, efforts),
+       false,
+       cholmod_free_triplet (&t_dep_tot, p->calculs.c);
+         cholmod_free_sparse (&efforts, p->calculs.c); )
+  
+  // Pour chaque barre, ajout des efforts et déplacement dus au mouvement de
+  // l'ensemble de la structure.
+  it = p->modele.barres.begin ();
+  while (it != p->modele.barres.end ())
+  {
+    EF_Barre *element = *it;
+    double    S = m_g (EF_sections_s (element->section));
+    size_t    num = element->indice;
+    
+  //   Pour chaque discrétisation de la barre
+    for (j = 0; j <= element->nds_inter.size (); j++)
+    {
+      EF_Noeud        *noeud_debut, *noeud_fin; // Le noeud de départ et le
+      // noeud de fin, nécessaire en cas de discrétisation
+      double           dep_glo[12], dep_loc[12], eff_loc[12];
+      double           l_debut, l_fin;
+      double           E, G;
+      double           l;
+      uint32_t         num_d, num_f;
+      double           J = m_g (EF_sections_j (element->section));
+      double           Iy = m_g (EF_sections_iy (element->section));
+      double           Iz = m_g (EF_sections_iz (element->section));
+      
+      BUG (!std::isnan (J),
+           false,
+           cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
+      BUG (!std::isnan (Iy),
+           false,
+           cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
+      BUG (!std::isnan (Iz),
+           false,
+           cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
+      
+      
+      // Récupération du noeud de départ et de fin de la partie discrétisée
+      if (j == 0)
+      {
+        noeud_debut = element->noeud_debut;
+      }
+      else
+      {
+        std::list <EF_Noeud *>::iterator it_t;
+        
+        it_t = element->nds_inter.begin ();
+        std::advance (it_t, j - 1);
+        noeud_debut = *it_t;
+      }
+      if (j == element->nds_inter.size ())
+      {
+        noeud_fin = element->noeud_fin;
+      }
+      else
+      {
+        std::list <EF_Noeud *>::iterator it_t;
+        
+        it_t = element->nds_inter.begin ();
+        std::advance (it_t, j);
+        noeud_fin = *it_t;
+      }
+      
+      num_d = noeud_debut->indice;
+      num_f = noeud_fin->indice;
+      
+      // Récupération des caractéristiques de la barre en fonction du matériau
+      switch (element->type)
+      {
+        case BETON_ELEMENT_POTEAU :
+        case BETON_ELEMENT_POUTRE :
+        {
+          E = m_g (EF_materiaux_E (element->materiau));
+          G = m_g (EF_materiaux_G (element->materiau, false));
+          break;
+        }
+        default :
+        {
+          FAILCRIT (false,
+                    (gettext ("Type d'élément %d inconnu.\n"), element->type);
+                      cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
+          break;
+        }
+      }
+      
+  //     Récupération des déplacements du noeud de départ et du noeud final de
+  //     l'élément
+      ax2 = (double *) t_dep_tot->x;
+      for (i = 0; i < 6; i++)
+      {
+        dep_glo[i] = ax2[p->calculs.n_comp[num_d][i]];
+        dep_glo[i + 6] = ax2[p->calculs.n_comp[num_f][i]];
+      }
+      
+  //     Conversion des déplacements globaux en déplacement locaux (u_A, v_A,
+  //     w_A, theta_{Ax}, theta_{Ay}, theta_{Az}, u_B, v_B, w_B, theta_{Bx},
+  //     theta_{By} et theta_{Bz}) : \end{verbatim}\begin{align*}
+      // \{ \Delta \}_{local} = [R]^T \cdot \{ \Delta \}_{global}\end{align*}
+      // \begin{verbatim}
+      common_math_rotation_vecteur (element->rot, true, dep_glo, dep_loc);
+  //     Détermination des efforts (F_{Ax}, F_{Bx}, F_{Ay}, F_{By}, F_{Az},
+  //     F_{Bz}, M_{Ax}, M_{Bx}, M_{Ay}, M_{By}, M_{Az} et M_{Bz}) dans le
+  //     repère local : \end{verbatim}\begin{align*}
+      // \{ F \}_{local} = [K] \cdot \{ \Delta \}_{local}\end{align*}
+      // \begin{verbatim}
+      common_math_produit_12 (element->info_EF[j].k_loc, dep_loc, eff_loc);
+      
+#define FREE_ALL cholmod_free_triplet (&t_dep_tot, p->calculs.c);
+      
+      ax = dep_loc;
+      ax2 = eff_loc;
+      l_debut = EF_noeuds_distance (noeud_debut, element->noeud_debut);
+      l_fin = EF_noeuds_distance (noeud_fin, element->noeud_debut);
+      BUG (!std::isnan (l_debut), false, FREE_ALL)
+      BUG (!std::isnan (l_fin), false, FREE_ALL)
+      l = fabs (l_fin - l_debut);
+      
+  //     Ajout des efforts entre deux noeuds dus à leur déplacement relatif,
+  //     la courbe vient s'ajouter à la courbe (si existante) déja définie
+  //     précédemment. L'indice A correspond au noeud de départ et l'indice B
+  //     correspond au noeud final :\end{verbatim}\begin{align*}
+      // N(x) & = N(x) + F_{Ax} - (F_{Ax}+F_{Bx}) \cdot x/L\nonumber\\
+      // T_y(x) & = T_y(x) + F_{Ay} - (F_{Ay}+F_{By}) \cdot x/L\nonumber\\
+      // T_z(x) & = T_z(x) + F_{Az} - (F_{Az}+F_{Bz}) \cdot x/L\nonumber\\
+      // M_x(x) & = M_x(x) + M_{Ax} - (M_{Ax}+M_{Bx}) \cdot x/L\nonumber\\
+      // M_y(x) & = M_y(x) + M_{Ay} - (M_{Ay}+M_{By}) \cdot x/L\nonumber\\
+      // M_z(x) & = M_z(x) + M_{Az} - (M_{Az}+M_{Bz}) \cdot x/L
+      // \end{align*}\begin{verbatim}
+      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
+                                                                     0,
+                                                                     num),
+                                       0.,
+                                       l,
+                                       ax2[0],
+                                       -(ax2[0] + ax2[6]) / l,
+                                       0., 0., 0., 0., 0.,
+                                       l_debut),
+           false,
+           FREE_ALL)
+      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
+                                                                     1,
+                                                                     num),
+                                       0.,
+                                       l,
+                                       ax2[1],
+                                       -(ax2[1] + ax2[7]) / l,
+                                       0., 0., 0., 0., 0.,
+                                       l_debut),
+           false,
+           FREE_ALL)
+      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
+                                                                     2,
+                                                                     num),
+                                       0.,
+                                       l,
+                                       ax2[2],
+                                       -(ax2[2] + ax2[8]) / l,
+                                       0., 0., 0., 0., 0.,
+                                       l_debut),
+           false,
+           FREE_ALL)
+      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
+                                                                     3,
+                                                                     num),
+                                       0.,
+                                       l,
+                                       ax2[3],
+                                       -(ax2[3] + ax2[9]) / l,
+                                       0., 0., 0., 0., 0.,
+                                       l_debut),
+           false,
+           FREE_ALL)
+      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
+                                                                     4,
+                                                                     num),
+                                       0.,
+                                       l,
+                                       ax2[4],
+                                       -(ax2[4] + ax2[10]) / l,
+                                       0., 0., 0., 0., 0.,
+                                       l_debut),
+           false,
+           FREE_ALL)
+      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
+                                                                     5,
+                                                                     num),
+                                       0.,
+                                       l,
+                                       ax2[5],
+                                       -(ax2[5] + ax2[11]) / l,
+                                       0., 0., 0., 0., 0.,
+                                       l_debut),
+           false,
+           FREE_ALL)
+      
+  //     Ajout des déplacements & rotations entre deux noeuds dus à leur
+  //     déplacement relatif, la courbe vient s'ajouter à la courbe (si
+  //     existante) déja définie précédemment.
+  //     Dans le cas d'une section constante, la déformée en x est obtenue par
+  //     intégration de la courbe d'effort normal et la déformée en y et z est
+  //     obtenue par double intégration de la courbe des moments. Les deux
+  //     constantes sont obtenues par la connaissance des déplacements en x=0
+  //     et x=l. Les rotations (ry et rz) sont obtenues par la dérivée de la
+  //     flèche. La rotation rx est obtenue par intégration du moment en x. La
+  //     constante est déterminée pour f(0) égal à la rotation au noeud à
+  //     gauche s'il n'y a pas de relachement (sinon f(l) égal à la rotation à
+  //     droite).\end{verbatim}\begin{align*}
+  //        f_x(x) = & u_A - \frac{F_{Ax}}{E \cdot S} \cdot x + \frac{F_{Ax} +
+  //                   F_{Bx}}{2 \cdot E \cdot S \cdot L} \cdot x^2 \nonumber\\
+  //        f_y(x) = & v_A + A \cdot x - \frac{M_{Az}}{2 \cdot E \cdot I_z}
+  //                 \cdot x^2 + \frac{M_{Az}+M_{Bz}}{6 \cdot L \cdot E \cdot
+  //                                   I_z} \cdot x^3 \text{ avec } \nonumber\\
+  //             & \text{A tel que } f_y(l)=v_B \text{ soit } A = \frac{M_{Az}
+  //             \cdot L}{2*E*Iz}-\frac{(M_{Az}+M_{Bz}) \cdot L}{6*E*Iz} +
+  //                                             \frac{-v_A+v_B}{L} \nonumber\\
+  //        f_z(x) = & w_A + B \cdot x + \frac{M_{Ay}}{2 \cdot E \cdot I_y}
+  //                 \cdot x^2 - \frac{M_{Ay}+M_{By}}{6 \cdot L \cdot E \cdot
+  //                 I_y} \cdot x^3 \text{ avec } \nonumber\\
+  //             & \text{B tel que } f_z(l)=w_B \text{ soit } B = -\frac{M_{Ay}
+  //             \cdot L}{2*E*I_y}+\frac{(M_{Ay}+M_{By}) \cdot L}{6*E*I_y} +
+  //                                             \frac{-w_A+w_B}{L} \nonumber\\
+  //        r_x(x) = & C - \frac{M_{Ax}}{G \cdot J} \cdot x + \frac{M_{Ax} +
+  //                 M_{Bx}}{2 \cdot G \cdot J \cdot L} \cdot x^2 \text{ avec }
+  //                 \nonumber\\ & \text{C tel que } r_x(l)=\theta_{Bx}  
+  //                 \text{ soit } C = \frac{M_{Ax} \cdot L}{G \cdot J} -
+  //                 \frac{(M_{Ax}+M_{Bx}) \cdot L}{2 \cdot G \cdot J}+
+  //                 \theta_{Bx} \nonumber\\
+  //             & \text{C tel que } r_x(0)=\theta_{Ax}  \text{ soit }
+  //             C = \theta_{Ax} \nonumber\\
+  //             & \text{Solution 1 si le noeud A n'est pas encastrée et solution 2 si le noeud B n'est pas encastrée} \nonumber\\
+  //        r_y(x) = & -B - \frac{M_{Ay}}{E \cdot I_y} \cdot x + \frac{M_{Ay} +
+  //                 M_{By}}{2 \cdot L \cdot E \cdot I_y} \cdot x^2 \nonumber\\
+  //        r_z(x) = & A - \frac{M_{Az}}{E \cdot I_z} \cdot x + \frac{M_{Az} +
+  //                             M_{Bz}}{2 \cdot L \cdot E \cdot I_z} \cdot x^2
+
+          BUG (common_fonction_ajout_poly (
+                 _1990_action_deformation_renvoie (action, 0, num),
+                 0.,
+                 l,
+                 ax[0],
+                 -ax2[0] / (E * S),
+                 (ax2[0] + ax2[6]) / (2 * E * S * l),
+                 0., 0., 0., 0.,
+                 l_debut),
+               false,
+               FREE_ALL)
+          BUG (common_fonction_ajout_poly (
+                 _1990_action_deformation_renvoie (action, 1, num),
+                 0.,
+                 l,
+                 ax[1],
+                 (ax2[5] / (2 * E * Iz) * l * l -
+                   (ax2[5] + ax2[11]) / (6 * E * Iz) * l * l -
+                   ax[1] + ax[7]) / l,
+                 -ax2[5] / (2 * E * Iz),
+                 (ax2[5] + ax2[11]) / (6 * l * E * Iz),
+                 0., 0., 0.,
+                 l_debut),
+               false,
+               FREE_ALL)
+          BUG (common_fonction_ajout_poly (
+                 _1990_action_deformation_renvoie (action, 2, num),
+                 0.,
+                 l,
+                 ax[2],
+                 (-ax2[4] / (2 * E * Iy) * l * l +
+                   (ax2[4] + ax2[10]) / (6 * E * Iy) * l * l -
+                   ax[2] + ax[8]) / l,
+                 ax2[4] / (2 * E * Iy),
+                 -(ax2[4] + ax2[10]) / (6 * l * E * Iy),
+                 0., 0., 0.,
+                 l_debut),
+               false,
+               FREE_ALL)
+          if ((j == 0) &&
+              (element->relachement != NULL) &&
+              (element->relachement->rx_debut != EF_RELACHEMENT_BLOQUE))
+          {
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_rotation_renvoie (action, 0, num),
+                   0.,
+                   l,
+                   ax2[3] / (G * J) * l -
+                     (ax2[3] + ax2[9]) / (2 * G * J * l) * l * l + ax[9],
+                   -ax2[3] / (G * J),
+                   (ax2[3] + ax2[9]) / (2 * G * J * l),
+                   0., 0., 0., 0.,
+                   l_debut),
+                 false,
+                 FREE_ALL)
+          }
+          else
+          {
+            BUG (common_fonction_ajout_poly (
+                   _1990_action_rotation_renvoie (action, 0, num),
+                   0.,
+                   l,
+                   ax[3],
+                   -ax2[3] / (G * J),
+                   (ax2[3] + ax2[9]) / (2 * G * J * l),
+                   0., 0., 0., 0.,
+                   l_debut),
+                 false,
+                 FREE_ALL)
+          }
+          BUG (common_fonction_ajout_poly (
+                 _1990_action_rotation_renvoie (action, 1, num),
+                 0.,
+                 l,
+                 -(-ax2[4] / (2 * E * Iy) * l * l +
+                   (ax2[4] + ax2[10]) / (6 * E * Iy) * l * l -
+                   ax[2] + ax[8]) / l,
+                 -ax2[4] / (E * Iy),
+                 (ax2[4] + ax2[10]) / (2 * l * E * Iy),
+                 0., 0., 0., 0.,
+                 l_debut),
+               false,
+               FREE_ALL)
+          BUG (common_fonction_ajout_poly (
+                 _1990_action_rotation_renvoie (action, 2, num),
+                 0.,
+                 l,
+                 (ax2[5] / (2 * E * Iz) * l * l +
+                   (-ax2[5] - ax2[11]) / (6 * E * Iz) * l * l -
+                   ax[1] + ax[7]) / l,
+                 -ax2[5] / (E * Iz),
+                 (ax2[5] + ax2[11]) / (2 * l * E * Iz),
+                 0., 0., 0., 0.,
+                 l_debut),
+               false,
+               FREE_ALL)
+  //        \end{align*}\begin{verbatim}
+      
+#undef FREE_ALL
+    }
+  //   FinPour
+    ++it;
+  }
+  // FinPour
+  cholmod_free_triplet (&t_dep_tot, p->calculs.c);
+  
+  return true;
+}
+
+
+/**
+ * \brief Calcule {y} = [A]{x} pour une matrice sparse complète (stype = 0).
+ * \param m : la matrice,
+ * \param x : le vecteur de m->ncol valeurs,
+ * \param y : le résultat de m->nrow valeurs.
+ * \return Rien.
+ */
+static void
+EF_calculs_produit (cholmod_sparse *m,
+                    const double   *x,
+                    double         *y)
+{
+  int    *ap = (int *) m->p; // NS
+  int    *ai = (int *) m->i; // NS
+  double *ax = (double *) m->x;
+  size_t  j;
+  int     q; // NS
+  
+  memset (y, 0, sizeof (double) * m->nrow);
+  for (j = 0; j < m->ncol; j++)
+  {
+    for (q = ap[j]; q < ap[j + 1]; q++)
+    {
+      y[ai[q]] += ax[q] * x[j];
+    }
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Applique le préconditionneur du gradient conjugué : {z} = [M]^-1{r}.
+ * \param p : la variable projet,
+ * \param r : le résidu,
+ * \param z : le résultat.
+ * \return Rien.
+ */
+static void
+EF_calculs_precond_applique (Projet       *p,
+                             const double *r,
+                             double       *z)
+{
+  size_t   n = p->calculs.m_part->nrow;
+  double  *px = p->calculs.precond_x;
+  uint32_t i, j;
+  
+  switch (p->calculs.precond_utilise)
+  {
+    case EF_PRECOND_JACOBI :
+    {
+      for (i = 0; i < n; i++)
+      {
+        z[i] = px[i] * r[i];
+      }
+      break;
+    }
+    case EF_PRECOND_BLOC_JACOBI :
+    {
+      for (i = 0; i < p->calculs.nb_noeuds; i++)
+      {
+        double  *bloc = &px[i * 36];
+        uint32_t ddl[6];
+        uint8_t  nb = 0, r2, c;
+        
+        for (j = 0; j < 6; j++)
+        {
+          if (p->calculs.n_part[i][j] < n)
+          {
+            ddl[nb] = p->calculs.n_part[i][j];
+            nb++;
           }
+        }
+        for (r2 = 0; r2 < nb; r2++)
+        {
+          double somme = 0.;
           
-          break;
+          for (c = 0; c < nb; c++)
+          {
+            somme += bloc[c * 6 + r2] * r[ddl[c]];
+          }
+          z[ddl[r2]] = somme;
+        }
+      }
+      break;
+    }
+    case EF_PRECOND_CHOLESKY_INCOMPLET :
+    {
+      int *pl = p->calculs.precond_p; // NS
+      int *il = p->calculs.precond_i; // NS
+      int  q; // NS
+      
+      // Descente [L]{y} = {r} puis remontée [L]^T{z} = {y}.
+      memcpy (z, r, sizeof (double) * n);
+      for (j = 0; j < n; j++)
+      {
+        z[j] /= px[pl[j]];
+        for (q = pl[j] + 1; q < pl[j + 1]; q++)
+        {
+          z[il[q]] -= px[q] * z[j];
+        }
+      }
+      for (j = n; j > 0; j--)
+      {
+        for (q = pl[j - 1] + 1; q < pl[j]; q++)
+        {
+          z[j - 1] -= px[q] * z[il[q]];
+        }
+        z[j - 1] /= px[pl[j - 1]];
+      }
+      break;
+    }
+    default :
+    {
+      FAILCRIT ( ,
+                (gettext ("Préconditionneur %d inconnu.\n"),
+                          p->calculs.precond_utilise); )
+      break;
+    }
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Résout [K]{D} = {F} par la méthode du gradient conjugué
+ *        préconditionné pour nb seconds membres stockés les uns à la suite des
+ *        autres. Seuls quatre vecteurs de travail de nrow valeurs sont
+ *        alloués. Le nombre d'itérations et le résidu relatif obtenus sont
+ *        ajoutés au rapport p->calculs.rapport.
+ * \param p : la variable projet,
+ * \param for_part : les seconds membres,
+ * \param dep_part : les déplacements (solutions),
+ * \param nb : le nombre de colonnes.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - le produit {d}^T[K]{d} est négatif ou nul (matrice non définie
+ *       positive).
+ */
+static bool
+EF_calculs_resoud_gc (Projet  *p,
+                      double  *for_part,
+                      double  *dep_part,
+                      uint32_t nb)
+{
+  size_t   n = p->calculs.m_part->nrow;
+  uint32_t iter_max, iter_tot = 0, iter_pire = 0;
+  double   rel_pire = 0.;
+  bool     converge = true;
+  double  *r, *z, *d, *q;
+  uint32_t k;
+  size_t   i;
+  
+  if (p->calculs.gc_iter_max == 0)
+  {
+    iter_max = (uint32_t) n;
+  }
+  else
+  {
+    iter_max = p->calculs.gc_iter_max;
+  }
+  
+  r = new double [n];
+  z = new double [n];
+  d = new double [n];
+  q = new double [n];
+#define FREE_ALL delete [] r; delete [] z; delete [] d; delete [] q;
+  
+  // Pour chaque second membre
+  for (k = 0; k < nb; k++)
+  {
+    double  *b = &for_part[k * n];
+    double  *x = &dep_part[k * n];
+    double   norme_b = 0., norme_r, rz, rz2, dq;
+    uint32_t iter;
+    
+  //   {x} = 0, {r} = {b}, {z} = [M]^-1{r}, {d} = {z}
+    memset (x, 0, sizeof (double) * n);
+    memcpy (r, b, sizeof (double) * n);
+    for (i = 0; i < n; i++)
+    {
+      norme_b += b[i] * b[i];
+    }
+    norme_b = sqrt (norme_b);
+    if (norme_b == 0.)
+    {
+      continue;
+    }
+    EF_calculs_precond_applique (p, r, z);
+    memcpy (d, z, sizeof (double) * n);
+    rz = 0.;
+    for (i = 0; i < n; i++)
+    {
+      rz += r[i] * z[i];
+    }
+    norme_r = norme_b;
+    
+  //   Tant que ||r|| > tolérance.||b|| Faire
+  //     alpha = {r}^T{z} / {d}^T[K]{d}
+  //     {x} = {x} + alpha.{d}, {r} = {r} - alpha.[K]{d}
+  //     {z} = [M]^-1{r}, beta = {r}^T{z} / {r_prec}^T{z_prec}
+  //     {d} = {z} + beta.{d}
+  //   FinTantQue
+    for (iter = 0;
+         (iter < iter_max) && (norme_r > p->calculs.gc_tolerance * norme_b);
+         iter++)
+    {
+      double alpha, beta;
+      
+      EF_calculs_produit (p->calculs.m_part, d, q);
+      dq = 0.;
+      for (i = 0; i < n; i++)
+      {
+        dq += d[i] * q[i];
+      }
+      BUGCRIT (dq > 0.,
+               false,
+               (gettext ("Erreur de calcul : la matrice de rigidité n'est pas définie positive.\n"));
+                 FREE_ALL)
+      alpha = rz / dq;
+      norme_r = 0.;
+      for (i = 0; i < n; i++)
+      {
+        x[i] += alpha * d[i];
+        r[i] -= alpha * q[i];
+        norme_r += r[i] * r[i];
+      }
+      norme_r = sqrt (norme_r);
+      
+      EF_calculs_precond_applique (p, r, z);
+      rz2 = 0.;
+      for (i = 0; i < n; i++)
+      {
+        rz2 += r[i] * z[i];
+      }
+      beta = rz2 / rz;
+      rz = rz2;
+      for (i = 0; i < n; i++)
+      {
+        d[i] = z[i] + beta * d[i];
+      }
+    }
+    
+    if (norme_r > p->calculs.gc_tolerance * norme_b)
+    {
+      converge = false;
+    }
+    iter_tot += iter;
+    iter_pire = std::max (iter_pire, iter);
+    rel_pire = std::max (rel_pire, norme_r / norme_b);
+    
+  //   Résidu non relatif : {r} = [K]{D} - {F}
+    EF_calculs_produit (p->calculs.m_part, x, r);
+    for (i = 0; i < n; i++)
+    {
+      p->calculs.residu = std::max (p->calculs.residu, fabs (r[i] - b[i]));
+    }
+  }
+  // FinPour
+  
+#undef FREE_ALL
+  delete [] r;
+  delete [] z;
+  delete [] d;
+  delete [] q;
+  
+  EF_calculs_rapport_ajout (
+    p,
+    format (gettext ("Gradient conjugué préconditionné (%s)"),
+            p->calculs.precond_utilise == EF_PRECOND_JACOBI ?
+              gettext ("Jacobi") :
+            p->calculs.precond_utilise == EF_PRECOND_BLOC_JACOBI ?
+              gettext ("Jacobi par blocs") :
+              gettext ("Cholesky incomplet")),
+    converge ? 0 : 1,
+    format (gettext ("%u itérations au total, %u au maximum pour une action. Résidu relatif maximal : %g (tolérance : %g). Résidu non relatif : %g."),
+            iter_tot,
+            iter_pire,
+            rel_pire,
+            p->calculs.gc_tolerance,
+            p->calculs.residu));
+  
+  return true;
+}
+
+
+/**
+ * \brief Résout [L] [L]^T {z} = {r} avec le facteur en simple précision de
+ *        #EF_calculs_genere_mixte. Les descentes et remontées sont cumulées
+ *        en double précision.
+ * \param p : la variable projet,
+ * \param r : le second membre (m_part->nrow valeurs),
+ * \param z : la solution (m_part->nrow valeurs),
+ * \param y : vecteur de travail (m_part->nrow valeurs).
+ * \return Rien.
+ */
+static void
+EF_calculs_mixte_applique (Projet *p,
+                           double *r,
+                           double *z,
+                           double *y)
+{
+  size_t    n = p->calculs.m_part->nrow;
+  float    *l = p->calculs.mixte_x;
+  size_t   *pos = p->calculs.mixte_pos;
+  uint32_t *ligne = p->calculs.mixte_ligne;
+  int      *perm = p->calculs.mixte_perm; // NS
+  size_t    a, q;
+  
+  // Descente [L] {y} = [P] {r} par colonnes puis remontée [L]^T {y} = {y}
+  // par produits scalaires, {z} = [P]^T {y}.
+  for (a = 0; a < n; a++)
+  {
+    y[a] = r[perm[a]];
+  }
+  for (a = 0; a < n; a++)
+  {
+    y[a] = y[a] / l[pos[a]];
+    for (q = pos[a] + 1; q < pos[a + 1]; q++)
+    {
+      y[ligne[q]] -= (double) l[q] * y[a];
+    }
+  }
+  for (a = n; a-- > 0; )
+  {
+    double somme = y[a];
+    
+    for (q = pos[a] + 1; q < pos[a + 1]; q++)
+    {
+      somme -= (double) l[q] * y[ligne[q]];
+    }
+    y[a] = somme / l[pos[a]];
+    z[perm[a]] = y[a];
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Résout [K]{D} = {F} avec la factorisation en simple précision et
+ *        un raffinement itératif en double précision pour nb seconds membres
+ *        stockés les uns à la suite des autres :\end{verbatim}
+ *        \begin{align*}
+ *        \{r\} & = [K] \cdot \{D\} - \{F\}\\
+ *        \{D\} & = \{D\} - ([L] [L]^T)^{-1} \cdot \{r\}
+ *        \end{align*}\begin{verbatim}
+ *        Le résidu est calculé en double précision sur m_part, selon la même
+ *        norme que #EF_calculs_resid. Le raffinement s'arrête lorsque le
+ *        résidu relatif passe sous p->calculs.mixte_tolerance, lorsqu'il ne
+ *        diminue plus au moins de moitié ou après p->calculs.mixte_iter_max
+ *        itérations.
+ * \param p : la variable projet,
+ * \param for_part : les seconds membres,
+ * \param dep_part : les déplacements (solutions),
+ * \param nb : le nombre de colonnes.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - erreur de calcul.
+ */
+static bool
+EF_calculs_resoud_mixte (Projet  *p,
+                         double  *for_part,
+                         double  *dep_part,
+                         uint32_t nb)
+{
+  cholmod_sparse *m = p->calculs.m_part;
+  size_t          n = m->nrow;
+  uint32_t        iter_pire = 0;
+  double          rel_pire = 0.;
+  double         *r, *z, *y;
+  uint32_t        k;
+  size_t          i;
+  
+  r = new double [n];
+  z = new double [n];
+  y = new double [n];
+  
+  // Pour chaque second membre
+  for (k = 0; k < nb; k++)
+  {
+    double  *b = &for_part[k * n];
+    double  *x = &dep_part[k * n];
+    double   norme_b = 0., norme_r, norme_prec;
+    uint32_t iter;
+    
+  //   {x} = 0, {r} = -{b}
+    memset (x, 0, sizeof (double) * n);
+    for (i = 0; i < n; i++)
+    {
+      r[i] = -b[i];
+      norme_b = std::max (norme_b, fabs (b[i]));
+    }
+    if (norme_b == 0.)
+    {
+      continue;
+    }
+    norme_r = norme_b;
+    
+  //   Tant que le résidu diminue et reste supérieur à la tolérance Faire
+  //     {x} = {x} - ([L][L]^T)^-1 {r}
+  //     {r} = [K]{x} - {b}
+  //   FinTantQue
+    iter = 0;
+    do
+    {
+      EF_calculs_mixte_applique (p, r, z, y);
+      for (i = 0; i < n; i++)
+      {
+        x[i] -= z[i];
+      }
+      norme_prec = norme_r;
+      norme_r = EF_calculs_resid_vecteur ((int *) m->p,
+                                          (int *) m->i,
+                                          (double *) m->x,
+                                          b,
+                                          n,
+                                          x,
+                                          r);
+      iter++;
+    }
+    while ((iter < p->calculs.mixte_iter_max) &&
+           (norme_r > p->calculs.mixte_tolerance * norme_b) &&
+           (norme_r < 0.5 * norme_prec));
+    
+    iter_pire = std::max (iter_pire, iter);
+    rel_pire = std::max (rel_pire, norme_r / norme_b);
+    p->calculs.residu = std::max (p->calculs.residu, norme_r);
+  }
+  // FinPour
+  
+  delete [] r;
+  delete [] z;
+  delete [] y;
+  
+  EF_calculs_rapport_ajout (
+    p,
+    gettext ("Raffinement itératif en double précision"),
+    rel_pire > p->calculs.mixte_tolerance ? 1 : 0,
+    format (gettext ("%u itérations au maximum pour une action. Résidu relatif maximal : %g (tolérance : %g). Résidu non relatif : %g."),
+            iter_pire,
+            rel_pire,
+            p->calculs.mixte_tolerance,
+            p->calculs.residu));
+  
+  return true;
+}
+
+
+/// Nombre de seconds membres résolus ensemble avec la factorisation LU.
+#define NB_COLONNES_LU 16U
+
+/**
+ * \brief Résout nb seconds membres avec les facteurs de la décomposition LU
+ *        d'UMFPACK (P.R.A.Q = L.U). Les colonnes sont entrelacées dans y afin
+ *        que chaque terme des facteurs ne soit lu qu'une fois pour toutes les
+ *        colonnes. b et x peuvent désigner le même tableau.
+ * \param n : le nombre de lignes,
+ * \param lp : L stockée par ligne, pointeurs de début de ligne,
+ * \param lj : L stockée par ligne, numéro de colonne,
+ * \param lx : L stockée par ligne, valeurs,
+ * \param up : U stockée par colonne, pointeurs de début de colonne,
+ * \param ui : U stockée par colonne, numéro de ligne,
+ * \param ux : U stockée par colonne, valeurs,
+ * \param pp : la permutation des lignes,
+ * \param qq : la permutation des colonnes,
+ * \param dx : la diagonale de U,
+ * \param rs : le facteur d'échelle de chaque ligne,
+ * \param b : les seconds membres (n valeurs par colonne),
+ * \param x : les solutions (n valeurs par colonne),
+ * \param nb : le nombre de colonnes, au plus NB_COLONNES_LU,
+ * \param y : espace de travail de n × nb réels.
+ * \return Rien.
+ */
+static void
+EF_calculs_resoud_lu_paquet (size_t        n,
+                             const int    *lp,
+                             const int    *lj,
+                             const double *lx,
+                             const int    *up,
+                             const int    *ui,
+                             const double *ux,
+                             const int    *pp,
+                             const int    *qq,
+                             const double *dx,
+                             const double *rs,
+                             const double *b,
+                             double       *x,
+                             uint32_t      nb,
+                             double       *y)
+{
+  size_t   i, j;
+  uint32_t k;
+  int      q; // NS
+  
+  // {y} = [P].[R].{b}
+  for (i = 0; i < n; i++)
+  {
+    for (k = 0; k < nb; k++)
+    {
+      y[i * nb + k] = rs[pp[i]] * b[(size_t) k * n + (size_t) pp[i]];
+    }
+  }
+  
+  // Descente : [L].{y} = {y}, L étant à diagonale unité.
+  for (i = 0; i < n; i++)
+  {
+    for (q = lp[i]; q < lp[i + 1]; q++)
+    {
+      j = (size_t) lj[q];
+      if (j != i)
+      {
+        for (k = 0; k < nb; k++)
+        {
+          y[i * nb + k] -= lx[q] * y[j * nb + k];
         }
-  //   FinSi
-        /* Charge inconnue */
-        default :
+      }
+    }
+  }
+  
+  // Remontée : [U].{y} = {y}.
+  for (j = n; j-- > 0; )
+  {
+    for (k = 0; k < nb; k++)
+    {
+      y[j * nb + k] /= dx[j];
+    }
+    for (q = up[j]; q < up[j + 1]; q++)
+    {
+      i = (size_t) ui[q];
+      if (i != j)
+      {
+        for (k = 0; k < nb; k++)
         {
-          FAILCRIT (false,
-                    (gettext ("Type de charge %d inconnu.\n"), charge->type); )
-          break;
+          y[i * nb + k] -= ux[q] * y[j * nb + k];
         }
       }
+    }
+  }
+  
+  // {x} = [Q].{y}
+  for (j = 0; j < n; j++)
+  {
+    for (k = 0; k < nb; k++)
+    {
+      x[(size_t) k * n + (size_t) qq[j]] = y[j * nb + k];
+    }
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Résout [K]{D} = {F} pour nb seconds membres avec la factorisation LU.
+ *        UMFPACK ne disposant pas de résolution à plusieurs seconds membres,
+ *        les facteurs sont extraits une seule fois puis les colonnes sont
+ *        résolues par paquets de NB_COLONNES_LU, suivies d'une étape de
+ *        raffinement itératif par paquet. p->calculs.residu contient le
+ *        résidu maximal obtenu.
+ * \param p : la variable projet,
+ * \param for_part : les seconds membres,
+ * \param dep_part : les déplacements (solutions),
+ * \param nb : le nombre de colonnes.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - erreur de calcul.
+ */
+static bool
+EF_calculs_resoud_lu (Projet  *p,
+                      double  *for_part,
+                      double  *dep_part,
+                      uint32_t nb)
+{
+  size_t   n = p->calculs.m_part->nrow;
+  int      lnz, unz, n_row, n_col, nz_udiag, do_recip, status; // NS
+  int     *lp, *lj, *up, *ui, *pp, *qq; // NS
+  double  *lx, *ux, *dx, *rs, *y, *r;
+  size_t   i;
+  uint32_t k, k0;
+  
+  status = umfpack_di_get_lunz (&lnz,
+                                &unz,
+                                &n_row,
+                                &n_col,
+                                &nz_udiag,
+                                p->calculs.numeric);
+  BUGCRIT (status == UMFPACK_OK,
+           false,
+           (gettext ("Erreur de calcul : %d\n"), status); )
+  
+  lp = new int [n + 1];
+  lj = new int [lnz];
+  lx = new double [lnz];
+  up = new int [n + 1];
+  ui = new int [unz];
+  ux = new double [unz];
+  pp = new int [n];
+  qq = new int [n];
+  dx = new double [n];
+  rs = new double [n];
+  y = new double [n * NB_COLONNES_LU];
+  r = new double [n * NB_COLONNES_LU];
+  
+#define FREE_ALL delete [] lp; delete [] lj; delete [] lx; delete [] up; \
+  delete [] ui; delete [] ux; delete [] pp; delete [] qq; delete [] dx; \
+  delete [] rs; delete [] y; delete [] r;
+  
+  status = umfpack_di_get_numeric (lp,
+                                   lj,
+                                   lx,
+                                   up,
+                                   ui,
+                                   ux,
+                                   pp,
+                                   qq,
+                                   dx,
+                                   &do_recip,
+                                   rs,
+                                   p->calculs.numeric);
+  BUGCRIT (status == UMFPACK_OK,
+           false,
+           (gettext ("Erreur de calcul : %d\n"), status);
+             FREE_ALL)
+  
+  // rs devient le multiplicateur de chaque ligne de [K].
+  if (do_recip == 0)
+  {
+    for (i = 0; i < n; i++)
+    {
+      rs[i] = 1. / rs[i];
+    }
+  }
+  for (i = 0; i < n; i++)
+  {
+    if (dx[i] == 0.)
+    {
+      printf (gettext ("Attention, matrice singulière.\n"
+                "Il est possible que la modélisation ne soit pas stable.\n"));
+      break;
+    }
+  }
+  
+  // Pour chaque paquet de colonnes
+  //   Résolution.
+  //   Raffinement : {r} = [K]{D} - {F}, {D} = {D} - [K]^-1 {r}.
+  //   Calcul du résidu final.
+  // FinPour
+  for (k0 = 0; k0 < nb; k0 += NB_COLONNES_LU)
+  {
+    uint32_t nb_k = std::min (NB_COLONNES_LU, nb - k0);
+    double  *b = &for_part[(size_t) k0 * n];
+    double  *x = &dep_part[(size_t) k0 * n];
+    
+    EF_calculs_resoud_lu_paquet (n,
+                                 lp, lj, lx,
+                                 up, ui, ux,
+                                 pp, qq, dx, rs,
+                                 b, x, nb_k, y);
+    for (k = 0; k < nb_k; k++)
+    {
+      EF_calculs_resid_vecteur (p->calculs.ap,
+                                p->calculs.ai,
+                                p->calculs.ax,
+                                &b[(size_t) k * n],
+                                n,
+                                &x[(size_t) k * n],
+                                &r[(size_t) k * n]);
+    }
+    EF_calculs_resoud_lu_paquet (n,
+                                 lp, lj, lx,
+                                 up, ui, ux,
+                                 pp, qq, dx, rs,
+                                 r, r, nb_k, y);
+    for (i = 0; i < n * nb_k; i++)
+    {
+      x[i] -= r[i];
+    }
+    for (k = 0; k < nb_k; k++)
+    {
+      double residu;
       
-      ++it3;
+      residu = EF_calculs_resid_vecteur (p->calculs.ap,
+                                         p->calculs.ai,
+                                         p->calculs.ax,
+                                         &b[(size_t) k * n],
+                                         n,
+                                         &x[(size_t) k * n],
+                                         &r[(size_t) k * n]);
+      p->calculs.residu = std::max (p->calculs.residu, residu);
+    }
+  }
+  
+  FREE_ALL
+  
+#undef FREE_ALL
+  
+  return true;
+}
+
+
+/**
+ * \brief Résout [K]{D} = {F} pour nb seconds membres stockés les uns à la
+ *        suite des autres (nrow valeurs par colonne). Avec la factorisation
+ *        de Cholesky, le bloc est résolu en une seule fois par CHOLMOD. Avec
+ *        la factorisation LU, il est résolu par paquets de colonnes
+ *        (#EF_calculs_resoud_lu). p->calculs.residu contient
+ *        le résidu maximal obtenu.
+ * \param p : la variable projet,
+ * \param for_part : les seconds membres,
+ * \param dep_part : les déplacements (solutions),
+ * \param nb : le nombre de colonnes.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - erreur de calcul.
+ */
+static bool
+EF_calculs_resoud_bloc (Projet  *p,
+                        double  *for_part,
+                        double  *dep_part,
+                        uint32_t nb)
+{
+  size_t n = p->calculs.m_part->nrow;
+  
+  p->calculs.residu = 0.;
+  if (n == 0)
+  {
+    return true;
+  }
+  
+  if (p->calculs.precond_x != NULL)
+  {
+    BUG (EF_calculs_resoud_gc (p, for_part, dep_part, nb), false)
+    
+    return true;
+  }
+  
+  if (p->calculs.sous_structures != NULL)
+  {
+    BUG (EF_sous_structures_resoud (p, for_part, dep_part, nb), false)
+    
+    return true;
+  }
+  
+  if (p->calculs.mixte_x != NULL)
+  {
+    BUG (EF_calculs_resoud_mixte (p, for_part, dep_part, nb), false)
+    
+    return true;
+  }
+  
+  if (p->calculs.factor != NULL)
+  {
+    cholmod_dense  b, d, *x, *r;
+    double         minusone[2] = {-1., 0.}, one[2] = {1., 0.};
+    double        *rx;
+    size_t         i;
+    
+    // Bloc dense décrivant les seconds membres et les solutions sans copie.
+    memset (&b, 0, sizeof (b));
+    b.nrow = n;
+    b.ncol = nb;
+    b.nzmax = n * nb;
+    b.d = n;
+    b.x = for_part;
+    b.xtype = CHOLMOD_REAL;
+    b.dtype = CHOLMOD_DOUBLE;
+    d = b;
+    d.x = dep_part;
+    
+    BUGCRIT (x = cholmod_solve (CHOLMOD_A,
+                                p->calculs.factor,
+                                &b,
+                                p->calculs.c),
+             false,
+             (gettext ("Erreur d'allocation mémoire.\n")); )
+    memcpy (dep_part, x->x, sizeof (double) * n * nb);
+    cholmod_free_dense (&x, p->calculs.c);
+    
+    // Résidu : {r} = [K]{D} - {F}
+    BUGCRIT (r = cholmod_copy_dense (&b, p->calculs.c),
+             false,
+             (gettext ("Erreur d'allocation mémoire.\n")); )
+    cholmod_sdmult (p->calculs.m_part, 0, one, minusone, &d, r, p->calculs.c);
+    rx = (double *) r->x;
+    for (i = 0; i < n * nb; i++)
+    {
+      p->calculs.residu = std::max (fabs (rx[i]), p->calculs.residu);
+    }
+    cholmod_free_dense (&r, p->calculs.c);
+    
+    return true;
+  }
+  
+  // Calcul des déplacements des noeuds :\end{verbatim}\begin{align*}
+  // \{ \Delta \}_{global} = [K]^{-1} \cdot \{ F \}_{global}\end{align*}
+  // \begin{verbatim}
+  BUG (EF_calculs_resoud_lu (p, for_part, dep_part, nb), false)
+  
+  EF_calculs_rapport_ajout (
+    p,
+    gettext ("Résolution par la factorisation LU"),
+    0,
+    format (gettext ("Résidu maximal sur les déplacements : %g."),
+            p->calculs.residu));
+  
+  return true;
+}
+
+
+/**
+ * \struct EF_Calculs_Restitution
+ * \brief Données de la restitution des déplacements internes transmises à
+ *        #EF_calculs_restitue_tache.
+ */
+typedef struct
+{
+  /// La variable projet.
+  Projet                   *p;
+  /// Les barres condensées.
+  std::vector <EF_Barre *> *barres;
+  /// Les efforts (p->calculs.nb_ddl valeurs par colonne).
+  double                   *for_part;
+  /// Les déplacements (p->calculs.nb_ddl valeurs par colonne).
+  double                   *dep_part;
+  /// Le nombre de colonnes.
+  uint32_t                  nb;
+} EF_Calculs_Restitution;
+
+
+/**
+ * \brief Tâche de #common_math_parallele restituant les déplacements
+ *        internes d'une barre condensée pour les nb colonnes.
+ * \param donnees : la restitution (EF_Calculs_Restitution),
+ * \param i : le numéro de la barre dans barres.
+ * \return true.
+ */
+static bool
+EF_calculs_restitue_tache (void  *donnees,
+                           size_t i)
+{
+  EF_Calculs_Restitution *r = (EF_Calculs_Restitution *) donnees;
+  uint32_t                k;
+  
+  for (k = 0; k < r->nb; k++)
+  {
+    EF_rigidite_condense_restitue (
+      r->p,
+      (*r->barres)[i],
+      &r->for_part[(size_t) k * r->p->calculs.nb_ddl],
+      &r->dep_part[(size_t) k * r->p->calculs.nb_ddl]);
+  }
+  
+  return true;
+}
+
+
+/**
+ * \brief Résout [K]{D} = {F} pour nb seconds membres de p->calculs.nb_ddl
+ *        valeurs. Sans condensation, équivalent à #EF_calculs_resoud_bloc.
+ *        Avec condensation, les efforts des noeuds condensés sont reportés sur
+ *        les extrémités de leur barre, le système condensé est résolu puis
+ *        les déplacements internes sont restitués barre par barre, en
+ *        répartissant les barres sur p->calculs.nb_fils fils d'exécution.
+ * \param p : la variable projet,
+ * \param for_part : les seconds membres,
+ * \param dep_part : les déplacements (solutions),
+ * \param nb : le nombre de colonnes.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - #EF_calculs_resoud_bloc.
+ */
+static bool
+EF_calculs_resoud_condense (Projet  *p,
+                            double  *for_part,
+                            double  *dep_part,
+                            uint32_t nb)
+{
+  size_t   n = p->calculs.m_part->nrow;
+  size_t   n_tot = p->calculs.nb_ddl;
+  double  *for_cond, *dep_cond;
+  uint32_t k;
+  
+  EF_Calculs_Restitution   restitution;
+  std::vector <EF_Barre *> barres;
+  std::list <EF_Barre *>::iterator it;
+  std::vector <EF_Barre *>::iterator it2;
+  
+  if (p->calculs.cond_x == NULL)
+  {
+    BUG (EF_calculs_resoud_bloc (p, for_part, dep_part, nb), false)
+    
+    return true;
+  }
+  
+  it = p->modele.barres.begin ();
+  while (it != p->modele.barres.end ())
+  {
+    if (p->calculs.cond_pos[(*it)->indice] != SIZE_MAX)
+    {
+      barres.push_back (*it);
     }
+    
+    ++it;
+  }
+  
+  // Condensation des efforts.
+  for_cond = new double [n * nb];
+  dep_cond = new double [n * nb];
+  for (k = 0; k < nb; k++)
+  {
+    memcpy (&for_cond[k * n], &for_part[k * n_tot], sizeof (double) * n);
+    for (it2 = barres.begin (); it2 != barres.end (); ++it2)
+    {
+      EF_rigidite_condense_forces (p,
+                                   *it2,
+                                   &for_part[k * n_tot],
+                                   &for_cond[k * n]);
+    }
+  }
+  
+  BUG (EF_calculs_resoud_bloc (p, for_cond, dep_cond, nb),
+       false,
+       delete [] for_cond;
+         delete [] dep_cond; )
+  for (k = 0; k < nb; k++)
+  {
+    memcpy (&dep_part[k * n_tot], &dep_cond[k * n], sizeof (double) * n);
+  }
+  delete [] for_cond;
+  delete [] dep_cond;
+  
+  // Restitution des déplacements internes. Chaque barre n'écrit que ses
+  // propres degrés de liberté : aucun verrou n'est nécessaire.
+  restitution.p = p;
+  restitution.barres = &barres;
+  restitution.for_part = for_part;
+  restitution.dep_part = dep_part;
+  restitution.nb = nb;
+  BUG (common_math_parallele (EF_calculs_restitue_tache,
+                              &restitution,
+                              barres.size (),
+                              p->calculs.nb_fils),
+       false)
+  
+  return true;
+}
+
+
+/**
+ * \brief Détermine à partir de la matrice de rigidité partielle factorisée les
+ *        déplacements et les efforts dans les noeuds pour l'action demandée
+ *        ainsi que la courbe des sollicitations dans les barres.
+ * \param p : la variable projet,
+ * \param action : l'action à résoudre.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - action == NULL,
+ *     - aucune factorisation ni préconditionneur de p->calculs,
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+bool
+EF_calculs_resoud_charge (Projet *p,
+                          Action *action)
+{
+  double *for_part, *dep_part;
+  
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (action, "%p", action, false)
+  BUGPARAM (p->calculs.numeric,
+            "%p",
+            (p->calculs.numeric != NULL) || (p->calculs.factor != NULL) ||
+              (p->calculs.precond_x != NULL) ||
+              (p->calculs.sous_structures != NULL) ||
+              (p->calculs.mixte_x != NULL),
+            false)
+  BUGPARAM (p->calculs.m_part, "%p", p->calculs.m_part, false)
+  BUGPARAM (p->calculs.m_part->nrow,
+            "%zu",
+            p->calculs.m_part->nrow != 0,
+            false)
+  
+  for_part = new double [p->calculs.nb_ddl];
+  dep_part = new double [p->calculs.nb_ddl];
+  
+#define FREE_ALL delete [] for_part; delete [] dep_part;
+  BUG (EF_calculs_resoud_charge_forces (p, action, for_part), false, FREE_ALL)
+  BUG (EF_calculs_resoud_condense (p, for_part, dep_part, 1), false, FREE_ALL)
+  BUG (EF_calculs_resoud_charge_resultats (p, action, dep_part),
+       false,
+       FREE_ALL)
+#undef FREE_ALL
+  
+  delete [] for_part;
+  delete [] dep_part;
+  
+  return true;
+}
+
+
+/**
+ * \brief Résout l'ensemble des actions du projet en une seule passe. Les
+ *        efforts de chaque action sont assemblés dans une colonne du bloc
+ *        dense p->calculs.for_bloc (nb_ddl × nombre d'actions), le bloc est
+ *        résolu avec la factorisation unique de la matrice de rigidité
+ *        partielle puis chaque action lit sa colonne de p->calculs.dep_bloc
+ *        pour déterminer ses résultats. Les deux blocs sont conservés jusqu'au
+ *        prochain #EF_calculs_free.
+ * \param p : la variable projet.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - aucune factorisation ni préconditionneur de p->calculs,
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+bool
+EF_calculs_resoud_charges (Projet *p)
+{
+  size_t   n;
+  uint32_t k;
+  
+  std::list <Action *>::iterator it;
+  
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (p->calculs.numeric,
+            "%p",
+            (p->calculs.numeric != NULL) || (p->calculs.factor != NULL) ||
+              (p->calculs.precond_x != NULL) ||
+              (p->calculs.sous_structures != NULL) ||
+              (p->calculs.mixte_x != NULL),
+            false)
+  BUGPARAM (p->calculs.m_part, "%p", p->calculs.m_part, false)
+  BUGPARAM (p->calculs.m_part->nrow,
+            "%zu",
+            p->calculs.m_part->nrow != 0,
+            false)
+  
+  n = p->calculs.nb_ddl;
+  
+  delete [] p->calculs.for_bloc;
+  delete [] p->calculs.dep_bloc;
+  p->calculs.nb_bloc = (uint32_t) p->actions.size ();
+  p->calculs.for_bloc = new double [n * p->calculs.nb_bloc];
+  p->calculs.dep_bloc = new double [n * p->calculs.nb_bloc];
+  
+  // Assemblage des efforts de chaque action dans sa colonne.
+  k = 0;
+  it = p->actions.begin ();
+  while (it != p->actions.end ())
+  {
+    BUG (EF_calculs_resoud_charge_forces (p,
+                                          *it,
+                                          &p->calculs.for_bloc[k * n]),
+         false)
+    
+    k++;
+    ++it;
   }
-  // FinPour
   
-  // On converti les données dans des structures permettant les calculs via les
-  // libraries.
-  BUGCRIT (_1990_action_forces_change (action,
-                                       cholmod_triplet_to_sparse (t_for_comp,
-                                                                  0,
-                                                                p->calculs.c)),
-           false,
-           (gettext ("Erreur d'allocation mémoire.\n"));
-             cholmod_free_triplet (&t_for_part, p->calculs.c);
-             cholmod_free_triplet (&t_for_comp, p->calculs.c); )
-  cholmod_free_triplet (&t_for_comp, p->calculs.c);
+  BUG (EF_calculs_resoud_condense (p,
+                                   p->calculs.for_bloc,
+                                   p->calculs.dep_bloc,
+                                   p->calculs.nb_bloc),
+       false)
   
-  // Calcul des déplacements des noeuds :\end{verbatim}\begin{align*}
-  // \{ \Delta \}_{global} = [K]^{-1} \cdot \{ F \}_{global}\end{align*}
-  // \begin{verbatim}
+  // Post-traitement de chaque action à partir de sa colonne de déplacements.
+  k = 0;
+  it = p->actions.begin ();
+  while (it != p->actions.end ())
+  {
+    BUG (EF_calculs_resoud_charge_resultats (p,
+                                             *it,
+                                             &p->calculs.dep_bloc[k * n]),
+         false)
+    
+    k++;
+    ++it;
+  }
   
-  BUGCRIT (t_dep_part = cholmod_allocate_triplet (p->calculs.m_part->nrow,
-                                                  1,
-                                                  p->calculs.m_part->nrow,
-                                                  0,
-                                                  CHOLMOD_REAL,
-                                                  p->calculs.c),
-           false,
-           (gettext ("Erreur d'allocation mémoire.\n"));
-             cholmod_free_triplet (&t_for_part, p->calculs.c); )
-  t_dep_part->nnz = p->calculs.m_part->nrow;
-  ai = (uint32_t *) t_dep_part->i;
-  aj = (uint32_t *) t_dep_part->j;
-  ax = (double *) t_dep_part->x;
-  if (p->calculs.m_part->nrow != 0)
-  {
-    int status; //NS
-    
-    ax2 = (double *) t_for_part->x;
-    status = umfpack_di_solve (UMFPACK_A,
-                               p->calculs.ap,
-                               p->calculs.ai,
-                               p->calculs.ax,
-                               ax,
-                               ax2,
-                               p->calculs.numeric,
-                               NULL,
-                               NULL);
-    if (status == UMFPACK_WARNING_singular_matrix)
-    {
-      printf (gettext ("Attention, matrice singulière.\n"
-                "Il est possible que la modélisation ne soit pas stable.\n"));
-    }
-    else
-    {
-      BUGCRIT (status == UMFPACK_OK,
-               false,
-               (gettext ("Erreur de calcul : %d\n"), status);
-                 cholmod_free_triplet (&t_for_part, p->calculs.c);
-                 cholmod_free_triplet (&t_dep_part, p->calculs.c); )
-    }
-    p->calculs.residu = EF_calculs_resid (p->calculs.ap,
-                                          p->calculs.ai,
-                                          p->calculs.ax,
-                                          ax2,
-                                          p->calculs.t_part->nrow,
-                                          ax);
-    BUG (!std::isnan (p->calculs.residu),
-         false,
-         cholmod_free_triplet (&t_for_part, p->calculs.c);
-           cholmod_free_triplet (&t_dep_part, p->calculs.c); )
-    printf ("Residu sur les déplacements : %g\n", p->calculs.residu);
-    for (i = 0; i <p->calculs.m_part->nrow; i++)
+  return true;
+}
+
+
+/**
+ * \brief Résout [K]{D} = {F} pour nb seconds membres quelconques avec la
+ *        factorisation (ou le préconditionneur) de la matrice de rigidité
+ *        partielle, en passant par la condensation statique si elle est
+ *        active. Les seconds membres sont stockés colonne par colonne.
+ * \param p : la variable projet,
+ * \param for_part : les efforts, nb × p->calculs.nb_ddl valeurs,
+ * \param dep_part : les déplacements, nb × p->calculs.nb_ddl valeurs,
+ * \param nb : le nombre de seconds membres.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - for_part == NULL,
+ *     - dep_part == NULL,
+ *     - aucune factorisation ni préconditionneur de p->calculs,
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+bool
+EF_calculs_resoud_forces (Projet  *p,
+                          double  *for_part,
+                          double  *dep_part,
+                          uint32_t nb)
+{
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (for_part, "%p", for_part, false)
+  BUGPARAM (dep_part, "%p", dep_part, false)
+  BUGPARAM (p->calculs.numeric,
+            "%p",
+            (p->calculs.numeric != NULL) || (p->calculs.factor != NULL) ||
+              (p->calculs.precond_x != NULL) ||
+              (p->calculs.sous_structures != NULL) ||
+              (p->calculs.mixte_x != NULL),
+            false)
+  BUGPARAM (p->calculs.m_part, "%p", p->calculs.m_part, false)
+  BUGPARAM (p->calculs.m_part->nrow,
+            "%zu",
+            p->calculs.m_part->nrow != 0,
+            false)
+  
+  BUG (EF_calculs_resoud_condense (p, for_part, dep_part, nb), false)
+  
+  return true;
+}
+
+
+/**
+ * \brief Parcourt les tronçons du modèle : pour chaque tronçon, renvoie la
+ *        barre, le numéro du tronçon dans la barre et ses deux noeuds.
+ * \param p : la variable projet,
+ * \param barres : les barres de chaque tronçon (p->calculs.nb_troncons),
+ * \param numeros : la position de chaque tronçon dans sa barre,
+ * \param noeuds : les noeuds de début et de fin de chaque tronçon
+ *                 (2 × p->calculs.nb_troncons).
+ * \return Rien.
+ */
+static void
+EF_calculs_second_ordre_troncons (Projet     *p,
+                                  EF_Barre  **barres,
+                                  uint32_t   *numeros,
+                                  EF_Noeud  **noeuds)
+{
+  std::list <EF_Barre *>::iterator it;
+  
+  it = p->modele.barres.begin ();
+  while (it != p->modele.barres.end ())
+  {
+    EF_Barre *barre = *it;
+    uint32_t  j;
+    
+    std::vector <EF_Noeud *> nds;
+    
+    nds.push_back (barre->noeud_debut);
+    nds.insert (nds.end (), barre->nds_inter.begin (), barre->nds_inter.end ());
+    nds.push_back (barre->noeud_fin);
+    for (j = 0; j + 1 < nds.size (); j++)
     {
-      ai[i] = i;
-      aj[i] = 0;
+      uint32_t t = barre->info_EF[j].troncon;
+      
+      barres[t] = barre;
+      numeros[t] = j;
+      noeuds[2 * t] = nds[j];
+      noeuds[2 * t + 1] = nds[j + 1];
     }
+    
+    ++it;
   }
-  else
-  {
-    p->calculs.residu = 0.;
-  }
-  cholmod_free_triplet (&t_for_part, p->calculs.c);
   
-  // Création du vecteur déplacement complet
-  BUGCRIT (t_dep_tot = cholmod_allocate_triplet (
-                         _1990_action_forces_renvoie(action)->nrow,
-                         1,
-                         _1990_action_forces_renvoie (action)->nrow,
-                         0,
-                         CHOLMOD_REAL,
-                         p->calculs.c),
+  return;
+}
+
+
+/**
+ * \brief Construit la structure de [K] + [K_G] : le triangle supérieur de la
+ *        matrice de rigidité partielle complété par des termes nuls pour
+ *        chaque couple de degrés de liberté libres d'un même tronçon, puis
+ *        réalise son analyse symbolique. Les deux sont conservées dans
+ *        p->calculs jusqu'au prochain #EF_calculs_free.
+ * \param p : la variable projet,
+ * \param noeuds : les noeuds de chaque tronçon
+ *                 (#EF_calculs_second_ordre_troncons).
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+static bool
+EF_calculs_second_ordre_structure (Projet    *p,
+                                   EF_Noeud **noeuds)
+{
+  cholmod_sparse  *m = p->calculs.m_part;
+  cholmod_triplet *triplet;
+  int             *ap = (int *) m->p, *ai = (int *) m->i; // NS
+  double          *ax = (double *) m->x;
+  int             *ti, *tj; // NS
+  double          *tx;
+  uint32_t         i, j, t;
+  
+  BUGCRIT (triplet = cholmod_allocate_triplet (m->nrow,
+                                               m->ncol,
+                                               (size_t) ap[m->ncol] +
+                                                 78U * p->calculs.nb_troncons,
+                                               1,
+                                               CHOLMOD_REAL,
+                                               p->calculs.c),
            false,
-           (gettext ("Erreur d'allocation mémoire.\n"));
-             cholmod_free_triplet (&t_dep_part, p->calculs.c); )
-  t_dep_tot->nnz = _1990_action_forces_renvoie (action)->nrow;
-  ai2 = (uint32_t *) t_dep_tot->i;
-  aj2 = (uint32_t *) t_dep_tot->j;
-  ax2 = (double *) t_dep_tot->x;
-  j = 0;
-  for (i = 0; i < p->modele.noeuds.size (); i++)
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  ti = (int *) triplet->i;
+  tj = (int *) triplet->j;
+  tx = (double *) triplet->x;
+  
+  // Termes de la matrice linéaire (la matrice est complète après une
+  // factorisation LU).
+  for (j = 0; j < m->ncol; j++)
   {
-    for (k = 0; k < 6; k++)
+    for (i = (uint32_t) ap[j]; i < (uint32_t) ap[j + 1]; i++)
     {
-      ai2[i * 6 + k] = i * 6 + k; aj2[i * 6 + k] = 0;
-      if (p->calculs.n_part[i][k] == UINT32_MAX)
+      if (ai[i] <= (int) j)
       {
-        ax2[i * 6 + k] = 0.;
+        ti[triplet->nnz] = ai[i];
+        tj[triplet->nnz] = (int) j;
+        tx[triplet->nnz] = ax[i];
+        triplet->nnz++;
       }
-      else
+    }
+  }
+  // Termes nuls garantissant la présence de ceux de [K_G].
+  for (t = 0; t < p->calculs.nb_troncons; t++)
+  {
+    for (j = 0; j < 12; j++)
+    {
+      uint32_t col = p->calculs.n_part[noeuds[2 * t + j / 6]->indice][j % 6];
+      
+      if (col == UINT32_MAX)
       {
-        if (ai[j] == p->calculs.n_part[i][k])
-        {
-          ax2[i * 6 + k] = ax[j];
-          j++;
-        }
-        else
+        continue;
+      }
+      for (i = 0; i < 12; i++)
+      {
+        uint32_t lig = p->calculs.n_part[noeuds[2 * t + i / 6]->indice][i % 6];
+        
+        if ((lig == UINT32_MAX) || (lig > col))
         {
-          ax2[i * 6 + k] = 0.;
+          continue;
         }
+        ti[triplet->nnz] = (int) lig;
+        tj[triplet->nnz] = (int) col;
+        tx[triplet->nnz] = 0.;
+        triplet->nnz++;
       }
     }
   }
-  cholmod_free_triplet (&t_dep_part, p->calculs.c);
-  BUGCRIT (_1990_action_deplacement_change (action,
-                                          cholmod_triplet_to_sparse (t_dep_tot,
-                                                                     0,
-                                                                p->calculs.c)),
-           false,
-           (gettext ("Erreur d'allocation mémoire.\n"));
-             cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
   
-  // Calcule des réactions d'appuis :\end{verbatim}\begin{displaymath}
-  // \{F\} = [K] \cdot \{\Delta\} - \{F_0\} \end{displaymath}\begin{verbatim}
-  BUGCRIT (sparse_tmp = cholmod_ssmult (p->calculs.m_comp,
-                                      _1990_action_deplacement_renvoie(action),
-                                        0,
-                                        true,
-                                        true,
-                                        p->calculs.c),
+  p->calculs.second_ordre_k = cholmod_triplet_to_sparse (triplet,
+                                                         triplet->nnz,
+                                                         p->calculs.c);
+  cholmod_free_triplet (&triplet, p->calculs.c);
+  BUGCRIT (p->calculs.second_ordre_k,
            false,
-           (gettext ("Erreur d'allocation mémoire.\n"));
-             cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
-  BUGCRIT (_1990_action_efforts_noeuds_change (
-             action,
-             cholmod_add (sparse_tmp,
-                          _1990_action_forces_renvoie (action),
-                          one,
-                          minusone,
-                          true,
-                          true,
-                          p->calculs.c)),
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  
+  i = (uint32_t) ((int *) p->calculs.second_ordre_k->p)[m->ncol];
+  p->calculs.second_ordre_x0 = new double [i];
+  memcpy (p->calculs.second_ordre_x0,
+          p->calculs.second_ordre_k->x,
+          sizeof (double) * i);
+  
+  BUGCRIT (p->calculs.second_ordre_factor = cholmod_analyze (
+                                                   p->calculs.second_ordre_k,
+                                                   p->calculs.c),
            false,
            (gettext ("Erreur d'allocation mémoire.\n"));
-             cholmod_free_triplet (&t_dep_tot, p->calculs.c);
-             cholmod_free_sparse (&sparse_tmp, p->calculs.c); )
-  cholmod_free_sparse (&sparse_tmp, p->calculs.c);
+             cholmod_free_sparse (&p->calculs.second_ordre_k, p->calculs.c);
+             delete [] p->calculs.second_ordre_x0;
+             p->calculs.second_ordre_x0 = NULL; )
   
-  // Pour chaque barre, ajout des efforts et déplacement dus au mouvement de
-  // l'ensemble de la structure.
-  it = p->modele.barres.begin ();
-  while (it != p->modele.barres.end ())
+  return true;
+}
+
+
+/**
+ * \brief Calcule l'effort normal moyen de chaque tronçon dû aux seuls
+ *        déplacements de ses noeuds (positif en compression) :
+ *        \end{verbatim}\begin{displaymath}
+ *        N = \frac{F_{Ax} - F_{Bx}}{2} \texttt{ avec }
+ *        \{ F \}_{local} = [K] \cdot [R]^T \cdot \{ \Delta \}_{global}
+ *        \end{displaymath}\begin{verbatim}
+ * \param p : la variable projet,
+ * \param barres : la barre de chaque tronçon,
+ * \param numeros : la position de chaque tronçon dans sa barre,
+ * \param noeuds : les noeuds de chaque tronçon,
+ * \param dep_part : les déplacements (p->calculs.nb_ddl valeurs),
+ * \param n : l'effort normal de chaque tronçon.
+ * \return Rien.
+ */
+static void
+EF_calculs_second_ordre_n (Projet     *p,
+                           EF_Barre  **barres,
+                           uint32_t   *numeros,
+                           EF_Noeud  **noeuds,
+                           double     *dep_part,
+                           double     *n)
+{
+  uint32_t t;
+  uint8_t  i;
+  
+  for (t = 0; t < p->calculs.nb_troncons; t++)
   {
-    EF_Barre *element = *it;
-    double    S = m_g (EF_sections_s (element->section));
-    size_t    num = std::distance (p->modele.barres.begin (),
-                                   std::find (p->modele.barres.begin (),
-                                              p->modele.barres.end (),
-                                              element));
+    double dep_glo[12], dep_loc[12], eff_loc[12];
     
-  //   Pour chaque discrétisation de la barre
-    for (j = 0; j <= element->nds_inter.size (); j++)
+    for (i = 0; i < 12; i++)
     {
-      EF_Noeud        *noeud_debut, *noeud_fin; // Le noeud de départ et le
-      // noeud de fin, nécessaire en cas de discrétisation
-      cholmod_sparse  *s_eff_loc;
-      double           l_debut, l_fin;
-      double           E, G;
-      cholmod_triplet *t_dep_glo;
-      cholmod_sparse  *s_dep_glo, *s_dep_loc;
-      double           l;
-      uint32_t         num_d, num_f;
-      double           J = m_g (EF_sections_j (element->section));
-      double           Iy = m_g (EF_sections_iy (element->section));
-      double           Iz = m_g (EF_sections_iz (element->section));
-      
-      BUG (!std::isnan (J),
-           false,
-           cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
-      BUG (!std::isnan (Iy),
-           false,
-           cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
-      BUG (!std::isnan (Iz),
-           false,
-           cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
-      
-      
-      // Récupération du noeud de départ et de fin de la partie discrétisée
-      if (j == 0)
-      {
-        noeud_debut = element->noeud_debut;
-      }
-      else
-      {
-        std::list <EF_Noeud *>::iterator it_t;
-        
-        it_t = element->nds_inter.begin ();
-        std::advance (it_t, j - 1);
-        noeud_debut = *it_t;
-      }
-      if (j == element->nds_inter.size ())
-      {
-        noeud_fin = element->noeud_fin;
-      }
-      else
-      {
-        std::list <EF_Noeud *>::iterator it_t;
-        
-        it_t = element->nds_inter.begin ();
-        std::advance (it_t, j);
-        noeud_fin = *it_t;
-      }
-      
-      num_d = std::distance (p->modele.noeuds.begin (),
-                             std::find (p->modele.noeuds.begin (), 
-                                        p->modele.noeuds.end (),
-                                        noeud_debut));
-      num_f = std::distance (p->modele.noeuds.begin (),
-                             std::find (p->modele.noeuds.begin (),
-                                        p->modele.noeuds.end (),
-                                        noeud_fin));
+      uint32_t ddl = p->calculs.n_part[noeuds[2 * t + i / 6]->indice][i % 6];
       
-      // Récupération des caractéristiques de la barre en fonction du matériau
-      switch (element->type)
-      {
-        case BETON_ELEMENT_POTEAU :
-        case BETON_ELEMENT_POUTRE :
-        {
-          E = m_g (EF_materiaux_E (element->materiau));
-          G = m_g (EF_materiaux_G (element->materiau, false));
-          break;
-        }
-        default :
-        {
-          FAILCRIT (false,
-                    (gettext ("Type d'élément %d inconnu.\n"), element->type);
-                      cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
-          break;
-        }
-      }
+      dep_glo[i] = ddl == UINT32_MAX ? 0. : dep_part[ddl];
+    }
+    common_math_rotation_vecteur (barres[t]->rot, true, dep_glo, dep_loc);
+    common_math_produit_12 (barres[t]->info_EF[numeros[t]].k_loc,
+                            dep_loc,
+                            eff_loc);
+    n[t] = (eff_loc[0] - eff_loc[6]) / 2.;
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Remplace les valeurs de p->calculs.second_ordre_k par
+ *        [K] + [K_G]. La matrice de rigidité géométrique de chaque tronçon,
+ *        pour un effort de traction T = -N, vaut dans le repère local pour
+ *        la flexion dans le plan xy (v_A, θ_{Az}, v_B, θ_{Bz}) :
+ *        \end{verbatim}\begin{displaymath}
+ *        [K_G] = \frac{T}{30 \cdot L} \cdot \begin{bmatrix}
+ *          36 & 3 L & -36 & 3 L \\
+ *          3 L & 4 L^2 & -3 L & -L^2 \\
+ *          -36 & -3 L & 36 & -3 L \\
+ *          3 L & -L^2 & -3 L & 4 L^2
+ *        \end{bmatrix}
+ *        \end{displaymath}\begin{verbatim}
+ *        et de même dans le plan xz avec les termes de couplage w/θy de
+ *        signe opposé.
+ * \param p : la variable projet,
+ * \param barres : la barre de chaque tronçon,
+ * \param noeuds : les noeuds de chaque tronçon,
+ * \param n : l'effort normal de chaque tronçon (positif en compression).
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - #EF_noeuds_distance.
+ */
+static bool
+EF_calculs_second_ordre_assemble (Projet     *p,
+                                  EF_Barre  **barres,
+                                  EF_Noeud  **noeuds,
+                                  double     *n)
+{
+  cholmod_sparse *k = p->calculs.second_ordre_k;
+  uint32_t        t;
+  
+  memcpy (k->x,
+          p->calculs.second_ordre_x0,
+          sizeof (double) * (size_t) ((int *) k->p)[k->ncol]);
+  
+  for (t = 0; t < p->calculs.nb_troncons; t++)
+  {
+    double  kg_loc[144], kg_glob[144];
+    double  l, c;
+    uint8_t i, j;
+    
+    if (n[t] == 0.)
+    {
+      continue;
+    }
+    l = EF_noeuds_distance (noeuds[2 * t + 1], noeuds[2 * t]);
+    BUG (!std::isnan (l), false)
+    c = -n[t] / (30. * l);
+    
+    memset (kg_loc, 0, sizeof (double) * 144);
+#define KG_LOC(I, J, V) kg_loc[(J) * 12 + (I)] = (V); \
+                        kg_loc[(I) * 12 + (J)] = (V);
+    KG_LOC (1, 1, 36. * c)
+    KG_LOC (1, 5, 3. * l * c)
+    KG_LOC (1, 7, -36. * c)
+    KG_LOC (1, 11, 3. * l * c)
+    KG_LOC (5, 5, 4. * l * l * c)
+    KG_LOC (5, 7, -3. * l * c)
+    KG_LOC (5, 11, -l * l * c)
+    KG_LOC (7, 7, 36. * c)
+    KG_LOC (7, 11, -3. * l * c)
+    KG_LOC (11, 11, 4. * l * l * c)
+    KG_LOC (2, 2, 36. * c)
+    KG_LOC (2, 4, -3. * l * c)
+    KG_LOC (2, 8, -36. * c)
+    KG_LOC (2, 10, -3. * l * c)
+    KG_LOC (4, 4, 4. * l * l * c)
+    KG_LOC (4, 8, 3. * l * c)
+    KG_LOC (4, 10, -l * l * c)
+    KG_LOC (8, 8, 36. * c)
+    KG_LOC (8, 10, 3. * l * c)
+    KG_LOC (10, 10, 4. * l * l * c)
+#undef KG_LOC
+    common_math_rotation_rigidite (barres[t]->rot, kg_loc, kg_glob);
+    
+    for (j = 0; j < 12; j++)
+    {
+      uint32_t col = p->calculs.n_part[noeuds[2 * t + j / 6]->indice][j % 6];
       
-  //     Récupération des déplacements du noeud de départ et du noeud final de
-  //     l'élément
-      BUGCRIT (t_dep_glo = cholmod_allocate_triplet (12,
-                                                     1,
-                                                     12,
-                                                     0,
-                                                     CHOLMOD_REAL,
-                                                     p->calculs.c),
-               false,
-               (gettext ("Erreur d'allocation mémoire.\n"));
-                 cholmod_free_triplet (&t_dep_tot, p->calculs.c); )
-      ai = (uint32_t *) t_dep_glo->i;
-      aj = (uint32_t *) t_dep_glo->j;
-      ax = (double *) t_dep_glo->x;
-      t_dep_glo->nnz = 12;
-      ax2 = (double *) t_dep_tot->x;
-      for (i = 0; i < 6; i++)
+      if (col == UINT32_MAX)
       {
-        ai[i] = i;
-        aj[i] = 0;
-        ax[i] = ax2[p->calculs.n_comp[num_d][i]];
+        continue;
       }
-      for (i = 0; i < 6; i++)
+      for (i = 0; i < 12; i++)
       {
-        ai[i + 6] = i + 6;
-        aj[i + 6] = 0;
-        ax[i + 6] = ax2[p->calculs.n_comp[num_f][i]];
+        uint32_t lig = p->calculs.n_part[noeuds[2 * t + i / 6]->indice][i % 6];
+        
+        if ((lig == UINT32_MAX) || (lig > col))
+        {
+          continue;
+        }
+        *EF_calculs_terme (k, lig, col) += kg_glob[j * 12 + i];
       }
-      
-  //     Conversion des déplacements globaux en déplacement locaux (u_A, v_A,
-  //     w_A, theta_{Ax}, theta_{Ay}, theta_{Az}, u_B, v_B, w_B, theta_{Bx},
-  //     theta_{By} et theta_{Bz}) : \end{verbatim}\begin{align*}
-      // \{ \Delta \}_{local} = [R]^T \cdot \{ \Delta \}_{global}\end{align*}
-      // \begin{verbatim}
-      BUGCRIT (s_dep_glo = cholmod_triplet_to_sparse (t_dep_glo,
-                                                      0,
-                                                      p->calculs.c),
-               false,
-               (gettext ("Erreur d'allocation mémoire.\n"));
-                 cholmod_free_triplet (&t_dep_tot, p->calculs.c);
-                 cholmod_free_triplet (&t_dep_glo, p->calculs.c); )
-      cholmod_free_triplet (&t_dep_glo, p->calculs.c);
-      BUGCRIT (s_dep_loc = cholmod_ssmult (element->m_rot_t,
-                                           s_dep_glo,
-                                           0,
-                                           1,
-                                           true,
-                                           p->calculs.c),
-               false,
-               (gettext ("Erreur d'allocation mémoire.\n"));
-                 cholmod_free_triplet (&t_dep_tot, p->calculs.c);
-                 cholmod_free_sparse (&s_dep_glo, p->calculs.c); )
-      cholmod_free_sparse (&s_dep_glo, p->calculs.c);
-  //     Détermination des efforts (F_{Ax}, F_{Bx}, F_{Ay}, F_{By}, F_{Az},
-  //     F_{Bz}, M_{Ax}, M_{Bx}, M_{Ay}, M_{By}, M_{Az} et M_{Bz}) dans le
-  //     repère local : \end{verbatim}\begin{align*}
-      // \{ F \}_{local} = [K] \cdot \{ \Delta \}_{local}\end{align*}
-      // \begin{verbatim}
-      BUGCRIT (s_eff_loc = cholmod_ssmult (element->info_EF[j].m_rig_loc,
-                                           s_dep_loc,
-                                           0,
-                                           1,
-                                           true,
-                                           p->calculs.c),
-               false,
-               (gettext ("Erreur d'allocation mémoire.\n"));
-                 cholmod_free_triplet (&t_dep_tot, p->calculs.c);
-                 cholmod_free_sparse (&s_dep_loc, p->calculs.c); )
-      
-#define FREE_ALL cholmod_free_triplet (&t_dep_tot, p->calculs.c); \
-  cholmod_free_sparse (&s_dep_loc, p->calculs.c); \
-  cholmod_free_sparse (&s_eff_loc, p->calculs.c);
-      
-      ax = (double *) s_dep_loc->x;
-      ax2 = (double *) s_eff_loc->x;
-      l_debut = EF_noeuds_distance (noeud_debut, element->noeud_debut);
-      l_fin = EF_noeuds_distance (noeud_fin, element->noeud_debut);
-      BUG (!std::isnan (l_debut), false, FREE_ALL)
-      BUG (!std::isnan (l_fin), false, FREE_ALL)
-      l = fabs (l_fin - l_debut);
-      
-  //     Ajout des efforts entre deux noeuds dus à leur déplacement relatif,
-  //     la courbe vient s'ajouter à la courbe (si existante) déja définie
-  //     précédemment. L'indice A correspond au noeud de départ et l'indice B
-  //     correspond au noeud final :\end{verbatim}\begin{align*}
-      // N(x) & = N(x) + F_{Ax} - (F_{Ax}+F_{Bx}) \cdot x/L\nonumber\\
-      // T_y(x) & = T_y(x) + F_{Ay} - (F_{Ay}+F_{By}) \cdot x/L\nonumber\\
-      // T_z(x) & = T_z(x) + F_{Az} - (F_{Az}+F_{Bz}) \cdot x/L\nonumber\\
-      // M_x(x) & = M_x(x) + M_{Ax} - (M_{Ax}+M_{Bx}) \cdot x/L\nonumber\\
-      // M_y(x) & = M_y(x) + M_{Ay} - (M_{Ay}+M_{By}) \cdot x/L\nonumber\\
-      // M_z(x) & = M_z(x) + M_{Az} - (M_{Az}+M_{Bz}) \cdot x/L
-      // \end{align*}\begin{verbatim}
-      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
-                                                                     0,
-                                                                     num),
-                                       0.,
-                                       l,
-                                       ax2[0],
-                                       -(ax2[0] + ax2[6]) / l,
-                                       0., 0., 0., 0., 0.,
-                                       l_debut),
-           false,
-           FREE_ALL)
-      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
-                                                                     1,
-                                                                     num),
-                                       0.,
-                                       l,
-                                       ax2[1],
-                                       -(ax2[1] + ax2[7]) / l,
-                                       0., 0., 0., 0., 0.,
-                                       l_debut),
-           false,
-           FREE_ALL)
-      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
-                                                                     2,
-                                                                     num),
-                                       0.,
-                                       l,
-                                       ax2[2],
-                                       -(ax2[2] + ax2[8]) / l,
-                                       0., 0., 0., 0., 0.,
-                                       l_debut),
-           false,
-           FREE_ALL)
-      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
-                                                                     3,
-                                                                     num),
-                                       0.,
-                                       l,
-                                       ax2[3],
-                                       -(ax2[3] + ax2[9]) / l,
-                                       0., 0., 0., 0., 0.,
-                                       l_debut),
-           false,
-           FREE_ALL)
-      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
-                                                                     4,
-                                                                     num),
-                                       0.,
-                                       l,
-                                       ax2[4],
-                                       -(ax2[4] + ax2[10]) / l,
-                                       0., 0., 0., 0., 0.,
-                                       l_debut),
-           false,
-           FREE_ALL)
-      BUG (common_fonction_ajout_poly (_1990_action_efforts_renvoie (action,
-                                                                     5,
-                                                                     num),
-                                       0.,
-                                       l,
-                                       ax2[5],
-                                       -(ax2[5] + ax2[11]) / l,
-                                       0., 0., 0., 0., 0.,
-                                       l_debut),
+    }
+  }
+  
+  return true;
+}
+
+
+/**
+ * \brief Calcul au second ordre (P-Delta) d'une action déjà résolue au
+ *        premier ordre. La matrice de rigidité géométrique due à l'effort
+ *        normal est ajoutée à chaque tronçon et l'équilibre est recherché par
+ *        itérations de point fixe (Picard) sur l'effort normal :
+ *        \end{verbatim}\begin{align*}
+ *        \{R\}_i & = \{F\} - ([K] + [K_G(N_i)]) \cdot \{D\}_i \nonumber\\
+ *        \{D\}_{i+1} & = \{D\}_i + ([K] + [K_G(N_i)])^{-1} \cdot \{R\}_i
+ *        \end{align*}\begin{verbatim}
+ *        La variation de [K_G] avec l'effort normal n'étant pas dérivée, la
+ *        matrice n'est pas la tangente et la convergence est linéaire : le
+ *        rapport entre deux corrections successives est de l'ordre du
+ *        rapport entre la charge et la charge critique.
+ *        L'effort normal d'un tronçon est celui de l'action au premier ordre
+ *        (efforts[0] en son milieu, charges sur la barre comprises) corrigé
+ *        de la variation des déplacements de ses noeuds. La structure de
+ *        [K] + [K_G] et son analyse symbolique sont construites au premier
+ *        appel et réutilisées à chaque itération et pour chaque action
+ *        (combinaison) suivante : seule la factorisation numérique est
+ *        refaite. L'historique de convergence et la durée de chaque itération
+ *        sont ajoutés au rapport d'analyse. Les résultats de l'action sont
+ *        remplacés par ceux du second ordre.\n
+ *        Cette fonction n'est pour l'instant appelée ni par l'interface ni
+ *        par #EF_calculs_resoud_charges : elle doit être appelée par
+ *        l'utilisateur de la bibliothèque après le calcul au premier ordre.
+ * \param p : la variable projet,
+ * \param action : l'action à calculer.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - action == NULL,
+ *     - action non résolue au premier ordre,
+ *     - condensation statique active,
+ *     - matrice [K] + [K_G] non définie positive (charge critique
+ *       dépassée),
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+bool
+EF_calculs_second_ordre (Projet *p,
+                         Action *action)
+{
+  EF_Barre      **barres;
+  EF_Noeud      **noeuds;
+  uint32_t       *numeros;
+  double         *n_fixe, *n;
+  double         *for_part, *dep_part, *dep_0, *residu;
+  size_t          nb, i;
+  uint32_t        t, iter;
+  bool            converge;
+  cholmod_sparse *dep_action;
+  cholmod_dense   b;
+  
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (action, "%p", action, false)
+  BUGPARAM (p->calculs.m_part, "%p", p->calculs.m_part, false)
+  INFO (_1990_action_deplacement_renvoie (action),
+        false,
+        (gettext ("L'action doit être résolue au premier ordre avant le calcul au second ordre.\n")); )
+  INFO (p->calculs.cond_x == NULL,
+        false,
+        (gettext ("Le calcul au second ordre n'est pas compatible avec la condensation statique des noeuds intermédiaires.\n")); )
+  
+  nb = p->calculs.m_part->nrow;
+  barres = new EF_Barre * [p->calculs.nb_troncons];
+  numeros = new uint32_t [p->calculs.nb_troncons];
+  noeuds = new EF_Noeud * [2U * p->calculs.nb_troncons];
+  EF_calculs_second_ordre_troncons (p, barres, numeros, noeuds);
+  
+#define FREE_ALL delete [] barres; delete [] numeros; delete [] noeuds;
+  if (p->calculs.second_ordre_k == NULL)
+  {
+    BUG (EF_calculs_second_ordre_structure (p, noeuds), false, FREE_ALL)
+  }
+  
+  // Effort normal au premier ordre et déplacements correspondants.
+  dep_action = _1990_action_deplacement_renvoie (action);
+  dep_0 = new double [nb];
+  for (i = 0; i < p->calculs.nb_noeuds; i++)
+  {
+    for (t = 0; t < 6; t++)
+    {
+      if (p->calculs.n_part[i][t] != UINT32_MAX)
+      {
+        dep_0[p->calculs.n_part[i][t]] = ((double *) dep_action->x)[i * 6 + t];
+      }
+    }
+  }
+  n_fixe = new double [p->calculs.nb_troncons];
+  n = new double [p->calculs.nb_troncons];
+  EF_calculs_second_ordre_n (p, barres, numeros, noeuds, dep_0, n);
+  for (t = 0; t < p->calculs.nb_troncons; t++)
+  {
+    double l_d, l_f;
+    
+    l_d = EF_noeuds_distance (noeuds[2 * t], barres[t]->noeud_debut);
+    l_f = EF_noeuds_distance (noeuds[2 * t + 1], barres[t]->noeud_debut);
+    n_fixe[t] = common_fonction_y (
+                  _1990_action_efforts_renvoie (action, 0, barres[t]->indice),
+                  (l_d + l_f) / 2.,
+                  0) - n[t];
+  }
+  
+  // Les résultats au premier ordre sont libérés et les efforts de l'action
+  // recalculés.
+  for_part = new double [p->calculs.nb_ddl];
+  dep_part = new double [p->calculs.nb_ddl];
+  residu = new double [p->calculs.nb_ddl];
+#undef FREE_ALL
+#define FREE_ALL delete [] barres; delete [] numeros; delete [] noeuds; \
+  delete [] dep_0; delete [] n_fixe; delete [] n; delete [] for_part; \
+  delete [] dep_part; delete [] residu;
+  BUG (_1990_action_free_calculs (p, action), false, FREE_ALL)
+  BUG (EF_calculs_resoud_charge_forces (p, action, for_part), false, FREE_ALL)
+  memcpy (dep_part, dep_0, sizeof (double) * nb);
+  
+  memset (&b, 0, sizeof (b));
+  b.nrow = nb;
+  b.ncol = 1;
+  b.nzmax = nb;
+  b.d = nb;
+  b.xtype = CHOLMOD_REAL;
+  b.dtype = CHOLMOD_DOUBLE;
+  
+  // Pour chaque itération
+  //   Effort normal de chaque tronçon et assemblage de [K] + [K_G].
+  //   Factorisation numérique.
+  //   {R} = {F} - ([K] + [K_G]) {D}, {D} = {D} + ([K] + [K_G])^-1 {R}.
+  //   Arrêt si la correction relative est inférieure à la tolérance.
+  // FinPour
+  converge = false;
+  iter = 0;
+  while ((!converge) && (iter < p->calculs.second_ordre_iter_max))
+  {
+    std::chrono::steady_clock::time_point debut;
+    cholmod_dense *correction;
+    double         one[2] = {1., 0.}, m_one[2] = {-1., 0.};
+    double         d_max = 0., c_max = 0., r_max = 0., f_max = 0.;
+    cholmod_dense  dd;
+    
+    debut = std::chrono::steady_clock::now ();
+    iter++;
+    
+    EF_calculs_second_ordre_n (p, barres, numeros, noeuds, dep_part, n);
+    for (t = 0; t < p->calculs.nb_troncons; t++)
+    {
+      n[t] += n_fixe[t];
+    }
+    BUG (EF_calculs_second_ordre_assemble (p, barres, noeuds, n),
+         false,
+         FREE_ALL)
+    cholmod_factorize (p->calculs.second_ordre_k,
+                       p->calculs.second_ordre_factor,
+                       p->calculs.c);
+    if ((p->calculs.c->status == CHOLMOD_NOT_POSDEF) ||
+        (p->calculs.second_ordre_factor->minor < nb))
+    {
+      EF_calculs_rapport_ajout (
+        p,
+        format (gettext ("Second ordre, itération %u"), iter),
+        2,
+        gettext ("La matrice [K] + [K_G] n'est pas définie positive : la charge critique est dépassée."));
+      // L'action retrouve ses résultats au premier ordre.
+      BUG (EF_calculs_resoud_charge_resultats (p, action, dep_0),
            false,
            FREE_ALL)
+      FREE_ALL
       
-  //     Ajout des déplacements & rotations entre deux noeuds dus à leur
-  //     déplacement relatif, la courbe vient s'ajouter à la courbe (si
-  //     existante) déja définie précédemment.
-  //     Dans le cas d'une section constante, la déformée en x est obtenue par
-  //     intégration de la courbe d'effort normal et la déformée en y et z est
-  //     obtenue par double intégration de la courbe des moments. Les deux
-  //     constantes sont obtenues par la connaissance des déplacements en x=0
-  //     et x=l. Les rotations (ry et rz) sont obtenues par la dérivée de la
-  //     flèche. La rotation rx est obtenue par intégration du moment en x. La
-  //     constante est déterminée pour f(0) égal à la rotation au noeud à
-  //     gauche s'il n'y a pas de relachement (sinon f(l) égal à la rotation à
-  //     droite).\end{verbatim}\begin{align*}
-  //        f_x(x) = & u_A - \frac{F_{Ax}}{E \cdot S} \cdot x + \frac{F_{Ax} +
-  //                   F_{Bx}}{2 \cdot E \cdot S \cdot L} \cdot x^2 \nonumber\\
-  //        f_y(x) = & v_A + A \cdot x - \frac{M_{Az}}{2 \cdot E \cdot I_z}
-  //                 \cdot x^2 + \frac{M_{Az}+M_{Bz}}{6 \cdot L \cdot E \cdot
-  //                                   I_z} \cdot x^3 \text{ avec } \nonumber\\
-  //             & \text{A tel que } f_y(l)=v_B \text{ soit } A = \frac{M_{Az}
-  //             \cdot L}{2*E*Iz}-\frac{(M_{Az}+M_{Bz}) \cdot L}{6*E*Iz} +
-  //                                             \frac{-v_A+v_B}{L} \nonumber\\
-  //        f_z(x) = & w_A + B \cdot x + \frac{M_{Ay}}{2 \cdot E \cdot I_y}
-  //                 \cdot x^2 - \frac{M_{Ay}+M_{By}}{6 \cdot L \cdot E \cdot
-  //                 I_y} \cdot x^3 \text{ avec } \nonumber\\
-  //             & \text{B tel que } f_z(l)=w_B \text{ soit } B = -\frac{M_{Ay}
-  //             \cdot L}{2*E*I_y}+\frac{(M_{Ay}+M_{By}) \cdot L}{6*E*I_y} +
-  //                                             \frac{-w_A+w_B}{L} \nonumber\\
-  //        r_x(x) = & C - \frac{M_{Ax}}{G \cdot J} \cdot x + \frac{M_{Ax} +
-  //                 M_{Bx}}{2 \cdot G \cdot J \cdot L} \cdot x^2 \text{ avec }
-  //                 \nonumber\\ & \text{C tel que } r_x(l)=\theta_{Bx}  
-  //                 \text{ soit } C = \frac{M_{Ax} \cdot L}{G \cdot J} -
-  //                 \frac{(M_{Ax}+M_{Bx}) \cdot L}{2 \cdot G \cdot J}+
-  //                 \theta_{Bx} \nonumber\\
-  //             & \text{C tel que } r_x(0)=\theta_{Ax}  \text{ soit }
-  //             C = \theta_{Ax} \nonumber\\
-  //             & \text{Solution 1 si le noeud A n'est pas encastrée et solution 2 si le noeud B n'est pas encastrée} \nonumber\\
-  //        r_y(x) = & -B - \frac{M_{Ay}}{E \cdot I_y} \cdot x + \frac{M_{Ay} +
-  //                 M_{By}}{2 \cdot L \cdot E \cdot I_y} \cdot x^2 \nonumber\\
-  //        r_z(x) = & A - \frac{M_{Az}}{E \cdot I_z} \cdot x + \frac{M_{Az} +
-  //                             M_{Bz}}{2 \cdot L \cdot E \cdot I_z} \cdot x^2
-
-          BUG (common_fonction_ajout_poly (
-                 _1990_action_deformation_renvoie (action, 0, num),
-                 0.,
-                 l,
-                 ax[0],
-                 -ax2[0] / (E * S),
-                 (ax2[0] + ax2[6]) / (2 * E * S * l),
-                 0., 0., 0., 0.,
-                 l_debut),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_ajout_poly (
-                 _1990_action_deformation_renvoie (action, 1, num),
-                 0.,
-                 l,
-                 ax[1],
-                 (ax2[5] / (2 * E * Iz) * l * l -
-                   (ax2[5] + ax2[11]) / (6 * E * Iz) * l * l -
-                   ax[1] + ax[7]) / l,
-                 -ax2[5] / (2 * E * Iz),
-                 (ax2[5] + ax2[11]) / (6 * l * E * Iz),
-                 0., 0., 0.,
-                 l_debut),
-               false,
+      return false;
+    }
+    
+    // Résidu.
+    memcpy (residu, for_part, sizeof (double) * nb);
+    b.x = residu;
+    dd = b;
+    dd.x = dep_part;
+    cholmod_sdmult (p->calculs.second_ordre_k,
+                    0,
+                    m_one,
+                    one,
+                    &dd,
+                    &b,
+                    p->calculs.c);
+    BUGCRIT (correction = cholmod_solve (CHOLMOD_A,
+                                         p->calculs.second_ordre_factor,
+                                         &b,
+                                         p->calculs.c),
+             false,
+             (gettext ("Erreur d'allocation mémoire.\n"));
                FREE_ALL)
-          BUG (common_fonction_ajout_poly (
-                 _1990_action_deformation_renvoie (action, 2, num),
-                 0.,
-                 l,
-                 ax[2],
-                 (-ax2[4] / (2 * E * Iy) * l * l +
-                   (ax2[4] + ax2[10]) / (6 * E * Iy) * l * l -
-                   ax[2] + ax[8]) / l,
-                 ax2[4] / (2 * E * Iy),
-                 -(ax2[4] + ax2[10]) / (6 * l * E * Iy),
-                 0., 0., 0.,
-                 l_debut),
+    for (i = 0; i < nb; i++)
+    {
+      double c = ((double *) correction->x)[i];
+      
+      r_max = std::max (r_max, fabs (residu[i]));
+      f_max = std::max (f_max, fabs (for_part[i]));
+      dep_part[i] += c;
+      c_max = std::max (c_max, fabs (c));
+      d_max = std::max (d_max, fabs (dep_part[i]));
+    }
+    cholmod_free_dense (&correction, p->calculs.c);
+    converge = c_max <= p->calculs.second_ordre_tolerance * d_max;
+    
+    EF_calculs_rapport_ajout (
+      p,
+      format (gettext ("Second ordre, itération %u"), iter),
+      0,
+      format (gettext ("Résidu relatif %g, correction relative %g, %.3f ms."),
+              f_max == 0. ? 0. : r_max / f_max,
+              d_max == 0. ? 0. : c_max / d_max,
+              std::chrono::duration <double, std::milli> (
+                std::chrono::steady_clock::now () - debut).count ()));
+  }
+  // FinPour
+  
+  EF_calculs_rapport_ajout (
+    p,
+    gettext ("Calcul au second ordre (P-Delta)"),
+    converge ? 0 : 1,
+    converge ?
+      format (gettext ("Convergence en %u itérations."), iter) :
+      format (gettext ("Pas de convergence après %u itérations."), iter));
+  
+  BUG (EF_calculs_resoud_charge_resultats (p, action, dep_part),
+       false,
+       FREE_ALL)
+  FREE_ALL
+#undef FREE_ALL
+  
+  return true;
+}
+
+
+/**
+ * \brief Cumule la variation de rigidité d'une barre dans les matrices de
+ *        rigidité complète et partielle puis met à jour la factorisation de
+ *        Cholesky de la matrice partielle sans la recalculer. La variation
+ *        [\Delta K] restreinte aux degrés de liberté libres de la barre est
+ *        décomposée en valeurs propres : \end{verbatim}\begin{displaymath}
+ *        [\Delta K] = [V] \cdot [\Lambda] \cdot [V]^T =
+ *                     [C^+] \cdot [C^+]^T - [C^-] \cdot [C^-]^T
+ *        \texttt{ avec } C_k = \sqrt{\left| \lambda_k \right|} \cdot V_k
+ *        \end{displaymath}\begin{verbatim}
+ *        Le facteur est mis à jour avec [C^+] puis dégradé avec [C^-] par
+ *        cholmod_updown, ce qui coûte de l'ordre du rang fois le nombre de
+ *        termes de L affectés au lieu d'une factorisation complète.
+ * \param p : la variable projet,
+ * \param barre : la barre modifiée,
+ * \param dk_glob : la variation des matrices élémentaires de la barre
+ *                  renvoyée par #_1992_1_1_barres_rigidite_variation,
+ * \param rang : le rang de la mise à jour,
+ * \param ok : vaut false si le facteur n'a pas pu être mis à jour (rang ou
+ *             nombre de mises à jour trop élevé, matrice non définie
+ *             positive). Les matrices de rigidité sont à jour mais le facteur
+ *             doit être recalculé.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+static bool
+EF_calculs_updown (Projet   *p,
+                   EF_Barre *barre,
+                   double   *dk_glob,
+                   uint32_t *rang,
+                   bool     *ok)
+{
+  cholmod_factor *factor = p->calculs.factor;
+  size_t          n = p->calculs.m_part->nrow;
+  uint32_t        nb_troncons = (uint32_t) barre->nds_inter.size () + 1U;
+  uint32_t        m = 6U * (nb_troncons + 1U);
+  uint32_t        nb_libre, nb_pos, nb_neg;
+  uint32_t        i, j, k;
+  uint32_t       *ddl, *loc, *ordre;
+  double         *dk, *a, *valeurs, *vecteurs;
+  double         *x_reac;
+  double          lambda_max;
+  int            *perm, *pinv; // NS
+  
+  std::vector <EF_Noeud *> noeuds;
+  
+  *rang = 0;
+  *ok = false;
+  
+  // Les noeuds de la barre : le tronçon t relie noeuds[t] et noeuds[t + 1].
+  noeuds.push_back (barre->noeud_debut);
+  noeuds.insert (noeuds.end (),
+                 barre->nds_inter.begin (),
+                 barre->nds_inter.end ());
+  noeuds.push_back (barre->noeud_fin);
+  
+  // Variation des lignes de réaction et assemblage de la variation dense
+  // [\Delta K] sur les 6 degrés de liberté de chaque noeud de la barre.
+  dk = new double [m * m];
+  memset (dk, 0, sizeof (double) * m * m);
+  x_reac = p->calculs.reac_x;
+  for (k = 0; k < nb_troncons; k++)
+  {
+    uint32_t *disp_reac = &p->calculs.disp_reac[
+                                       barre->info_EF[k].troncon * 144U];
+    
+    for (j = 0; j < 12; j++)
+    {
+      for (i = 0; i < 12; i++)
+      {
+        if (disp_reac[j * 12 + i] != UINT32_MAX)
+        {
+          x_reac[disp_reac[j * 12 + i]] += dk_glob[k * 144U + j * 12 + i];
+        }
+        dk[(6 * k + j) * m + 6 * k + i] += dk_glob[k * 144U + j * 12 + i];
+      }
+    }
+  }
+  
+  // Degrés de liberté libres de la barre et position dans m_part.
+  ddl = new uint32_t [m];
+  loc = new uint32_t [m];
+  nb_libre = 0;
+  for (i = 0; i < m; i++)
+  {
+    uint32_t r = p->calculs.n_part[noeuds[i / 6]->indice][i % 6];
+    
+    if (r != UINT32_MAX)
+    {
+      ddl[nb_libre] = r;
+      loc[nb_libre] = i;
+      nb_libre++;
+    }
+  }
+  
+#define FREE_ALL delete [] dk; delete [] ddl; delete [] loc;
+  // Variation du triangle supérieur de m_part (stype = 1 après Cholesky).
+  for (j = 0; j < nb_libre; j++)
+  {
+    for (i = 0; i < nb_libre; i++)
+    {
+      double *terme;
+      
+      if ((ddl[i] > ddl[j]) || (dk[loc[j] * m + loc[i]] == 0.))
+      {
+        continue;
+      }
+      BUGCRIT (terme = EF_calculs_terme (p->calculs.m_part, ddl[i], ddl[j]),
                false,
-               FREE_ALL)
-          if ((j == 0) &&
-              (element->relachement != NULL) &&
-              (element->relachement->rx_debut != EF_RELACHEMENT_BLOQUE))
-          {
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_rotation_renvoie (action, 0, num),
-                   0.,
-                   l,
-                   ax2[3] / (G * J) * l -
-                     (ax2[3] + ax2[9]) / (2 * G * J * l) * l * l + ax[9],
-                   -ax2[3] / (G * J),
-                   (ax2[3] + ax2[9]) / (2 * G * J * l),
-                   0., 0., 0., 0.,
-                   l_debut),
-                 false,
-                 FREE_ALL)
-          }
-          else
-          {
-            BUG (common_fonction_ajout_poly (
-                   _1990_action_rotation_renvoie (action, 0, num),
-                   0.,
-                   l,
-                   ax[3],
-                   -ax2[3] / (G * J),
-                   (ax2[3] + ax2[9]) / (2 * G * J * l),
-                   0., 0., 0., 0.,
-                   l_debut),
-                 false,
+               (gettext ("Le terme (%u, %u) n'existe pas dans la matrice de rigidité partielle.\n"),
+                 ddl[i], ddl[j]);
                  FREE_ALL)
-          }
-          BUG (common_fonction_ajout_poly (
-                 _1990_action_rotation_renvoie (action, 1, num),
-                 0.,
-                 l,
-                 -(-ax2[4] / (2 * E * Iy) * l * l +
-                   (ax2[4] + ax2[10]) / (6 * E * Iy) * l * l -
-                   ax[2] + ax[8]) / l,
-                 -ax2[4] / (E * Iy),
-                 (ax2[4] + ax2[10]) / (2 * l * E * Iy),
-                 0., 0., 0., 0.,
-                 l_debut),
-               false,
+      *terme += dk[loc[j] * m + loc[i]];
+    }
+  }
+  
+  // Décomposition en valeurs propres de la variation compactée.
+  a = new double [nb_libre * nb_libre];
+  valeurs = new double [nb_libre];
+  vecteurs = new double [nb_libre * nb_libre];
+  for (j = 0; j < nb_libre; j++)
+  {
+    for (i = 0; i < nb_libre; i++)
+    {
+      a[j * nb_libre + i] = dk[loc[j] * m + loc[i]];
+    }
+  }
+  delete [] dk;
+  delete [] loc;
+  common_math_valeurs_propres (a, nb_libre, valeurs, vecteurs);
+  delete [] a;
+#undef FREE_ALL
+  
+  // Les valeurs propres négligeables sont ignorées.
+  lambda_max = 0.;
+  for (i = 0; i < nb_libre; i++)
+  {
+    lambda_max = std::max (lambda_max, fabs (valeurs[i]));
+  }
+  nb_pos = 0;
+  nb_neg = 0;
+  for (i = 0; i < nb_libre; i++)
+  {
+    if (fabs (valeurs[i]) <= lambda_max * 1.e-12)
+    {
+      valeurs[i] = 0.;
+    }
+    else if (valeurs[i] > 0.)
+    {
+      nb_pos++;
+    }
+    else
+    {
+      nb_neg++;
+    }
+  }
+  *rang = nb_pos + nb_neg;
+  
+#define FREE_ALL delete [] ddl; delete [] valeurs; delete [] vecteurs;
+  if (*rang == 0)
+  {
+    FREE_ALL
+    *ok = true;
+    
+    return true;
+  }
+  if ((*rang > p->calculs.updown_rang_max) ||
+      (p->calculs.updown_nb >= p->calculs.updown_nb_max))
+  {
+    FREE_ALL
+    
+    return true;
+  }
+  
+  // cholmod_updown ne travaille que sur un facteur simplicial LDL^T.
+  if ((factor->is_super) || (factor->is_ll))
+  {
+    BUGCRIT (cholmod_change_factor (CHOLMOD_REAL,
+                                    false,
+                                    false,
+                                    true,
+                                    true,
+                                    factor,
+                                    p->calculs.c),
+             false,
+             (gettext ("Erreur d'allocation mémoire.\n"));
                FREE_ALL)
-          BUG (common_fonction_ajout_poly (
-                 _1990_action_rotation_renvoie (action, 2, num),
-                 0.,
-                 l,
-                 (ax2[5] / (2 * E * Iz) * l * l +
-                   (-ax2[5] - ax2[11]) / (6 * E * Iz) * l * l -
-                   ax[1] + ax[7]) / l,
-                 -ax2[5] / (E * Iz),
-                 (ax2[5] + ax2[11]) / (2 * l * E * Iz),
-                 0., 0., 0., 0.,
-                 l_debut),
-               false,
+  }
+  
+  // Les lignes de [C] sont exprimées dans la numérotation du facteur et
+  // triées.
+  perm = (int *) factor->Perm;
+  pinv = new int [n];
+  for (i = 0; i < n; i++)
+  {
+    pinv[perm[i]] = (int) i;
+  }
+  ordre = new uint32_t [nb_libre];
+  for (i = 0; i < nb_libre; i++)
+  {
+    uint32_t tmp = i;
+    
+    j = i;
+    while ((j > 0) && (pinv[ddl[ordre[j - 1]]] > pinv[ddl[tmp]]))
+    {
+      ordre[j] = ordre[j - 1];
+      j--;
+    }
+    ordre[j] = tmp;
+  }
+#undef FREE_ALL
+#define FREE_ALL delete [] ddl; delete [] valeurs; delete [] vecteurs; \
+  delete [] pinv; delete [] ordre;
+  
+  // Mise à jour (partie positive) puis dégradation (partie négative).
+  for (k = 0; k < 2; k++)
+  {
+    cholmod_sparse *c;
+    int            *cp, *ci; // NS
+    double         *cx;
+    uint32_t        nb_col = k == 0 ? nb_pos : nb_neg;
+    uint32_t        col;
+    
+    if (nb_col == 0)
+    {
+      continue;
+    }
+    
+    BUGCRIT (c = cholmod_allocate_sparse (n,
+                                          nb_col,
+                                          nb_libre * nb_col,
+                                          true,
+                                          true,
+                                          0,
+                                          CHOLMOD_REAL,
+                                          p->calculs.c),
+             false,
+             (gettext ("Erreur d'allocation mémoire.\n"));
                FREE_ALL)
-  //        \end{align*}\begin{verbatim}
+    cp = (int *) c->p;
+    ci = (int *) c->i;
+    cx = (double *) c->x;
+    col = 0;
+    for (j = 0; j < nb_libre; j++)
+    {
+      double coef;
       
-      cholmod_free_sparse (&s_dep_loc, p->calculs.c);
-      cholmod_free_sparse (&s_eff_loc, p->calculs.c);
+      if ((valeurs[j] == 0.) || ((valeurs[j] > 0.) != (k == 0)))
+      {
+        continue;
+      }
+      coef = sqrt (fabs (valeurs[j]));
+      cp[col] = (int) (col * nb_libre);
+      for (i = 0; i < nb_libre; i++)
+      {
+        ci[col * nb_libre + i] = pinv[ddl[ordre[i]]];
+        cx[col * nb_libre + i] = coef * vecteurs[j * nb_libre + ordre[i]];
+      }
+      col++;
     }
-  //   FinPour
+    cp[nb_col] = (int) (nb_col * nb_libre);
+    
+    cholmod_updown (k == 0, c, factor, p->calculs.c);
+    cholmod_free_sparse (&c, p->calculs.c);
+    
+    // Dégradation rendant la matrice non définie positive : le facteur est
+    // inutilisable.
+    if ((p->calculs.c->status == CHOLMOD_NOT_POSDEF) ||
+        (factor->minor < factor->n))
+    {
+      FREE_ALL
+      
+      return true;
+    }
+    BUGCRIT (p->calculs.c->status == CHOLMOD_OK,
+             false,
+             (gettext ("Erreur de calcul : %d\n"), p->calculs.c->status);
+               FREE_ALL)
+  }
+  FREE_ALL
+#undef FREE_ALL
+  
+  p->calculs.updown_nb++;
+  *ok = true;
+  
+  return true;
+}
+
+
+/**
+ * \brief Recalcule la factorisation de Cholesky de la matrice de rigidité
+ *        partielle à partir de l'analyse symbolique conservée.
+ * \param p : la variable projet,
+ * \param ok : vaut false si la matrice n'est pas définie positive ou si
+ *             l'analyse symbolique n'est plus disponible.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+static bool
+EF_calculs_refactorise (Projet *p,
+                        bool   *ok)
+{
+  cholmod_factor *factor;
+  
+  *ok = false;
+  cholmod_free_factor (&p->calculs.factor, p->calculs.c);
+  p->calculs.updown_nb = 0;
+  
+  if (p->calculs.symbolique_chol == NULL)
+  {
+    return true;
+  }
+  
+  BUGCRIT (factor = cholmod_copy_factor (p->calculs.symbolique_chol,
+                                         p->calculs.c),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  cholmod_factorize (p->calculs.m_part, factor, p->calculs.c);
+  if ((p->calculs.c->status == CHOLMOD_NOT_POSDEF) ||
+      (factor->minor < factor->n))
+  {
+    cholmod_free_factor (&factor, p->calculs.c);
+    
+    return true;
+  }
+  BUGCRIT (p->calculs.c->status == CHOLMOD_OK,
+           false,
+           (gettext ("Erreur de calcul : %d\n"), p->calculs.c->status);
+             cholmod_free_factor (&factor, p->calculs.c); )
+  
+  p->calculs.factor = factor;
+  *ok = true;
+  
+  return true;
+}
+
+
+/**
+ * \brief Libère les résultats de toutes les actions et les recalcule avec la
+ *        factorisation courante.
+ * \param p : la variable projet,
+ * \param residu : le résidu relatif ||K.D-F|| / ||F|| obtenu.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - #_1990_action_free_calculs,
+ *     - #EF_calculs_resoud_charges.
+ */
+static bool
+EF_calculs_resoud_charges_nouveau (Projet *p,
+                                   double *residu)
+{
+  size_t i;
+  double f_max = 0.;
+  
+  std::list <Action *>::iterator it;
+  
+  it = p->actions.begin ();
+  while (it != p->actions.end ())
+  {
+    BUG (_1990_action_free_calculs (p, *it), false)
+    
     ++it;
   }
-  // FinPour
-  cholmod_free_triplet (&t_dep_tot, p->calculs.c);
+  BUG (EF_calculs_resoud_charges (p), false)
+  
+  for (i = 0; i < (size_t) p->calculs.nb_ddl * p->calculs.nb_bloc; i++)
+  {
+    f_max = std::max (f_max, fabs (p->calculs.for_bloc[i]));
+  }
+  if (f_max == 0.)
+  {
+    *residu = 0.;
+  }
+  else
+  {
+    *residu = p->calculs.residu / f_max;
+  }
+  
+  return true;
+}
+
+
+/**
+ * \brief Met à jour les calculs après la modification de la section ou du
+ *        matériau d'une barre. Si les résultats ont été obtenus par une
+ *        factorisation de Cholesky, seule la contribution de la barre est
+ *        modifiée dans les matrices de rigidité, le facteur est mis à jour
+ *        par une modification de rang faible (#EF_calculs_updown) et toutes
+ *        les actions sont résolues à nouveau. Le facteur est entièrement
+ *        recalculé si la mise à jour est impossible ou si le résidu relatif
+ *        dépasse p->calculs.updown_tolerance. Dans les autres cas (pas de
+ *        résultat, factorisation LU, gradient conjugué, condensation), les
+ *        calculs sont simplement libérés par #EF_calculs_free.
+ * \param p : la variable projet,
+ * \param barre : la barre modifiée.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - barre == NULL,
+ *     - en cas d'erreur due à une fonction interne.
+ */
+bool
+EF_calculs_modifie_barre (Projet   *p,
+                          EF_Barre *barre)
+{
+  double  *dk_glob;
+  double   residu;
+  uint32_t rang;
+  bool     ok;
+  
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (barre, "%p", barre, false)
+  
+  // La structure du second ordre contient les valeurs de la matrice de
+  // rigidité linéaire : elle sera reconstruite au prochain calcul.
+  cholmod_free_sparse (&p->calculs.second_ordre_k, p->calculs.c);
+  delete [] p->calculs.second_ordre_x0;
+  p->calculs.second_ordre_x0 = NULL;
+  cholmod_free_factor (&p->calculs.second_ordre_factor, p->calculs.c);
+  
+  if ((p->calculs.factor == NULL) || (p->calculs.for_bloc == NULL) ||
+      (p->calculs.cond_x != NULL))
+  {
+    BUG (EF_calculs_free (p), false)
+    
+    return true;
+  }
+  
+  dk_glob = new double [144U * (barre->nds_inter.size () + 1U)];
+  BUG (_1992_1_1_barres_rigidite_variation (barre, dk_glob),
+       false,
+       delete [] dk_glob; )
+  BUG (EF_calculs_updown (p, barre, dk_glob, &rang, &ok),
+       false,
+       delete [] dk_glob; )
+  delete [] dk_glob;
+  
+  if (ok)
+  {
+    BUG (EF_calculs_resoud_charges_nouveau (p, &residu), false)
+    if (residu <= p->calculs.updown_tolerance)
+    {
+      EF_calculs_rapport_ajout (
+        p,
+        format (gettext ("Mise à jour de la factorisation de Cholesky (barre %u)"),
+                barre->numero),
+        0,
+        format (gettext ("Rang %u, mise à jour n°%u depuis la dernière factorisation, résidu relatif %g."),
+                rang,
+                p->calculs.updown_nb,
+                residu));
+    }
+    else
+    {
+      ok = false;
+    }
+  }
+  
+  if (!ok)
+  {
+    BUG (EF_calculs_refactorise (p, &ok), false)
+    // Matrice devenue non définie positive : un nouveau calcul complet
+    // basculera sur la factorisation LU.
+    if (!ok)
+    {
+      BUG (EF_calculs_free (p), false)
+      
+      return true;
+    }
+    BUG (EF_calculs_resoud_charges_nouveau (p, &residu), false)
+    EF_calculs_rapport_ajout (
+      p,
+      format (gettext ("Mise à jour de la factorisation de Cholesky (barre %u)"),
+              barre->numero),
+      1,
+      format (gettext ("Rang %u, factorisation complète recalculée, résidu relatif %g."),
+              rang,
+              residu));
+  }
+  
+#ifdef ENABLE_GTK
+  if (UI_RES.builder != NULL)
+  {
+    std::list <Gtk_EF_Resultats_Tableau *>::iterator it;
+    
+    it = UI_RES.tableaux.begin ();
+    while (it != UI_RES.tableaux.end ())
+    {
+      BUG (EF_gtk_resultats_remplit_page (*it, p), false)
+      
+      ++it;
+    }
+  }
+#endif
   
   return true;
 }
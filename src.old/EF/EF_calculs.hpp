@@ -43,6 +43,26 @@ bool     EF_calculs_moment_hyper_z (Barre_Info_EF *infos,
 bool     EF_calculs_resoud_charge  (Projet        *p,
                                     Action        *action)
                                        __attribute__((__warn_unused_result__));
+bool     EF_calculs_resoud_charges (Projet        *p)
+                                       __attribute__((__warn_unused_result__));
+bool     EF_calculs_resoud_forces  (Projet        *p,
+                                    double        *for_part,
+                                    double        *dep_part,
+                                    uint32_t       nb)
+                                       __attribute__((__warn_unused_result__));
+
+bool     EF_calculs_second_ordre   (Projet        *p,
+                                    Action        *action)
+                                       __attribute__((__warn_unused_result__));
+
+bool     EF_calculs_modifie_barre  (Projet        *p,
+                                    EF_Barre      *barre)
+                                       __attribute__((__warn_unused_result__));
+
+void     EF_calculs_rapport_ajout  (Projet            *p,
+                                    const std::string &analyse,
+                                    uint8_t            resultat,
+                                    const std::string &commentaire);
 
 bool     EF_calculs_free           (Projet        *p);
 
@@ -0,0 +1,465 @@
+/*
+ * 2lgc_code : calcul de résistance des matériaux selon les normes Eurocodes
+ * Copyright (C) 2011
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include <algorithm>
+#include <locale>
+#include <cmath>
+#include <string.h>
+
+#include "common_projet.hpp"
+#include "common_erreurs.hpp"
+#include "common_math.hpp"
+#include "EF_calculs.hpp"
+#include "EF_noeuds.hpp"
+#include "EF_influence.hpp"
+
+
+/**
+ * \brief Ajoute les sections d'une barre du chemin, de son noeud courant
+ *        jusqu'à son autre extrémité. Chaque section est le noeud de fin (au
+ *        sens du parcours) d'un tronçon et l'effort y est pris à gauche,
+ *        c'est-à-dire dans le tronçon qui vient d'être parcouru.
+ * \param influence : les lignes d'influence en cours de construction,
+ * \param barre : la barre à parcourir,
+ * \param inverse : true si la barre est parcourue de sa fin vers son début.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - #EF_noeuds_distance.
+ */
+static bool
+EF_influence_barre (EF_Influence *influence,
+                    EF_Barre     *barre,
+                    bool          inverse)
+{
+  uint32_t i, nb_troncons;
+  
+  std::vector <EF_Noeud *> noeuds;
+  
+  noeuds.push_back (barre->noeud_debut);
+  noeuds.insert (noeuds.end (),
+                 barre->nds_inter.begin (),
+                 barre->nds_inter.end ());
+  noeuds.push_back (barre->noeud_fin);
+  nb_troncons = (uint32_t) noeuds.size () - 1U;
+  
+  for (i = 0; i < nb_troncons; i++)
+  {
+    uint32_t  t = inverse ? nb_troncons - 1U - i : i;
+    EF_Noeud *precedent = inverse ? noeuds[t + 1] : noeuds[t];
+    EF_Noeud *suivant = inverse ? noeuds[t] : noeuds[t + 1];
+    double    l;
+    
+    // Premier noeud du chemin : l'effort est pris à droite.
+    if (influence->noeuds.empty ())
+    {
+      influence->barres.push_back (barre);
+      influence->troncons.push_back (t);
+      influence->fins.push_back (inverse);
+      influence->noeuds.push_back (precedent);
+      influence->abscisses.push_back (0.);
+    }
+    
+    l = EF_noeuds_distance (suivant, precedent);
+    BUG (!std::isnan (l), false)
+    influence->barres.push_back (barre);
+    influence->troncons.push_back (t);
+    influence->fins.push_back (!inverse);
+    influence->noeuds.push_back (suivant);
+    influence->abscisses.push_back (influence->abscisses.back () + l);
+  }
+  
+  return true;
+}
+
+
+/**
+ * \brief Calcule les lignes d'influence des sollicitations le long d'un
+ *        chemin de barres pour une charge unitaire de direction donnée.
+ *        Les positions de la charge et les sections étudiées sont les noeuds
+ *        du chemin : la précision est donc celle de la discrétisation des
+ *        barres. La charge étant appliquée aux noeuds, les sollicitations aux
+ *        extrémités des tronçons sont exactes et sont obtenues directement
+ *        par {F}_{local} = [K] \cdot [R]^T \cdot \{ \Delta \}_{global}.
+ *        La matrice de rigidité n'est factorisée qu'une seule fois
+ *        (#EF_calculs_genere_mat_rig) et les positions sont résolues par
+ *        blocs de taille_bloc seconds membres (#EF_calculs_resoud_forces).\n
+ *        Cette fonction et #EF_influence_convoi ne sont pour l'instant pas
+ *        appelées par l'interface : elles doivent être appelées par
+ *        l'utilisateur de la bibliothèque après #EF_calculs_genere_mat_rig.
+ * \param p : la variable projet,
+ * \param chemin : les barres parcourues, dans l'ordre. Deux barres
+ *                 consécutives doivent avoir un noeud commun,
+ * \param direction : la charge unitaire dans le repère global (par exemple
+ *                    {0, 0, -1} pour une charge verticale descendante),
+ * \param taille_bloc : le nombre de positions résolues simultanément (64 si
+ *                      0),
+ * \param influence : les lignes d'influence, à libérer par
+ *                    #EF_influence_free.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - chemin == NULL ou vide,
+ *     - influence == NULL,
+ *     - chemin non continu,
+ *     - #EF_calculs_resoud_forces.
+ */
+bool
+EF_influence_calcule (Projet                 *p,
+                      std::list <EF_Barre *> *chemin,
+                      const double            direction[3],
+                      uint32_t                taille_bloc,
+                      EF_Influence          **influence)
+{
+  EF_Influence *inf;
+  EF_Noeud     *courant;
+  size_t        n, nb, k0, k, s;
+  uint8_t       c;
+  double       *for_part, *dep_part;
+  
+  std::list <EF_Barre *>::iterator it;
+  
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (chemin, "%p", chemin, false)
+  BUGPARAM (chemin->size (), "%zu", !chemin->empty (), false)
+  BUGPARAM (influence, "%p", influence, false)
+  INFO (p->calculs.m_part,
+        false,
+        (gettext ("Il est nécessaire de lancer la fonction EF_calculs_genere_mat_rig avant.\n")); )
+  
+  if (taille_bloc == 0)
+  {
+    taille_bloc = 64;
+  }
+  
+  inf = new EF_Influence;
+  inf->lignes = NULL;
+  for (c = 0; c < 3; c++)
+  {
+    inf->direction[c] = direction[c];
+  }
+  
+  // Le chemin commence par l'extrémité de la première barre qui n'est pas
+  // commune avec la deuxième.
+  it = chemin->begin ();
+  courant = (*it)->noeud_debut;
+  if (chemin->size () > 1)
+  {
+    EF_Barre *deuxieme = *std::next (it);
+    
+    if ((courant == deuxieme->noeud_debut) ||
+        (courant == deuxieme->noeud_fin))
+    {
+      courant = (*it)->noeud_fin;
+    }
+  }
+  
+  // Pour chaque barre du chemin
+  //   Parcours de la barre depuis le noeud courant.
+  // FinPour
+  while (it != chemin->end ())
+  {
+    EF_Barre *barre = *it;
+    bool      inverse;
+    
+    INFO ((barre->noeud_debut == courant) || (barre->noeud_fin == courant),
+          false,
+          (gettext ("Le chemin n'est pas continu au niveau de la barre %u.\n"),
+            barre->numero);
+            delete inf; )
+    inverse = barre->noeud_fin == courant;
+    BUG (EF_influence_barre (inf, barre, inverse), false, delete inf; )
+    courant = inverse ? barre->noeud_debut : barre->noeud_fin;
+    
+    ++it;
+  }
+  
+  nb = inf->noeuds.size ();
+  n = p->calculs.nb_ddl;
+  inf->lignes = new double [nb * 6U * nb];
+  for_part = new double [n * taille_bloc];
+  dep_part = new double [n * taille_bloc];
+  
+  // Pour chaque bloc de positions de la charge unitaire
+  //   Assemblage d'une colonne d'efforts par position.
+  //   Résolution simultanée du bloc.
+  //   Pour chaque section et chaque position du bloc
+  //     Sollicitations à l'extrémité du tronçon de la section.
+  //   FinPour
+  // FinPour
+  for (k0 = 0; k0 < nb; k0 += taille_bloc)
+  {
+    size_t nb_col = std::min ((size_t) taille_bloc, nb - k0);
+    
+    memset (for_part, 0, sizeof (double) * n * nb_col);
+    for (k = 0; k < nb_col; k++)
+    {
+      uint32_t *ddl = p->calculs.n_part[inf->noeuds[k0 + k]->indice];
+      
+      for (c = 0; c < 3; c++)
+      {
+        if (ddl[c] != UINT32_MAX)
+        {
+          for_part[k * n + ddl[c]] = direction[c];
+        }
+      }
+    }
+    BUG (EF_calculs_resoud_forces (p, for_part, dep_part, (uint32_t) nb_col),
+         false,
+         delete [] for_part;
+           delete [] dep_part;
+           EF_influence_free (inf); )
+    
+    for (s = 0; s < nb; s++)
+    {
+      EF_Barre      *barre = inf->barres[s];
+      Barre_Info_EF *info = &barre->info_EF[inf->troncons[s]];
+      EF_Noeud      *noeud_d, *noeud_f;
+      uint32_t      *ddl_d, *ddl_f;
+      
+      if (inf->troncons[s] == 0)
+      {
+        noeud_d = barre->noeud_debut;
+      }
+      else
+      {
+        noeud_d = *std::next (barre->nds_inter.begin (),
+                              inf->troncons[s] - 1U);
+      }
+      if (inf->troncons[s] == barre->nds_inter.size ())
+      {
+        noeud_f = barre->noeud_fin;
+      }
+      else
+      {
+        noeud_f = *std::next (barre->nds_inter.begin (), inf->troncons[s]);
+      }
+      ddl_d = p->calculs.n_part[noeud_d->indice];
+      ddl_f = p->calculs.n_part[noeud_f->indice];
+      
+      for (k = 0; k < nb_col; k++)
+      {
+        double dep_glo[12], dep_loc[12], eff_loc[12];
+        
+        for (c = 0; c < 6; c++)
+        {
+          dep_glo[c] = ddl_d[c] == UINT32_MAX ? 0. : dep_part[k * n + ddl_d[c]];
+          dep_glo[c + 6] = ddl_f[c] == UINT32_MAX ?
+                                              0. : dep_part[k * n + ddl_f[c]];
+        }
+        common_math_rotation_vecteur (barre->rot, true, dep_glo, dep_loc);
+        common_math_produit_12 (info->k_loc, dep_loc, eff_loc);
+        // Même convention que les courbes de sollicitations des actions :
+        // f(0) = F_A et f(l) = -F_B.
+        for (c = 0; c < 6; c++)
+        {
+          inf->lignes[(s * 6U + c) * nb + k0 + k] = inf->fins[s] ?
+                                                      -eff_loc[c + 6] :
+                                                      eff_loc[c];
+        }
+      }
+    }
+  }
+  
+  delete [] for_part;
+  delete [] dep_part;
+  
+  *influence = inf;
+  
+  return true;
+}
+
+
+/**
+ * \brief Détermine les sollicitations extrêmes dans chaque section du chemin
+ *        sous le passage d'un convoi. Le convoi est déplacé par pas constant
+ *        depuis l'entrée de son premier essieu jusqu'à la sortie du dernier.
+ *        Pour chaque position, la valeur de la ligne d'influence sous chaque
+ *        essieu est interpolée linéairement entre deux sections, un curseur
+ *        par essieu avançant de façon monotone (fenêtre glissante) :\end{verbatim}
+ *        \begin{displaymath}
+ *        S(x) = \sum_i P_i \cdot \eta (x + d_i)
+ *        \end{displaymath}\begin{verbatim}
+ *        Les poids d'interpolation sont calculés une seule fois puis
+ *        appliqués à toutes les lignes d'influence. La ligne est nulle en
+ *        dehors du chemin. Les extrêmes sont initialisés à 0 (convoi absent).\n
+ *        Cette fonction n'est pour l'instant pas appelée par l'interface.
+ * \param influence : les lignes d'influence,
+ * \param essieux : la position d_i de chaque essieu par rapport à l'avant du
+ *                  convoi en m, positive vers l'arrière,
+ * \param charges : la charge P_i de chaque essieu, dans la direction de la
+ *                  charge unitaire, en N,
+ * \param pas : le pas de déplacement du convoi en m,
+ * \param maxi : les sollicitations maximales, nb_sections × 6 valeurs
+ *               (maxi[s × 6 + c]),
+ * \param mini : les sollicitations minimales, même organisation.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - influence == NULL,
+ *     - essieux == NULL,
+ *     - charges == NULL,
+ *     - essieux->size () != charges->size (),
+ *     - pas <= 0,
+ *     - maxi == NULL,
+ *     - mini == NULL.
+ */
+bool
+EF_influence_convoi (EF_Influence         *influence,
+                     std::vector <double> *essieux,
+                     std::vector <double> *charges,
+                     double                pas,
+                     double               *maxi,
+                     double               *mini)
+{
+  size_t  nb, nb_ess, nb_pas, i, j, r;
+  double  debut, d_min, d_max;
+  size_t *indices, *curseurs;
+  double *poids;
+  
+  BUGPARAM (influence, "%p", influence, false)
+  BUGPARAM (essieux, "%p", essieux, false)
+  BUGPARAM (charges, "%p", charges, false)
+  BUGPARAM (essieux->size (),
+            "%zu",
+            essieux->size () == charges->size (),
+            false)
+  BUGPARAM (pas, "%lf", pas > 0., false)
+  BUGPARAM (maxi, "%p", maxi, false)
+  BUGPARAM (mini, "%p", mini, false)
+  
+  nb = influence->noeuds.size ();
+  nb_ess = essieux->size ();
+  memset (maxi, 0, sizeof (double) * nb * 6U);
+  memset (mini, 0, sizeof (double) * nb * 6U);
+  if (nb_ess == 0)
+  {
+    return true;
+  }
+  
+  d_min = *std::min_element (essieux->begin (), essieux->end ());
+  d_max = *std::max_element (essieux->begin (), essieux->end ());
+  debut = influence->abscisses[0] - d_max;
+  nb_pas = (size_t) floor ((influence->abscisses[nb - 1] - d_min - debut) /
+                           pas) + 1U;
+  
+  // Poids d'interpolation : pour la position j et l'essieu i, la charge est
+  // répartie entre les sections indices[] et indices[] + 1.
+  indices = new size_t [nb_pas * nb_ess];
+  poids = new double [nb_pas * nb_ess * 2U];
+  curseurs = new size_t [nb_ess];
+  for (i = 0; i < nb_ess; i++)
+  {
+    curseurs[i] = 0;
+  }
+  for (j = 0; j < nb_pas; j++)
+  {
+    for (i = 0; i < nb_ess; i++)
+    {
+      double  x = debut + (double) j * pas + (*essieux)[i];
+      size_t  pos = j * nb_ess + i;
+      size_t *k = &curseurs[i];
+      
+      while ((*k + 1 < nb) && (influence->abscisses[*k + 1] <= x))
+      {
+        (*k)++;
+      }
+      indices[pos] = *k;
+      if ((x < influence->abscisses[0]) || (x > influence->abscisses[nb - 1]))
+      {
+        poids[pos * 2] = 0.;
+        poids[pos * 2 + 1] = 0.;
+      }
+      // Essieu exactement sur la dernière section.
+      else if (*k + 1 == nb)
+      {
+        poids[pos * 2] = (*charges)[i];
+        poids[pos * 2 + 1] = 0.;
+      }
+      else
+      {
+        double t = (x - influence->abscisses[*k]) /
+                   (influence->abscisses[*k + 1] - influence->abscisses[*k]);
+        
+        poids[pos * 2] = (*charges)[i] * (1. - t);
+        poids[pos * 2 + 1] = (*charges)[i] * t;
+      }
+    }
+  }
+  delete [] curseurs;
+  
+  // Pour chaque sollicitation de chaque section
+  //   Pour chaque position du convoi
+  //     S = somme des charges des essieux × ligne d'influence interpolée.
+  //     Mise à jour du maximum et du minimum.
+  //   FinPour
+  // FinPour
+  for (r = 0; r < nb * 6U; r++)
+  {
+    double *ligne = &influence->lignes[r * nb];
+    
+    for (j = 0; j < nb_pas; j++)
+    {
+      double somme = 0.;
+      
+      for (i = 0; i < nb_ess; i++)
+      {
+        size_t pos = j * nb_ess + i;
+        size_t k = indices[pos];
+        
+        somme += poids[pos * 2] * ligne[k];
+        if (poids[pos * 2 + 1] != 0.)
+        {
+          somme += poids[pos * 2 + 1] * ligne[k + 1];
+        }
+      }
+      maxi[r] = std::max (maxi[r], somme);
+      mini[r] = std::min (mini[r], somme);
+    }
+  }
+  
+  delete [] indices;
+  delete [] poids;
+  
+  return true;
+}
+
+
+/**
+ * \brief Libère les lignes d'influence.
+ * \param influence : les lignes d'influence.
+ * \return Rien.
+ */
+void
+EF_influence_free (EF_Influence *influence)
+{
+  if (influence == NULL)
+  {
+    return;
+  }
+  
+  delete [] influence->lignes;
+  delete influence;
+  
+  return;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -0,0 +1,42 @@
+/*
+ * 2lgc_code : calcul de résistance des matériaux selon les normes Eurocodes
+ * Copyright (C) 2011
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __EF_INFLUENCE_H
+#define __EF_INFLUENCE_H
+
+#include "config.h"
+#include "common_projet.hpp"
+
+bool EF_influence_calcule (Projet                 *p,
+                           std::list <EF_Barre *> *chemin,
+                           const double            direction[3],
+                           uint32_t                taille_bloc,
+                           EF_Influence          **influence)
+                                       __attribute__((__warn_unused_result__));
+bool EF_influence_convoi  (EF_Influence           *influence,
+                           std::vector <double>   *essieux,
+                           std::vector <double>   *charges,
+                           double                  pas,
+                           double                 *maxi,
+                           double                 *mini)
+                                       __attribute__((__warn_unused_result__));
+void EF_influence_free    (EF_Influence           *influence);
+
+#endif
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
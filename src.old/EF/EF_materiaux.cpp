@@ -422,6 +422,42 @@ EF_materiaux_G (EF_Materiau *materiau,
 }
 
 
+/**
+ * \brief Renvoie la masse volumique du matériau en kg/m³. Par défaut, les
+ *        valeurs de l'EN 1991-1-1, Annexe A sont utilisées : 25 kN/m³ pour le
+ *        béton armé et 77 kN/m³ pour l'acier.
+ * \param materiau : le matériau à analyser.
+ * \return
+ *   Succès : la masse volumique.\n
+ *   Échec : NAN :
+ *     - materiau == NULL,
+ *     - materiau inconnu.
+ */
+Flottant
+EF_materiaux_rho (EF_Materiau *materiau)
+{
+  BUGPARAM (materiau, "%p", materiau, m_f (NAN, FLOTTANT_ORDINATEUR))
+  
+  switch (materiau->type)
+  {
+    case MATERIAU_BETON :
+    {
+      return ((Materiau_Beton *) materiau->data)->rho;
+    }
+    case MATERIAU_ACIER :
+    {
+      return ((Materiau_Acier *) materiau->data)->rho;
+    }
+    default :
+    {
+      FAILCRIT (m_f (NAN, FLOTTANT_ORDINATEUR),
+                (gettext ("Matériau %d inconnu.\n"), materiau->type); )
+      break;
+    }
+  }
+}
+
+
 /**
  * \brief Fonction permettant de libérer un matériau.
  * \param materiau : matériau à libérer.
@@ -43,6 +43,8 @@ Flottant EF_materiaux_E    (EF_Materiau *materiau)
 Flottant EF_materiaux_G    (EF_Materiau *materiau,
                                        bool         nu_null)
                                        __attribute__((__warn_unused_result__));
+Flottant EF_materiaux_rho  (EF_Materiau *materiau)
+                                       __attribute__((__warn_unused_result__));
 
 bool EF_materiaux_supprime (EF_Materiau *materiau,
                             Projet      *p)
@@ -0,0 +1,1088 @@
+/*
+ * 2lgc_code : calcul de résistance des matériaux selon les normes Eurocodes
+ * Copyright (C) 2011
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include <algorithm>
+#include <locale>
+#include <cmath>
+#include <string.h>
+
+#include "common_projet.hpp"
+#include "common_erreurs.hpp"
+#include "common_math.hpp"
+#include "common_text.hpp"
+#include "EF_calculs.hpp"
+#include "EF_materiaux.hpp"
+#include "EF_noeuds.hpp"
+#include "EF_sections.hpp"
+#include "EF_modes.hpp"
+
+
+/**
+ * \brief Calcule la matrice de masse élémentaire d'un tronçon dans le repère
+ *        local. La matrice cohérente est celle de la poutre d'Euler-Bernoulli
+ *        (fonctions de forme cubiques en flexion, linéaires en traction et
+ *        torsion). La matrice concentrée répartit la moitié de la masse et de
+ *        l'inertie de rotation du tronçon sur chacun de ses noeuds.
+ * \param rho : la masse volumique en kg/m³,
+ * \param s : l'aire de la section en m²,
+ * \param iy : l'inertie de la section selon l'axe y en m⁴,
+ * \param iz : l'inertie de la section selon l'axe z en m⁴,
+ * \param ll : la longueur du tronçon en m,
+ * \param coherente : true pour la matrice cohérente, false pour la matrice
+ *                    concentrée,
+ * \param m_loc : la matrice 12×12 stockée colonne par colonne.
+ * \return Rien.
+ */
+static void
+EF_modes_masse_element (double rho,
+                        double s,
+                        double iy,
+                        double iz,
+                        double ll,
+                        bool   coherente,
+                        double m_loc[144])
+{
+  double mm = rho * s * ll;
+  double jp = rho * (iy + iz) * ll;
+  
+  memset (m_loc, 0, sizeof (double) * 144);
+#define M_LOC(I, J, V) m_loc[(J) * 12 + (I)] = (V); m_loc[(I) * 12 + (J)] = (V);
+  if (!coherente)
+  {
+    M_LOC (0, 0, mm / 2.)
+    M_LOC (1, 1, mm / 2.)
+    M_LOC (2, 2, mm / 2.)
+    M_LOC (3, 3, jp / 2.)
+    M_LOC (4, 4, rho * iy * ll / 2.)
+    M_LOC (5, 5, rho * iz * ll / 2.)
+    M_LOC (6, 6, mm / 2.)
+    M_LOC (7, 7, mm / 2.)
+    M_LOC (8, 8, mm / 2.)
+    M_LOC (9, 9, jp / 2.)
+    M_LOC (10, 10, rho * iy * ll / 2.)
+    M_LOC (11, 11, rho * iz * ll / 2.)
+  }
+  else
+  {
+    double c = mm / 420.;
+    
+    // Traction et torsion.
+    M_LOC (0, 0, mm / 3.)
+    M_LOC (0, 6, mm / 6.)
+    M_LOC (6, 6, mm / 3.)
+    M_LOC (3, 3, jp / 3.)
+    M_LOC (3, 9, jp / 6.)
+    M_LOC (9, 9, jp / 3.)
+    // Flexion dans le plan xy (v, rz).
+    M_LOC (1, 1, 156. * c)
+    M_LOC (1, 5, 22. * ll * c)
+    M_LOC (1, 7, 54. * c)
+    M_LOC (1, 11, -13. * ll * c)
+    M_LOC (5, 5, 4. * ll * ll * c)
+    M_LOC (5, 7, 13. * ll * c)
+    M_LOC (5, 11, -3. * ll * ll * c)
+    M_LOC (7, 7, 156. * c)
+    M_LOC (7, 11, -22. * ll * c)
+    M_LOC (11, 11, 4. * ll * ll * c)
+    // Flexion dans le plan xz (w, ry).
+    M_LOC (2, 2, 156. * c)
+    M_LOC (2, 4, -22. * ll * c)
+    M_LOC (2, 8, 54. * c)
+    M_LOC (2, 10, 13. * ll * c)
+    M_LOC (4, 4, 4. * ll * ll * c)
+    M_LOC (4, 8, -13. * ll * c)
+    M_LOC (4, 10, -3. * ll * ll * c)
+    M_LOC (8, 8, 156. * c)
+    M_LOC (8, 10, 22. * ll * c)
+    M_LOC (10, 10, 4. * ll * ll * c)
+  }
+#undef M_LOC
+  
+  return;
+}
+
+
+/**
+ * \brief Assemble la matrice de masse sur les degrés de liberté libres de la
+ *        matrice de rigidité partielle, avec la même numérotation (n_part).
+ *        Seul le triangle supérieur est stocké (stype = 1) : la matrice a la
+ *        structure de m_part pour la masse cohérente et est diagonale pour
+ *        la masse concentrée.
+ * \param p : la variable projet,
+ * \param coherente : true pour la masse cohérente, false pour la masse
+ *                    concentrée,
+ * \param masse : la matrice de masse, à libérer par cholmod_free_sparse.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - p->calculs.m_part == NULL,
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+bool
+EF_modes_masse (Projet          *p,
+                bool             coherente,
+                cholmod_sparse **masse)
+{
+  cholmod_triplet *triplet;
+  int             *ti, *tj; // NS
+  double          *tx;
+  size_t           n;
+  
+  std::list <EF_Barre *>::iterator it;
+  
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (p->calculs.m_part, "%p", p->calculs.m_part, false)
+  
+  n = p->calculs.m_part->nrow;
+  BUGCRIT (triplet = cholmod_allocate_triplet (n,
+                                               n,
+                                               78U * p->calculs.nb_troncons,
+                                               1,
+                                               CHOLMOD_REAL,
+                                               p->calculs.c),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  ti = (int *) triplet->i;
+  tj = (int *) triplet->j;
+  tx = (double *) triplet->x;
+  
+  // Pour chaque tronçon de chaque barre
+  //   Calcul de la matrice de masse locale puis globale.
+  //   Ajout des termes du triangle supérieur dont les deux degrés de liberté
+  //   sont libres.
+  // FinPour
+  it = p->modele.barres.begin ();
+  while (it != p->modele.barres.end ())
+  {
+    EF_Barre *barre = *it;
+    double    rho, s, iy, iz;
+    size_t    t;
+    
+    std::vector <EF_Noeud *> noeuds;
+    
+    rho = m_g (EF_materiaux_rho (barre->materiau));
+    s = m_g (EF_sections_s (barre->section));
+    iy = m_g (EF_sections_iy (barre->section));
+    iz = m_g (EF_sections_iz (barre->section));
+    noeuds.push_back (barre->noeud_debut);
+    noeuds.insert (noeuds.end (),
+                   barre->nds_inter.begin (),
+                   barre->nds_inter.end ());
+    noeuds.push_back (barre->noeud_fin);
+    
+    for (t = 0; t + 1 < noeuds.size (); t++)
+    {
+      double  m_loc[144], m_glob[144];
+      uint8_t ii, jj;
+      
+      EF_modes_masse_element (rho,
+                              s,
+                              iy,
+                              iz,
+                              EF_noeuds_distance (noeuds[t + 1], noeuds[t]),
+                              coherente,
+                              m_loc);
+      common_math_rotation_rigidite (barre->rot, m_loc, m_glob);
+      for (jj = 0; jj < 12; jj++)
+      {
+        uint32_t col = p->calculs.n_part[noeuds[t + jj / 6U]->indice][jj % 6];
+        
+        if (col >= n)
+        {
+          continue;
+        }
+        for (ii = 0; ii < 12; ii++)
+        {
+          uint32_t lig;
+          
+          lig = p->calculs.n_part[noeuds[t + ii / 6U]->indice][ii % 6];
+          if ((lig > col) || (m_glob[jj * 12 + ii] == 0.))
+          {
+            continue;
+          }
+          ti[triplet->nnz] = (int) lig;
+          tj[triplet->nnz] = (int) col;
+          tx[triplet->nnz] = m_glob[jj * 12 + ii];
+          triplet->nnz++;
+        }
+      }
+    }
+    
+    ++it;
+  }
+  
+  *masse = cholmod_triplet_to_sparse (triplet, triplet->nnz, p->calculs.c);
+  cholmod_free_triplet (&triplet, p->calculs.c);
+  BUGCRIT (*masse,
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  
+  return true;
+}
+
+
+/**
+ * \brief Calcule {y} = [M]{x} sans allocation.
+ * \param p : la variable projet,
+ * \param masse : la matrice de masse (stype = 1),
+ * \param x : le vecteur (masse->nrow valeurs),
+ * \param y : le résultat (masse->nrow valeurs).
+ * \return Rien.
+ */
+static void
+EF_modes_produit (Projet         *p,
+                  cholmod_sparse *masse,
+                  double         *x,
+                  double         *y)
+{
+  cholmod_dense dx, dy;
+  double        one[2] = {1., 0.}, zero[2] = {0., 0.};
+  
+  memset (&dx, 0, sizeof (dx));
+  dx.nrow = masse->nrow;
+  dx.ncol = 1;
+  dx.nzmax = masse->nrow;
+  dx.d = masse->nrow;
+  dx.x = x;
+  dx.xtype = CHOLMOD_REAL;
+  dx.dtype = CHOLMOD_DOUBLE;
+  dy = dx;
+  dy.x = y;
+  cholmod_sdmult (masse, 0, one, zero, &dx, &dy, p->calculs.c);
+  
+  return;
+}
+
+
+/**
+ * \struct EF_Modes_Operateur
+ * \brief Factorisation de [K] - σ [M] utilisée par l'analyse modale.
+ */
+typedef struct
+{
+  /// Factorisation de Cholesky, NULL si la factorisation LU est utilisée.
+  cholmod_factor *factor;
+  /// Factorisation LU d'UMFPACK de la matrice ap, ai, ax.
+  void           *numeric;
+  /// Début de chaque colonne de la matrice factorisée par LU.
+  int            *ap; // NS
+  /// Ligne de chaque terme de la matrice factorisée par LU.
+  int            *ai; // NS
+  /// Valeur de chaque terme de la matrice factorisée par LU.
+  double         *ax;
+  /// Matrice complète [K] - σ [M] propre à la factorisation LU, NULL sinon.
+  cholmod_sparse *a;
+  /// true si les factorisations sont propres à l'analyse modale.
+  /** false si ce sont celles du solveur (p->calculs.factor ou
+   *  p->calculs.numeric), qui ne doivent pas être libérées.
+   */
+  bool            propre;
+} EF_Modes_Operateur;
+
+
+/**
+ * \brief Libère la factorisation de [K] - σ [M] si elle est propre à
+ *        l'analyse modale.
+ * \param p : la variable projet,
+ * \param op : la factorisation.
+ * \return Rien.
+ */
+static void
+EF_modes_operateur_free (Projet             *p,
+                         EF_Modes_Operateur *op)
+{
+  if (!op->propre)
+  {
+    return;
+  }
+  
+  if (op->factor != NULL)
+  {
+    cholmod_free_factor (&op->factor, p->calculs.c);
+  }
+  if (op->numeric != NULL)
+  {
+    umfpack_di_free_numeric (&op->numeric);
+  }
+  if (op->a != NULL)
+  {
+    cholmod_free_sparse (&op->a, p->calculs.c);
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Factorise [K] - σ [M]. Sans décalage, la factorisation du solveur
+ *        est réutilisée si elle existe (Cholesky ou LU). Sinon, la
+ *        factorisation de Cholesky est tentée en reprenant l'analyse
+ *        symbolique conservée et la factorisation LU est utilisée si la
+ *        matrice n'est pas définie positive (décalage supérieur à la plus
+ *        basse valeur propre).
+ * \param p : la variable projet,
+ * \param masse : la matrice de masse (stype = 1),
+ * \param decalage : le décalage σ en (rad/s)²,
+ * \param op : la factorisation, à libérer par #EF_modes_operateur_free.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - matrice [K] - σ [M] singulière,
+ *     - en cas d'erreur d'allocation mémoire,
+ *     - en cas d'erreur de calcul.
+ */
+static bool
+EF_modes_factorise (Projet             *p,
+                    cholmod_sparse     *masse,
+                    double              decalage,
+                    EF_Modes_Operateur *op)
+{
+  cholmod_sparse *k_sym;
+  cholmod_factor *factor;
+  void           *symbolic;
+  size_t          n = p->calculs.m_part->nrow;
+  int             status; // NS
+  
+  memset (op, 0, sizeof (EF_Modes_Operateur));
+  
+  if (decalage == 0.)
+  {
+    if (p->calculs.factor != NULL)
+    {
+      op->factor = p->calculs.factor;
+      
+      return true;
+    }
+    if (p->calculs.numeric != NULL)
+    {
+      op->numeric = p->calculs.numeric;
+      op->ap = p->calculs.ap;
+      op->ai = p->calculs.ai;
+      op->ax = p->calculs.ax;
+      
+      return true;
+    }
+  }
+  op->propre = true;
+  
+  // Triangle supérieur de [K] - σ [M]. La structure de la matrice de masse
+  // est incluse dans celle de m_part.
+  BUGCRIT (k_sym = cholmod_copy (p->calculs.m_part, 1, 1, p->calculs.c),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  if (decalage != 0.)
+  {
+    cholmod_sparse *somme;
+    double          alpha[2] = {1., 0.}, beta[2] = {-decalage, 0.};
+    
+    somme = cholmod_add (k_sym, masse, alpha, beta, 1, 1, p->calculs.c);
+    cholmod_free_sparse (&k_sym, p->calculs.c);
+    BUGCRIT (k_sym = somme,
+             false,
+             (gettext ("Erreur d'allocation mémoire.\n")); )
+  }
+  
+  if (p->calculs.symbolique_chol != NULL)
+  {
+    factor = cholmod_copy_factor (p->calculs.symbolique_chol, p->calculs.c);
+  }
+  else
+  {
+    factor = cholmod_analyze (k_sym, p->calculs.c);
+  }
+  BUGCRIT (factor,
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n"));
+             cholmod_free_sparse (&k_sym, p->calculs.c); )
+  cholmod_factorize (k_sym, factor, p->calculs.c);
+  if ((p->calculs.c->status == CHOLMOD_OK) && (factor->minor == n))
+  {
+    cholmod_free_sparse (&k_sym, p->calculs.c);
+    op->factor = factor;
+    
+    return true;
+  }
+  cholmod_free_factor (&factor, p->calculs.c);
+  
+  // Matrice non définie positive : factorisation LU de la matrice complète.
+  op->a = cholmod_copy (k_sym, 0, 1, p->calculs.c);
+  cholmod_free_sparse (&k_sym, p->calculs.c);
+  BUGCRIT (op->a,
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  op->ap = (int *) op->a->p;
+  op->ai = (int *) op->a->i;
+  op->ax = (double *) op->a->x;
+  status = umfpack_di_symbolic ((int) n,
+                                (int) n,
+                                op->ap,
+                                op->ai,
+                                op->ax,
+                                &symbolic,
+                                NULL,
+                                NULL);
+  BUGCRIT (status == UMFPACK_OK,
+           false,
+           (gettext ("Erreur de calcul : %d\n"), status);
+             EF_modes_operateur_free (p, op); )
+  status = umfpack_di_numeric (op->ap,
+                               op->ai,
+                               op->ax,
+                               symbolic,
+                               &op->numeric,
+                               NULL,
+                               NULL);
+  umfpack_di_free_symbolic (&symbolic);
+  INFO (status == UMFPACK_OK,
+        false,
+        (gettext ("La matrice [K] - σ [M] est singulière (σ = %g). Pour une structure possédant des modes de corps rigide, un décalage négatif doit être utilisé.\n"),
+           decalage);
+          EF_modes_operateur_free (p, op); )
+  
+  return true;
+}
+
+
+/**
+ * \brief Calcule {y} = ([K] - σ [M])^-1 {x} avec la factorisation de
+ *        #EF_modes_factorise.
+ * \param p : la variable projet,
+ * \param op : la factorisation,
+ * \param x : le second membre (m_part->nrow valeurs),
+ * \param y : la solution (m_part->nrow valeurs).
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - en cas d'erreur d'allocation mémoire,
+ *     - en cas d'erreur de calcul.
+ */
+static bool
+EF_modes_resoud (Projet             *p,
+                 EF_Modes_Operateur *op,
+                 double             *x,
+                 double             *y)
+{
+  cholmod_dense  b, *sol;
+  int            status; // NS
+  
+  if (op->factor == NULL)
+  {
+    status = umfpack_di_solve (UMFPACK_A,
+                               op->ap,
+                               op->ai,
+                               op->ax,
+                               y,
+                               x,
+                               op->numeric,
+                               NULL,
+                               NULL);
+    BUGCRIT (status == UMFPACK_OK,
+             false,
+             (gettext ("Erreur de calcul : %d\n"), status); )
+    
+    return true;
+  }
+  
+  memset (&b, 0, sizeof (b));
+  b.nrow = op->factor->n;
+  b.ncol = 1;
+  b.nzmax = op->factor->n;
+  b.d = op->factor->n;
+  b.x = x;
+  b.xtype = CHOLMOD_REAL;
+  b.dtype = CHOLMOD_DOUBLE;
+  BUGCRIT (sol = cholmod_solve (CHOLMOD_A, op->factor, &b, p->calculs.c),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  memcpy (y, sol->x, sizeof (double) * op->factor->n);
+  cholmod_free_dense (&sol, p->calculs.c);
+  
+  return true;
+}
+
+
+/**
+ * \brief Nouvelle direction de la base de Lanczos lorsque l'espace de Krylov
+ *        est invariant (vecteur de départ sans composante sur certains
+ *        modes, structure symétrique…) : ([K] - σ [M])^-1 [M] {v} pour un
+ *        vecteur {v} pseudo-aléatoire, [M]-orthogonalisé deux fois par
+ *        rapport aux j premiers vecteurs de la base.
+ * \param p : la variable projet,
+ * \param masse : la matrice de masse (stype = 1),
+ * \param op : la factorisation de [K] - σ [M],
+ * \param q : la base de Lanczos (j vecteurs de masse->nrow valeurs),
+ * \param j : le nombre de vecteurs de la base,
+ * \param graine : le numéro du tirage,
+ * \param r : la nouvelle direction (masse->nrow valeurs),
+ * \param mr : [M]{r} (masse->nrow valeurs),
+ * \param norme : la norme de {r} par rapport à [M], 0 si l'opérateur n'a
+ *                plus de direction indépendante de la base.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - #EF_modes_resoud.
+ */
+static bool
+EF_modes_direction (Projet             *p,
+                    cholmod_sparse     *masse,
+                    EF_Modes_Operateur *op,
+                    double             *q,
+                    size_t              j,
+                    uint32_t            graine,
+                    double             *r,
+                    double             *mr,
+                    double             *norme)
+{
+  size_t  n = masse->nrow, i, l;
+  double  norme_0;
+  uint8_t passe;
+  
+  graine = graine * 2654435761U + 1U;
+  for (i = 0; i < n; i++)
+  {
+    graine = graine * 1103515245U + 12345U;
+    mr[i] = (double) (graine >> 16) / 65536. - 0.5;
+  }
+  EF_modes_produit (p, masse, mr, r);
+  BUG (EF_modes_resoud (p, op, r, mr), false)
+  memcpy (r, mr, sizeof (double) * n);
+  EF_modes_produit (p, masse, r, mr);
+  norme_0 = 0.;
+  for (i = 0; i < n; i++)
+  {
+    norme_0 += r[i] * mr[i];
+  }
+  for (passe = 0; passe < 2; passe++)
+  {
+    for (l = 0; l < j; l++)
+    {
+      double c = 0.;
+      
+      for (i = 0; i < n; i++)
+      {
+        c += q[l * n + i] * mr[i];
+      }
+      for (i = 0; i < n; i++)
+      {
+        r[i] -= c * q[l * n + i];
+      }
+    }
+    EF_modes_produit (p, masse, r, mr);
+  }
+  *norme = 0.;
+  for (i = 0; i < n; i++)
+  {
+    *norme += r[i] * mr[i];
+  }
+  if (*norme <= 1.e-20 * norme_0)
+  {
+    *norme = 0.;
+  }
+  else
+  {
+    *norme = sqrt (*norme);
+  }
+  
+  return true;
+}
+
+
+/**
+ * \brief Calcule les nb_modes modes propres de la structure dont ω² est le
+ *        plus proche du décalage σ par la méthode de Lanczos en inverse avec
+ *        décalage et redémarrages épais :\end{verbatim}
+ *        \begin{displaymath}
+ *        ([K] - \sigma \cdot [M])^{-1} \cdot [M] \cdot \{\phi\} = \theta
+ *        \cdot \{\phi\} \texttt{ avec } \omega^2 = \sigma + \frac{1}{\theta}
+ *        \end{displaymath}\begin{verbatim}
+ *        Les plus grandes valeurs de |θ| correspondent aux modes les plus
+ *        proches du décalage. Avec σ = 0, ce sont les plus basses fréquences
+ *        et la factorisation du solveur est réutilisée si elle existe. Un
+ *        décalage négatif rend [K] - σ [M] définie positive pour une
+ *        structure possédant des modes de corps rigide (fréquence nulle).
+ *        La base de Lanczos, orthonormée par rapport à [M] et
+ *        réorthogonalisée à chaque itération, est limitée à
+ *        max (2 × nb_modes, nb_modes + 10) vecteurs. Lorsqu'elle est pleine,
+ *        elle est réduite aux meilleurs vecteurs de Ritz (redémarrage épais)
+ *        avant de poursuivre les itérations : la mémoire reste
+ *        proportionnelle à nb_modes × nrow. Aucune matrice dense de la taille
+ *        du modèle n'est formée.
+ *        Les modes sont stockés dans p->calculs.modes.\n
+ *        Cette fonction n'est pour l'instant pas appelée par l'interface :
+ *        elle doit être appelée par l'utilisateur de la bibliothèque après
+ *        #EF_calculs_genere_mat_rig.
+ * \param p : la variable projet,
+ * \param nb_modes : le nombre de modes à calculer,
+ * \param decalage : le décalage σ en (rad/s)², 0 pour les plus basses
+ *                   fréquences,
+ * \param coherente : true pour la masse cohérente, false pour la masse
+ *                    concentrée.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - p->calculs.m_part == NULL (#EF_calculs_genere_mat_rig non lancée),
+ *     - condensation statique active,
+ *     - #EF_modes_factorise,
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+bool
+EF_modes_calcule (Projet  *p,
+                  uint32_t nb_modes,
+                  double   decalage,
+                  bool     coherente)
+{
+  cholmod_sparse    *masse;
+  EF_Modes_Operateur op;
+  size_t             n, m, j, l, i, c, nb_gardes, iter;
+  double             norme, a, b_j;
+  uint32_t           k, nb_conv, nb_redemarrages, nb_directions;
+  bool               converge, rupture;
+  
+  std::vector <double> q, r, mr, mq, t, t_ritz, valeurs, vecteurs, w;
+  std::vector <size_t> ordre;
+  std::vector <EF_Mode *>::iterator it;
+  
+  BUGPARAM (p, "%p", p, false)
+  INFO (p->calculs.m_part,
+        false,
+        (gettext ("Il est nécessaire de lancer la fonction EF_calculs_genere_mat_rig avant.\n")); )
+  INFO (p->calculs.cond_x == NULL,
+        false,
+        (gettext ("L'analyse modale n'est pas compatible avec la condensation statique des noeuds intermédiaires.\n")); )
+  
+  EF_modes_free (p);
+  p->calculs.modes = new std::vector <EF_Mode *> ();
+  n = p->calculs.m_part->nrow;
+  nb_modes = (uint32_t) std::min ((size_t) nb_modes, n);
+  if (nb_modes == 0)
+  {
+    return true;
+  }
+  
+  BUG (EF_modes_masse (p, coherente, &masse), false)
+  BUG (EF_modes_factorise (p, masse, decalage, &op),
+       false,
+       cholmod_free_sparse (&masse, p->calculs.c); )
+#define FREE_ALL \
+  EF_modes_operateur_free (p, &op); \
+  cholmod_free_sparse (&masse, p->calculs.c);
+  
+  // Taille maximale de la base de Lanczos.
+  m = std::min (n, std::max (2U * (size_t) nb_modes, (size_t) nb_modes + 10U));
+  q.resize (m * n);
+  t.assign (m * m, 0.);
+  r.resize (n);
+  mr.resize (n);
+  mq.resize (n);
+  w.resize (m);
+  
+  // Vecteur de départ : ([K] - σ [M])^-1 [M] {1}, dans l'image de
+  // l'opérateur même si la matrice de masse est singulière.
+  std::fill (r.begin (), r.end (), 1.);
+  EF_modes_produit (p, masse, &r[0], &mq[0]);
+  BUG (EF_modes_resoud (p, &op, &mq[0], &r[0]), false, FREE_ALL)
+  EF_modes_produit (p, masse, &r[0], &mr[0]);
+  norme = 0.;
+  for (i = 0; i < n; i++)
+  {
+    norme += r[i] * mr[i];
+  }
+  INFO (norme > 0.,
+        false,
+        (gettext ("La matrice de masse est nulle.\n"));
+          FREE_ALL)
+  norme = sqrt (norme);
+  for (i = 0; i < n; i++)
+  {
+    q[i] = r[i] / norme;
+    mq[i] = mr[i] / norme;
+  }
+  
+  // Pour chaque itération j de Lanczos
+  //   {r} = ([K] - σ [M])^-1 [M] {q_j} - alpha_j {q_j} - somme des
+  //         couplages connus de {q_j} : beta_j-1 {q_j-1} ou, juste après un
+  //         redémarrage, ceux des vecteurs de Ritz conservés.
+  //   Réorthogonalisation de {r} par rapport à toute la base.
+  //   beta_j = sqrt ({r}^T [M] {r}), {q_j+1} = {r} / beta_j
+  //   Si beta_j est nul (sous-espace invariant), {q_j+1} est une nouvelle
+  //   direction sans couplage avec la base (#EF_modes_direction).
+  //   Lorsque la base est pleine, calcul des valeurs de Ritz par
+  //   décomposition de la matrice projetée [T] (m × m) et arrêt si les
+  //   nb_modes plus grandes en valeur absolue ont convergé. Sinon, la base
+  //   est remplacée par les nb_gardes meilleurs vecteurs de Ritz, [T]
+  //   devenant diagonale bordée de leurs couplages avec {q_j+1}.
+  // FinPour
+  j = 0;
+  iter = 0;
+  nb_redemarrages = 0;
+  nb_directions = 0;
+  nb_conv = 0;
+  converge = false;
+  while (!converge)
+  {
+    double *qj = &q[j * n];
+    
+    BUG (EF_modes_resoud (p, &op, &mq[0], &r[0]), false, FREE_ALL)
+    iter++;
+    a = 0.;
+    for (i = 0; i < n; i++)
+    {
+      a += mq[i] * r[i];
+    }
+    for (i = 0; i < n; i++)
+    {
+      r[i] -= a * qj[i];
+    }
+    for (l = 0; l < j; l++)
+    {
+      if (t[l * m + j] == 0.)
+      {
+        continue;
+      }
+      for (i = 0; i < n; i++)
+      {
+        r[i] -= t[l * m + j] * q[l * n + i];
+      }
+    }
+    EF_modes_produit (p, masse, &r[0], &mr[0]);
+    for (l = 0; l <= j; l++)
+    {
+      double d = 0.;
+      
+      for (i = 0; i < n; i++)
+      {
+        d += q[l * n + i] * mr[i];
+      }
+      for (i = 0; i < n; i++)
+      {
+        r[i] -= d * q[l * n + i];
+      }
+      if (l == j)
+      {
+        a += d;
+      }
+    }
+    t[j * m + j] = a;
+    EF_modes_produit (p, masse, &r[0], &mr[0]);
+    b_j = 0.;
+    for (i = 0; i < n; i++)
+    {
+      b_j += r[i] * mr[i];
+    }
+    b_j = sqrt (std::max (b_j, 0.));
+    j++;
+    rupture = b_j <= 1.e-14 * fabs (a);
+    if ((j < m) && rupture)
+    {
+      BUG (EF_modes_direction (p,
+                               masse,
+                               &op,
+                               &q[0],
+                               j,
+                               nb_directions,
+                               &r[0],
+                               &mr[0],
+                               &b_j),
+           false,
+           FREE_ALL)
+      nb_directions++;
+    }
+    else if (j < m)
+    {
+      t[(j - 1) * m + j] = b_j;
+      t[j * m + j - 1] = b_j;
+    }
+    
+    if ((j == m) || (b_j == 0.))
+    {
+      // Valeurs de Ritz de la matrice projetée [T] (j × j).
+      t_ritz.resize (j * j);
+      valeurs.resize (j);
+      vecteurs.resize (j * j);
+      for (c = 0; c < j; c++)
+      {
+        for (l = 0; l < j; l++)
+        {
+          t_ritz[c * j + l] = t[c * m + l];
+        }
+      }
+      common_math_valeurs_propres (&t_ritz[0],
+                                   (uint32_t) j,
+                                   &valeurs[0],
+                                   &vecteurs[0]);
+      
+      // Valeurs de Ritz par |θ| décroissant.
+      ordre.clear ();
+      for (c = 0; c < j; c++)
+      {
+        l = ordre.size ();
+        ordre.push_back (c);
+        while ((l > 0) && (fabs (valeurs[ordre[l - 1]]) < fabs (valeurs[c])))
+        {
+          ordre[l] = ordre[l - 1];
+          l--;
+        }
+        ordre[l] = c;
+      }
+      
+      // Estimation du résidu : |beta_j . s_j|.
+      nb_conv = 0;
+      for (k = 0; k < std::min ((size_t) nb_modes, j); k++)
+      {
+        if (fabs (b_j * vecteurs[ordre[k] * j + j - 1]) <=
+                                             1.e-10 * fabs (valeurs[ordre[k]]))
+        {
+          nb_conv++;
+        }
+      }
+      
+      // Le nombre de redémarrages est borné pour un spectre très resserré
+      // autour du décalage.
+      converge = (nb_conv == nb_modes) || (j == n) || (b_j == 0.) ||
+                 (nb_redemarrages == 100);
+      if (!converge)
+      {
+        // Redémarrage épais : [Q] = [Q] [S] colonne par colonne pour les
+        // nb_gardes premiers vecteurs de Ritz, ligne par ligne sans copie
+        // de la base.
+        nb_gardes = std::min (j - 1, (size_t) nb_modes + (j - nb_modes) / 2);
+        for (i = 0; i < n; i++)
+        {
+          for (c = 0; c < nb_gardes; c++)
+          {
+            w[c] = 0.;
+            for (l = 0; l < j; l++)
+            {
+              w[c] += q[l * n + i] * vecteurs[ordre[c] * j + l];
+            }
+          }
+          for (c = 0; c < nb_gardes; c++)
+          {
+            q[c * n + i] = w[c];
+          }
+        }
+        std::fill (t.begin (), t.end (), 0.);
+        for (c = 0; c < nb_gardes; c++)
+        {
+          t[c * m + c] = valeurs[ordre[c]];
+          if (!rupture)
+          {
+            t[c * m + nb_gardes] = b_j * vecteurs[ordre[c] * j + j - 1];
+            t[nb_gardes * m + c] = t[c * m + nb_gardes];
+          }
+        }
+        j = nb_gardes;
+        nb_redemarrages++;
+        if (rupture)
+        {
+          BUG (EF_modes_direction (p,
+                                   masse,
+                                   &op,
+                                   &q[0],
+                                   j,
+                                   nb_directions,
+                                   &r[0],
+                                   &mr[0],
+                                   &b_j),
+               false,
+               FREE_ALL)
+          nb_directions++;
+          converge = (b_j == 0.);
+        }
+      }
+    }
+    
+    if (!converge)
+    {
+      for (i = 0; i < n; i++)
+      {
+        q[j * n + i] = r[i] / b_j;
+        mq[i] = mr[i] / b_j;
+      }
+    }
+  }
+  // FinPour
+  
+  // Pour chaque mode
+  //   {phi} = [Q] {s}, omega = sqrt (σ + 1 / theta).
+  //   Masse modale effective selon d : ({phi}^T [M] {r_d})².
+  //   Insertion par fréquence croissante.
+  // FinPour
+  for (k = 0; k < std::min ((size_t) nb_modes, ordre.size ()); k++)
+  {
+    EF_Mode *mode;
+    double  *x;
+    int     *ip, *ii; // NS
+    size_t   col = ordre[k];
+    uint8_t  d;
+    
+    if (valeurs[col] == 0.)
+    {
+      continue;
+    }
+    std::fill (r.begin (), r.end (), 0.);
+    for (l = 0; l < j; l++)
+    {
+      for (i = 0; i < n; i++)
+      {
+        r[i] += q[l * n + i] * vecteurs[col * j + l];
+      }
+    }
+    EF_modes_produit (p, masse, &r[0], &mr[0]);
+    
+    mode = new EF_Mode;
+    // Les modes de corps rigide peuvent donner σ + 1 / θ légèrement
+    // négatif.
+    mode->pulsation = sqrt (std::max (decalage + 1. / valeurs[col], 0.));
+    mode->frequence = mode->pulsation / (2. * M_PI);
+    mode->deformee = cholmod_allocate_sparse (6U * p->calculs.nb_noeuds,
+                                              1,
+                                              6U * p->calculs.nb_noeuds,
+                                              true,
+                                              true,
+                                              0,
+                                              CHOLMOD_REAL,
+                                              p->calculs.c);
+    BUGCRIT (mode->deformee,
+             false,
+             (gettext ("Erreur d'allocation mémoire.\n"));
+               delete mode;
+               FREE_ALL)
+    ip = (int *) mode->deformee->p;
+    ii = (int *) mode->deformee->i;
+    x = (double *) mode->deformee->x;
+    ip[0] = 0;
+    ip[1] = (int) (6U * p->calculs.nb_noeuds);
+    for (d = 0; d < 3; d++)
+    {
+      mode->masse_effective[d] = 0.;
+    }
+    for (l = 0; l < p->calculs.nb_noeuds; l++)
+    {
+      for (d = 0; d < 6; d++)
+      {
+        uint32_t ddl = p->calculs.n_part[l][d];
+        
+        ii[l * 6 + d] = (int) (l * 6 + d);
+        x[l * 6 + d] = ddl < n ? r[ddl] : 0.;
+        if ((d < 3) && (ddl < n))
+        {
+          mode->masse_effective[d] += mr[ddl];
+        }
+      }
+    }
+    for (d = 0; d < 3; d++)
+    {
+      mode->masse_effective[d] *= mode->masse_effective[d];
+    }
+    it = p->calculs.modes->begin ();
+    while ((it != p->calculs.modes->end ()) &&
+           ((*it)->frequence <= mode->frequence))
+    {
+      ++it;
+    }
+    p->calculs.modes->insert (it, mode);
+  }
+  
+  FREE_ALL
+#undef FREE_ALL
+  
+  EF_calculs_rapport_ajout (
+    p,
+    format (gettext ("Analyse modale (masse %s, décalage %g (rad/s)²)"),
+            coherente ? gettext ("cohérente") : gettext ("concentrée"),
+            decalage),
+    (p->calculs.modes->size () == nb_modes) && (nb_conv == nb_modes) ? 0 : 1,
+    format (gettext ("%zu modes sur %u demandés dont %u convergés, %zu itérations de Lanczos, %u redémarrages."),
+            p->calculs.modes->size (),
+            nb_modes,
+            nb_conv,
+            iter,
+            nb_redemarrages));
+  
+  return true;
+}
+
+
+/**
+ * \brief Affiche les modes propres calculés.
+ * \param p : la variable projet.
+ * \return Rien.
+ */
+void
+EF_modes_affiche (Projet *p)
+{
+  std::vector <EF_Mode *>::iterator it;
+  uint32_t i;
+  
+  BUGPARAM (p, "%p", p, )
+  
+  if ((p->calculs.modes == NULL) || (p->calculs.modes->empty ()))
+  {
+    printf (gettext ("Aucun mode propre calculé.\n"));
+    return;
+  }
+  
+  printf (gettext ("Mode\tFréquence (Hz)\tMasse effective x, y, z (kg)\n"));
+  i = 1;
+  for (it = p->calculs.modes->begin (); it != p->calculs.modes->end (); ++it)
+  {
+    printf ("%u\t%g\t%g\t%g\t%g\n",
+            i,
+            (*it)->frequence,
+            (*it)->masse_effective[0],
+            (*it)->masse_effective[1],
+            (*it)->masse_effective[2]);
+    i++;
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Libère les modes propres calculés.
+ * \param p : la variable projet.
+ * \return Rien.
+ */
+void
+EF_modes_free (Projet *p)
+{
+  std::vector <EF_Mode *>::iterator it;
+  
+  if (p->calculs.modes == NULL)
+  {
+    return;
+  }
+  
+  for (it = p->calculs.modes->begin (); it != p->calculs.modes->end (); ++it)
+  {
+    cholmod_free_sparse (&(*it)->deformee, p->calculs.c);
+    delete *it;
+  }
+  delete p->calculs.modes;
+  p->calculs.modes = NULL;
+  
+  return;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
@@ -181,6 +181,8 @@ EF_noeuds_ajout_noeud_libre (Projet   *p,
        delete data;
          delete noeud_nouveau; )
   
+  noeud_nouveau->indice = p->modele.noeuds.size ();
+  noeud_nouveau->sous_structure = 0;
   p->modele.noeuds.push_back (noeud_nouveau);
   
 #ifdef ENABLE_GTK
@@ -262,6 +264,8 @@ EF_noeuds_ajout_noeud_barre (Projet   *p,
        delete data;
          delete noeud_nouveau; )
   
+  noeud_nouveau->indice = p->modele.noeuds.size ();
+  noeud_nouveau->sous_structure = 0;
   p->modele.noeuds.push_back (noeud_nouveau);
   
   it = barre->nds_inter.begin ();
@@ -615,6 +619,37 @@ EF_noeuds_change_appui (Projet   *p,
 }
 
 
+/**
+ * \brief Change la sous-structure d'un noeud pour le solveur
+ *        EF_SOLVEUR_SOUS_STRUCTURES. Le partitionnement défini par
+ *        l'utilisateur n'est utilisé que si tous les noeuds ont une
+ *        sous-structure non nulle.
+ * \param p : la variable projet,
+ * \param noeud : noeud à modifier,
+ * \param sous_structure : la nouvelle sous-structure, 0 pour un
+ *                         partitionnement automatique.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - noeud == NULL.
+ */
+bool
+EF_noeuds_change_sous_structure (Projet   *p,
+                                 EF_Noeud *noeud,
+                                 uint16_t  sous_structure)
+{
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (noeud, "%p", noeud, false)
+  
+  noeud->sous_structure = sous_structure;
+  
+  BUG (EF_calculs_free (p), false)
+  
+  return true;
+}
+
+
 /**
  * \brief Change le noeud relatif d'un noeud.
  * \param p : la variable projet,
@@ -836,12 +871,13 @@ EF_noeuds_distance_x_y_z (EF_Noeud *n1,
 /**
  * \brief Fonction permettant de libérer un noeud contenu dans une liste.
  * \param noeud : le noeud à libérer,
- * \param p : la variable projet.
+ * \param p : la variable projet, utilisée uniquement par l'interface
+ *            graphique.
  * \return Rien.
  */
 void
 EF_noeuds_free_foreach (EF_Noeud *noeud,
-                        Projet   *p)
+                        Projet   *p __attribute__((__unused__)))
 {
   if (noeud == NULL)
   {
@@ -851,16 +887,6 @@ EF_noeuds_free_foreach (EF_Noeud *noeud,
   if (noeud->type == NOEUD_BARRE)
   {
     EF_Noeud_Barre *infos = (EF_Noeud_Barre *) noeud->data;
-    uint16_t        i;
-    
-    for (i = 0; i <= infos->barre->nds_inter.size (); i++)
-    {
-      if (infos->barre->info_EF[i].m_rig_loc != NULL)
-      {
-        cholmod_free_sparse (&infos->barre->info_EF[i].m_rig_loc,
-                             p->calculs.c);
-      }
-    }
     
     infos->barre->nds_inter.remove (noeud);
     
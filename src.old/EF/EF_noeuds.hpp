@@ -65,6 +65,10 @@ bool EF_noeuds_change_noeud_relatif   (Projet   *p,
                                        EF_Noeud *noeud,
                                        EF_Noeud *relatif)
                                        __attribute__((__warn_unused_result__));
+bool EF_noeuds_change_sous_structure  (Projet   *p,
+                                       EF_Noeud *noeud,
+                                       uint16_t  sous_structure)
+                                       __attribute__((__warn_unused_result__));
 
 double EF_points_distance             (EF_Point *p1,
                                        EF_Point *p2)
@@ -98,10 +98,7 @@ EF_resultat_noeud_reaction_appui (std::list <Action *> *liste,
     return true;
   }
   
-  i = std::distance (p->modele.noeuds.begin (),
-                     std::find (p->modele.noeuds.begin (), 
-                                p->modele.noeuds.end (),
-                                noeud));
+  i = noeud->indice;
   
   it = liste->begin ();
   action = *it;
@@ -231,10 +228,7 @@ EF_resultat_noeud_deplacement (std::list <Action *> *liste,
     return true;
   }
   
-  i = std::distance (p->modele.noeuds.begin (),
-                     std::find (p->modele.noeuds.begin (), 
-                                p->modele.noeuds.end (), 
-                                noeud));
+  i = noeud->indice;
   
   it = liste->begin ();
   action = *it;
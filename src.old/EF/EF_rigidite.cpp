@@ -19,9 +19,14 @@
 #include "config.h"
 
 #include <locale>
+#include <cmath>
+#include <string.h>
 
 #include "common_projet.hpp"
 #include "common_erreurs.hpp"
+#include "EF_verif.hpp"
+#include "EF_modes.hpp"
+#include "EF_sous_structures.hpp"
 #include "EF_rigidite.hpp"
 
 /**
@@ -38,15 +43,91 @@ EF_rigidite_init (Projet *p)
   BUGPARAM (p, "%p", p, false)
   
   p->calculs.m_part = NULL;
-  p->calculs.m_comp = NULL;
+  p->calculs.nb_reactions = 0;
+  p->calculs.reac_ligne = NULL;
+  p->calculs.reac_p = NULL;
+  p->calculs.reac_i = NULL;
+  p->calculs.reac_x = NULL;
+  p->calculs.solveur = EF_SOLVEUR_CHOLESKY;
+  p->calculs.ordonnancement = EF_ORDRE_DEFAUT;
+  p->calculs.factor = NULL;
+  p->calculs.updown_nb = 0;
+  p->calculs.updown_nb_max = 32;
+  p->calculs.updown_rang_max = 48;
+  p->calculs.updown_tolerance = 1.e-8;
   p->calculs.numeric = NULL;
+  p->calculs.precond = EF_PRECOND_BLOC_JACOBI;
+  p->calculs.gc_tolerance = 1.e-10;
+  p->calculs.gc_iter_max = 0;
+  p->calculs.precond_x = NULL;
+  p->calculs.precond_p = NULL;
+  p->calculs.precond_i = NULL;
+  p->calculs.precond_utilise = EF_PRECOND_BLOC_JACOBI;
+  p->calculs.nb_sous_structures = 0;
+  p->calculs.sous_structures = NULL;
+  p->calculs.mixte_x = NULL;
+  p->calculs.mixte_pos = NULL;
+  p->calculs.mixte_ligne = NULL;
+  p->calculs.mixte_perm = NULL;
+  p->calculs.mixte_tolerance = 1.e-10;
+  p->calculs.mixte_iter_max = 10;
+  p->calculs.second_ordre_k = NULL;
+  p->calculs.second_ordre_x0 = NULL;
+  p->calculs.second_ordre_factor = NULL;
+  p->calculs.second_ordre_tolerance = 1.e-6;
+  p->calculs.second_ordre_iter_max = 20;
   p->calculs.ap = NULL;
   p->calculs.ai = NULL;
   p->calculs.ax = NULL;
-  p->calculs.t_part = NULL;
-  p->calculs.t_comp = NULL;
+  p->calculs.nb_fils = 0;
+  p->calculs.nb_troncons = 0;
+  p->calculs.disp_part = NULL;
+  p->calculs.disp_reac = NULL;
+  p->calculs.condensation = false;
+  p->calculs.nb_ddl = 0;
+  p->calculs.disp_cond = NULL;
+  p->calculs.cond_pos = NULL;
+  p->calculs.cond_x = NULL;
   p->calculs.n_comp = NULL;
   p->calculs.n_part = NULL;
+  p->calculs.nb_noeuds = 0;
+  p->calculs.nb_bloc = 0;
+  p->calculs.for_bloc = NULL;
+  p->calculs.dep_bloc = NULL;
+  p->calculs.symbolique_cle = 0;
+  p->calculs.symbolique_chol = NULL;
+  p->calculs.symbolique_lu = NULL;
+  p->calculs.symbolique_prevision[0] = 0.;
+  p->calculs.symbolique_prevision[1] = 0.;
+  p->calculs.symbolique_prevision[2] = 0.;
+  p->calculs.rapport = NULL;
+  p->calculs.modes = NULL;
+  
+  return true;
+}
+
+
+/**
+ * \brief Libère les analyses symboliques conservées d'une analyse à l'autre.
+ *        Doit être appelée lors de la fermeture du projet ou lorsque la
+ *        topologie du modèle change.
+ * \param p : la variable projet.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL.
+ */
+bool
+EF_rigidite_free_symbolique (Projet *p)
+{
+  BUGPARAM (p, "%p", p, false)
+  
+  cholmod_free_factor (&p->calculs.symbolique_chol, p->calculs.c);
+  if (p->calculs.symbolique_lu != NULL)
+  {
+    umfpack_di_free_symbolic (&p->calculs.symbolique_lu);
+  }
+  p->calculs.symbolique_cle = 0;
   
   return true;
 }
@@ -63,6 +144,433 @@ EF_rigidite_init (Projet *p)
 bool
 EF_rigidite_free (Projet *p)
 {
+  uint32_t i;
+  
+  BUGPARAM (p, "%p", p, false)
+  
+  cholmod_free_sparse (&p->calculs.m_part, p->calculs.c);
+  delete [] p->calculs.reac_ligne;
+  delete [] p->calculs.reac_p;
+  delete [] p->calculs.reac_i;
+  delete [] p->calculs.reac_x;
+  p->calculs.reac_ligne = NULL;
+  p->calculs.reac_p = NULL;
+  p->calculs.reac_i = NULL;
+  p->calculs.reac_x = NULL;
+  p->calculs.nb_reactions = 0;
+  delete [] p->calculs.disp_part;
+  delete [] p->calculs.disp_reac;
+  p->calculs.disp_part = NULL;
+  p->calculs.disp_reac = NULL;
+  p->calculs.nb_troncons = 0;
+  delete [] p->calculs.disp_cond;
+  delete [] p->calculs.cond_pos;
+  delete [] p->calculs.cond_x;
+  p->calculs.disp_cond = NULL;
+  p->calculs.cond_pos = NULL;
+  p->calculs.cond_x = NULL;
+  p->calculs.nb_ddl = 0;
+  cholmod_free_factor (&p->calculs.factor, p->calculs.c);
+  p->calculs.updown_nb = 0;
+  if (p->calculs.numeric != NULL)
+  {
+    umfpack_di_free_numeric (&p->calculs.numeric);
+  }
+  delete [] p->calculs.ap;
+  delete [] p->calculs.ai;
+  delete [] p->calculs.ax;
+  p->calculs.ap = NULL;
+  p->calculs.ai = NULL;
+  p->calculs.ax = NULL;
+  delete [] p->calculs.precond_x;
+  delete [] p->calculs.precond_p;
+  delete [] p->calculs.precond_i;
+  p->calculs.precond_x = NULL;
+  p->calculs.precond_p = NULL;
+  p->calculs.precond_i = NULL;
+  EF_sous_structures_free (p);
+  delete [] p->calculs.mixte_x;
+  delete [] p->calculs.mixte_pos;
+  delete [] p->calculs.mixte_ligne;
+  delete [] p->calculs.mixte_perm;
+  p->calculs.mixte_x = NULL;
+  p->calculs.mixte_pos = NULL;
+  p->calculs.mixte_ligne = NULL;
+  p->calculs.mixte_perm = NULL;
+  cholmod_free_sparse (&p->calculs.second_ordre_k, p->calculs.c);
+  delete [] p->calculs.second_ordre_x0;
+  p->calculs.second_ordre_x0 = NULL;
+  cholmod_free_factor (&p->calculs.second_ordre_factor, p->calculs.c);
+  EF_verif_rapport_free (p->calculs.rapport);
+  p->calculs.rapport = NULL;
+  EF_modes_free (p);
+  
+  if (p->calculs.n_part != NULL)
+  {
+    for (i = 0; i < p->calculs.nb_noeuds; i++)
+    {
+      delete [] p->calculs.n_part[i];
+    }
+    delete [] p->calculs.n_part;
+    p->calculs.n_part = NULL;
+  }
+  if (p->calculs.n_comp != NULL)
+  {
+    for (i = 0; i < p->calculs.nb_noeuds; i++)
+    {
+      delete [] p->calculs.n_comp[i];
+    }
+    delete [] p->calculs.n_comp;
+    p->calculs.n_comp = NULL;
+  }
+  p->calculs.nb_noeuds = 0;
+  
+  delete [] p->calculs.for_bloc;
+  delete [] p->calculs.dep_bloc;
+  p->calculs.for_bloc = NULL;
+  p->calculs.dep_bloc = NULL;
+  p->calculs.nb_bloc = 0;
+  
+  return true;
+}
+
+
+/**
+ * \brief Renvoie la position d'un degré de liberté d'un tronçon d'une barre
+ *        condensée. Les noeuds de la barre sont numérotés de 0 (noeud_debut)
+ *        à nds_inter.size () + 1 (noeud_fin).
+ * \param nb_inter : le nombre de noeuds intermédiaires de la barre,
+ * \param noeud : le numéro du noeud dans la barre,
+ * \param ddl : le degré de liberté (0 à 5),
+ * \param interne : vaut true si le degré de liberté est condensé.
+ * \return La position parmi les 12 degrés de liberté des extrémités ou parmi
+ *         les 6 × nb_inter degrés de liberté internes.
+ */
+static uint32_t
+EF_rigidite_condense_position (uint32_t nb_inter,
+                               uint32_t noeud,
+                               uint8_t  ddl,
+                               bool    *interne)
+{
+  *interne = (noeud != 0) && (noeud != nb_inter + 1U);
+  if (!*interne)
+  {
+    return noeud == 0 ? ddl : 6U + ddl;
+  }
+  
+  return 6U * (noeud - 1U) + ddl;
+}
+
+
+/**
+ * \brief Résout sur place [L] · [L]^T · {x} = {b} avec [L] facteur de
+ *        Cholesky bande (demi-largeur de bande 11) stocké par
+ *        #EF_rigidite_condense.
+ * \param l : le facteur,
+ * \param m : la dimension,
+ * \param x : le second membre puis la solution.
+ * \return Rien.
+ */
+static void
+EF_rigidite_condense_resoud (const double *l,
+                             uint32_t      m,
+                             double       *x)
+{
+  uint32_t i, k;
+  
+  for (i = 0; i < m; i++)
+  {
+    for (k = i > 11 ? i - 11 : 0; k < i; k++)
+    {
+      x[i] -= l[k * 12 + i - k] * x[k];
+    }
+    x[i] /= l[i * 12];
+  }
+  for (i = m; i-- > 0; )
+  {
+    for (k = i + 1; (k < m) && (k <= i + 11); k++)
+    {
+      x[i] -= l[i * 12 + k - i] * x[k];
+    }
+    x[i] /= l[i * 12];
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Condense les degrés de liberté des noeuds intermédiaires d'une barre
+ *        et stocke dans p->calculs.cond_x le super-élément :
+ *        \end{verbatim}\begin{displaymath}
+ *        [K_c] = [K_{ee}] - [K_{ie}]^T \cdot [K_{ii}]^{-1} \cdot [K_{ie}]
+ *        \end{displaymath}\begin{verbatim}
+ *        ainsi que le facteur de Cholesky de [K_ii] et
+ *        [Y] = [K_ii]^-1 · [K_ie] nécessaires à la condensation des efforts
+ *        et à la restitution des déplacements. Les noeuds intermédiaires
+ *        n'étant reliés qu'à leurs voisins, [K_ii] est une matrice bande de
+ *        demi-largeur 11 et le coût est linéaire avec le nombre de tronçons.
+ *        Chaque barre n'écrit que dans sa propre zone de cond_x : plusieurs
+ *        barres peuvent être condensées simultanément.
+ * \param p : la variable projet,
+ * \param barre : la barre à condenser,
+ * \param k_glob : les matrices élémentaires des tronçons dans le repère
+ *                 global, calculées par #_1992_1_1_barres_rigidite_calcule.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - [K_ii] n'est pas définie positive (mécanisme interne à la barre).
+ */
+bool
+EF_rigidite_condense (Projet       *p,
+                      EF_Barre     *barre,
+                      const double *k_glob)
+{
+  uint32_t nb_inter = (uint32_t) barre->nds_inter.size ();
+  uint32_t m = 6U * nb_inter;
+  uint32_t t, i, j, k;
+  double  *k_c, *l, *y, *k_ie;
+  
+  k_c = &p->calculs.cond_x[p->calculs.cond_pos[barre->indice]];
+  l = &k_c[144];
+  y = &l[12 * m];
+  memset (k_c, 0, sizeof (double) * (144U + 24U * m));
+  
+  // Pour chaque tronçon t (noeuds t et t + 1 de la barre)
+  //   Répartition de chaque terme dans [K_ee], [K_ie] ou [K_ii].
+  // FinPour
+  for (t = 0; t <= nb_inter; t++)
+  {
+    for (j = 0; j < 12; j++)
+    {
+      bool     int_j;
+      uint32_t pos_j = EF_rigidite_condense_position (nb_inter,
+                                                      t + j / 6U,
+                                                      (uint8_t) (j % 6U),
+                                                      &int_j);
+      
+      for (i = 0; i < 12; i++)
+      {
+        bool     int_i;
+        uint32_t pos_i = EF_rigidite_condense_position (nb_inter,
+                                                        t + i / 6U,
+                                                        (uint8_t) (i % 6U),
+                                                        &int_i);
+        double   val = k_glob[t * 144U + j * 12U + i];
+        
+        if ((!int_i) && (!int_j))
+        {
+          k_c[pos_j * 12U + pos_i] += val;
+        }
+        else if ((int_i) && (!int_j))
+        {
+          y[pos_j * m + pos_i] += val;
+        }
+        else if ((int_i) && (int_j) && (pos_i >= pos_j))
+        {
+          l[pos_j * 12U + pos_i - pos_j] += val;
+        }
+      }
+    }
+  }
+  
+  // Factorisation de Cholesky bande de [K_ii].
+  for (j = 0; j < m; j++)
+  {
+    double diag = l[j * 12];
+    
+    for (k = j > 11 ? j - 11 : 0; k < j; k++)
+    {
+      diag -= l[k * 12 + j - k] * l[k * 12 + j - k];
+    }
+    INFO (diag > 0.,
+          false,
+          (gettext ("La barre %u ne peut pas être condensée : ses noeuds intermédiaires forment un mécanisme.\n"),
+                    barre->numero); )
+    l[j * 12] = sqrt (diag);
+    for (i = j + 1; (i < m) && (i <= j + 11); i++)
+    {
+      double val = l[j * 12 + i - j];
+      
+      for (k = i > 11 ? i - 11 : 0; k < j; k++)
+      {
+        val -= l[k * 12 + i - k] * l[k * 12 + j - k];
+      }
+      l[j * 12 + i - j] = val / l[j * 12];
+    }
+  }
+  
+  // [Y] = [K_ii]^-1 · [K_ie] puis [K_c] = [K_ee] - [K_ie]^T · [Y].
+  k_ie = new double [12 * m];
+  memcpy (k_ie, y, sizeof (double) * 12 * m);
+  for (j = 0; j < 12; j++)
+  {
+    EF_rigidite_condense_resoud (l, m, &y[j * m]);
+  }
+  for (j = 0; j < 12; j++)
+  {
+    for (i = 0; i < 12; i++)
+    {
+      for (k = 0; k < m; k++)
+      {
+        k_c[j * 12 + i] -= k_ie[i * m + k] * y[j * m + k];
+      }
+    }
+  }
+  delete [] k_ie;
+  
+  return true;
+}
+
+
+/**
+ * \brief Renvoie la position dans n_part des 6 × nds_inter.size () degrés de
+ *        liberté condensés d'une barre et des 12 degrés de liberté de ses
+ *        extrémités.
+ * \param p : la variable projet,
+ * \param barre : la barre condensée,
+ * \param ddl_int : les degrés de liberté internes,
+ * \param ddl_ext : les degrés de liberté des extrémités (UINT32_MAX si
+ *                  bloqué).
+ * \return Rien.
+ */
+static void
+EF_rigidite_condense_ddl (Projet   *p,
+                          EF_Barre *barre,
+                          uint32_t *ddl_int,
+                          uint32_t  ddl_ext[12])
+{
+  uint32_t i;
+  uint8_t  k;
+  
+  std::list <EF_Noeud *>::iterator it;
+  
+  for (k = 0; k < 6; k++)
+  {
+    ddl_ext[k] = p->calculs.n_part[barre->noeud_debut->indice][k];
+    ddl_ext[6 + k] = p->calculs.n_part[barre->noeud_fin->indice][k];
+  }
+  i = 0;
+  it = barre->nds_inter.begin ();
+  while (it != barre->nds_inter.end ())
+  {
+    for (k = 0; k < 6; k++)
+    {
+      ddl_int[i * 6 + k] = p->calculs.n_part[(*it)->indice][k];
+    }
+    
+    i++;
+    ++it;
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Condense les efforts appliqués aux noeuds intermédiaires d'une barre
+ *        sur ses extrémités : \end{verbatim}\begin{displaymath}
+ *        \{F_c\} = \{F_e\} - [Y]^T \cdot \{F_i\}\end{displaymath}
+ *        \begin{verbatim}
+ * \param p : la variable projet,
+ * \param barre : la barre condensée,
+ * \param f : les efforts de tous les degrés de liberté libres
+ *            (p->calculs.nb_ddl valeurs),
+ * \param f_c : les efforts du système condensé (p->calculs.m_part->nrow
+ *              valeurs).
+ * \return Rien.
+ */
+void
+EF_rigidite_condense_forces (Projet       *p,
+                             EF_Barre     *barre,
+                             const double *f,
+                             double       *f_c)
+{
+  uint32_t  m = 6U * (uint32_t) barre->nds_inter.size ();
+  uint32_t *ddl_int;
+  uint32_t  ddl_ext[12];
+  uint32_t  i;
+  uint8_t   e;
+  double   *y;
+  
+  y = &p->calculs.cond_x[p->calculs.cond_pos[barre->indice] + 144U + 12U * m];
+  ddl_int = new uint32_t [m];
+  EF_rigidite_condense_ddl (p, barre, ddl_int, ddl_ext);
+  for (e = 0; e < 12; e++)
+  {
+    if (ddl_ext[e] == UINT32_MAX)
+    {
+      continue;
+    }
+    for (i = 0; i < m; i++)
+    {
+      f_c[ddl_ext[e]] -= y[e * m + i] * f[ddl_int[i]];
+    }
+  }
+  delete [] ddl_int;
+  
+  return;
+}
+
+
+/**
+ * \brief Restitue les déplacements des noeuds intermédiaires d'une barre
+ *        condensée à partir des déplacements de ses extrémités :
+ *        \end{verbatim}\begin{displaymath}
+ *        \{D_i\} = [K_{ii}]^{-1} \cdot \{F_i\} - [Y] \cdot \{D_e\}
+ *        \end{displaymath}\begin{verbatim}
+ *        Seuls les déplacements internes de la barre sont écrits : plusieurs
+ *        barres peuvent être traitées simultanément.
+ * \param p : la variable projet,
+ * \param barre : la barre condensée,
+ * \param f : les efforts de tous les degrés de liberté libres
+ *            (p->calculs.nb_ddl valeurs),
+ * \param d : les déplacements de tous les degrés de liberté libres. Ceux des
+ *            extrémités doivent être connus.
+ * \return Rien.
+ */
+void
+EF_rigidite_condense_restitue (Projet       *p,
+                               EF_Barre     *barre,
+                               const double *f,
+                               double       *d)
+{
+  uint32_t  m = 6U * (uint32_t) barre->nds_inter.size ();
+  uint32_t *ddl_int;
+  uint32_t  ddl_ext[12];
+  uint32_t  i;
+  uint8_t   e;
+  double   *l, *y, *x;
+  
+  l = &p->calculs.cond_x[p->calculs.cond_pos[barre->indice] + 144U];
+  y = &l[12 * m];
+  ddl_int = new uint32_t [m];
+  x = new double [m];
+  EF_rigidite_condense_ddl (p, barre, ddl_int, ddl_ext);
+  for (i = 0; i < m; i++)
+  {
+    x[i] = f[ddl_int[i]];
+  }
+  EF_rigidite_condense_resoud (l, m, x);
+  for (e = 0; e < 12; e++)
+  {
+    if (ddl_ext[e] == UINT32_MAX)
+    {
+      continue;
+    }
+    for (i = 0; i < m; i++)
+    {
+      x[i] -= y[e * m + i] * d[ddl_ext[e]];
+    }
+  }
+  for (i = 0; i < m; i++)
+  {
+    d[ddl_int[i]] = x[i];
+  }
+  delete [] ddl_int;
+  delete [] x;
+  
+  return;
 }
 
 /* vim:set shiftwidth=2 softtabstop=2 expandtab: */
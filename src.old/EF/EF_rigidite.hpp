@@ -25,6 +25,21 @@
 
 bool EF_rigidite_init (Projet *p) __attribute__((__warn_unused_result__));
 bool EF_rigidite_free (Projet *p) __attribute__((__warn_unused_result__));
+bool EF_rigidite_free_symbolique (Projet *p)
+                                  __attribute__((__warn_unused_result__));
+
+bool EF_rigidite_condense          (Projet       *p,
+                                    EF_Barre     *barre,
+                                    const double *k_glob)
+                                  __attribute__((__warn_unused_result__));
+void EF_rigidite_condense_forces   (Projet       *p,
+                                    EF_Barre     *barre,
+                                    const double *f,
+                                    double       *f_c);
+void EF_rigidite_condense_restitue (Projet       *p,
+                                    EF_Barre     *barre,
+                                    const double *f,
+                                    double       *d);
 
 #endif
 
@@ -0,0 +1,951 @@
+/*
+ * 2lgc_code : calcul de résistance des matériaux selon les normes Eurocodes
+ * Copyright (C) 2011
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include <algorithm>
+#include <locale>
+#include <cmath>
+#include <string.h>
+#include <cstdint>
+
+#include "common_projet.hpp"
+#include "common_erreurs.hpp"
+#include "common_math.hpp"
+#include "EF_sous_structures.hpp"
+
+
+/**
+ * \brief Répartit les noeuds en sous-structures. Si tous les noeuds ont une
+ *        sous-structure définie par l'utilisateur (EF_Noeud::sous_structure
+ *        non nulle), elle est utilisée. Sinon, les noeuds sont parcourus en
+ *        largeur sur le graphe de la matrice de rigidité partielle depuis un
+ *        noeud pseudo-périphérique et la liste obtenue est découpée en
+ *        nb_parties tranches de même nombre de degrés de liberté : les
+ *        sous-structures sont alors des tranches (étages, travées) et
+ *        l'interface se limite aux noeuds situés à la limite de deux
+ *        tranches.
+ * \param p : la variable projet,
+ * \param nb_parties : le nombre de sous-structures souhaité,
+ * \param noeud_partie : la sous-structure de chaque noeud
+ *                       (p->calculs.nb_noeuds valeurs).
+ * \return Le nombre de sous-structures.
+ */
+static uint32_t
+EF_sous_structures_partitionne (Projet                 *p,
+                                uint32_t                nb_parties,
+                                std::vector <uint32_t> *noeud_partie)
+{
+  cholmod_sparse *m = p->calculs.m_part;
+  int            *ap = (int *) m->p; // NS
+  int            *ai = (int *) m->i; // NS
+  uint32_t        nb = p->calculs.nb_noeuds;
+  std::vector <uint32_t> noeud_ddl (m->nrow);
+  std::vector <uint32_t> nb_ddl (nb, 0);
+  std::vector <std::vector <uint32_t> > voisins (nb);
+  std::vector <uint32_t> ordre;
+  std::vector <bool> vu (nb, false);
+  uint32_t        i, j, s;
+  size_t          cumul;
+  uint8_t         k;
+  bool            utilisateur = true;
+  
+  std::list <EF_Noeud *>::iterator it;
+  
+  // Partitionnement défini par l'utilisateur.
+  it = p->modele.noeuds.begin ();
+  while ((utilisateur) && (it != p->modele.noeuds.end ()))
+  {
+    utilisateur = (*it)->sous_structure != 0;
+    
+    ++it;
+  }
+  if (utilisateur)
+  {
+    std::vector <uint16_t> valeurs;
+    
+    it = p->modele.noeuds.begin ();
+    while (it != p->modele.noeuds.end ())
+    {
+      valeurs.push_back ((*it)->sous_structure);
+      
+      ++it;
+    }
+    std::sort (valeurs.begin (), valeurs.end ());
+    valeurs.erase (std::unique (valeurs.begin (), valeurs.end ()),
+                   valeurs.end ());
+    it = p->modele.noeuds.begin ();
+    while (it != p->modele.noeuds.end ())
+    {
+      (*noeud_partie)[(*it)->indice] = (uint32_t) (
+        std::lower_bound (valeurs.begin (),
+                          valeurs.end (),
+                          (*it)->sous_structure) - valeurs.begin ());
+      
+      ++it;
+    }
+    
+    return (uint32_t) valeurs.size ();
+  }
+  
+  // Graphe des noeuds déduit de la structure de m_part.
+  for (i = 0; i < nb; i++)
+  {
+    for (k = 0; k < 6; k++)
+    {
+      if (p->calculs.n_part[i][k] < m->nrow)
+      {
+        noeud_ddl[p->calculs.n_part[i][k]] = i;
+        nb_ddl[i]++;
+      }
+    }
+    // Les noeuds sans degré de liberté libre n'interviennent pas.
+    vu[i] = nb_ddl[i] == 0;
+  }
+  for (j = 0; j < m->ncol; j++)
+  {
+    int q; // NS
+    
+    for (q = ap[j]; q < ap[j + 1]; q++)
+    {
+      if (noeud_ddl[(size_t) ai[q]] != noeud_ddl[j])
+      {
+        voisins[noeud_ddl[j]].push_back (noeud_ddl[(size_t) ai[q]]);
+      }
+    }
+  }
+  for (i = 0; i < nb; i++)
+  {
+    std::sort (voisins[i].begin (), voisins[i].end ());
+    voisins[i].erase (std::unique (voisins[i].begin (), voisins[i].end ()),
+                      voisins[i].end ());
+  }
+  
+  // Pour chaque composante connexe
+  //   Parcours en largeur depuis le noeud de plus faible degré puis, pour
+  //   obtenir un noeud pseudo-périphérique, depuis le dernier noeud atteint.
+  // FinPour
+  while (true)
+  {
+    uint32_t depart = UINT32_MAX;
+    uint8_t  passe;
+    size_t   debut = ordre.size ();
+    
+    for (i = 0; i < nb; i++)
+    {
+      if ((!vu[i]) &&
+          ((depart == UINT32_MAX) ||
+           (voisins[i].size () < voisins[depart].size ())))
+      {
+        depart = i;
+      }
+    }
+    if (depart == UINT32_MAX)
+    {
+      break;
+    }
+    
+    for (passe = 0; passe < 2; passe++)
+    {
+      size_t l;
+      
+      for (l = debut; l < ordre.size (); l++)
+      {
+        vu[ordre[l]] = false;
+      }
+      ordre.resize (debut);
+      ordre.push_back (depart);
+      vu[depart] = true;
+      for (l = debut; l < ordre.size (); l++)
+      {
+        std::vector <uint32_t>::iterator it2;
+        
+        for (it2 = voisins[ordre[l]].begin ();
+             it2 != voisins[ordre[l]].end ();
+             ++it2)
+        {
+          if (!vu[*it2])
+          {
+            vu[*it2] = true;
+            ordre.push_back (*it2);
+          }
+        }
+      }
+      depart = ordre.back ();
+    }
+  }
+  
+  // Découpage en tranches de même nombre de degrés de liberté.
+  nb_parties = std::max (1U, std::min (nb_parties, (uint32_t) ordre.size ()));
+  noeud_partie->assign (nb, 0);
+  cumul = 0;
+  for (i = 0; i < ordre.size (); i++)
+  {
+    s = (uint32_t) (cumul * nb_parties / m->nrow);
+    (*noeud_partie)[ordre[i]] = std::min (s, nb_parties - 1U);
+    cumul += nb_ddl[ordre[i]];
+  }
+  
+  return nb_parties;
+}
+
+
+/**
+ * \brief Factorise l'intérieur d'une sous-structure et calcule sa
+ *        contribution au complément de Schur de l'interface :
+ *        \end{verbatim}\begin{displaymath}
+ *        [K_{\Gamma I}] \cdot [K_{II}]^{-1} \cdot [K_{I \Gamma}]
+ *        \end{displaymath}\begin{verbatim}
+ *        Seules les données de la sous-structure sont modifiées et elle
+ *        dispose de ses propres paramètres cholmod.
+ * \param p : la variable projet,
+ * \param s : le numéro de la sous-structure.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - [K_II] n'est pas définie positive,
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+static bool
+EF_sous_structures_factorise_partie (Projet  *p,
+                                     uint32_t s)
+{
+  EF_Sous_Structures *ss = p->calculs.sous_structures;
+  EF_Sous_Structure  *partie = ss->parties[s];
+  cholmod_common     *c = &partie->Common;
+  cholmod_sparse     *m = p->calculs.m_part, *k_ii;
+  cholmod_dense       b, *y;
+  int                *ap = (int *) m->p; // NS
+  int                *ai = (int *) m->i; // NS
+  double             *ax = (double *) m->x;
+  int                *kp, *ki; // NS
+  double             *kx, *yx;
+  size_t              n_i = partie->interieur.size ();
+  size_t              n_g = partie->interface.size ();
+  size_t              nnz, col, g, r;
+  std::vector <uint32_t> local (ss->interface.size (), UINT32_MAX);
+  
+  for (g = 0; g < n_g; g++)
+  {
+    local[partie->interface[g]] = (uint32_t) g;
+  }
+  if (n_i == 0)
+  {
+    partie->schur = new double [n_g * n_g];
+    memset (partie->schur, 0, sizeof (double) * n_g * n_g);
+    return true;
+  }
+  
+  // [K_II] (triangle supérieur) et [K_IΓ] dense.
+  nnz = 0;
+  for (col = 0; col < n_i; col++)
+  {
+    uint32_t j = partie->interieur[col];
+    int      q; // NS
+    
+    for (q = ap[j]; q < ap[j + 1]; q++)
+    {
+      if ((ss->partie[(size_t) ai[q]] == s) &&
+          (ss->position[(size_t) ai[q]] <= col))
+      {
+        nnz++;
+      }
+    }
+  }
+  k_ii = cholmod_allocate_sparse (n_i, n_i, nnz, true, true, 1, CHOLMOD_REAL, c);
+  if (k_ii == NULL)
+  {
+    return false;
+  }
+  partie->k_ig = new double [n_i * n_g];
+  memset (partie->k_ig, 0, sizeof (double) * n_i * n_g);
+  kp = (int *) k_ii->p;
+  ki = (int *) k_ii->i;
+  kx = (double *) k_ii->x;
+  nnz = 0;
+  for (col = 0; col < n_i; col++)
+  {
+    uint32_t j = partie->interieur[col];
+    int      q; // NS
+    
+    kp[col] = (int) nnz;
+    for (q = ap[j]; q < ap[j + 1]; q++)
+    {
+      size_t i = (size_t) ai[q];
+      
+      if ((ss->partie[i] == s) && (ss->position[i] <= col))
+      {
+        ki[nnz] = (int) ss->position[i];
+        kx[nnz] = ax[q];
+        nnz++;
+      }
+      else if (ss->partie[i] == UINT32_MAX)
+      {
+        partie->k_ig[local[ss->position[i]] * n_i + col] = ax[q];
+      }
+    }
+  }
+  kp[n_i] = (int) nnz;
+  
+  partie->factor = cholmod_analyze (k_ii, c);
+  if (partie->factor == NULL)
+  {
+    cholmod_free_sparse (&k_ii, c);
+    return false;
+  }
+  cholmod_factorize (k_ii, partie->factor, c);
+  cholmod_free_sparse (&k_ii, c);
+  if ((c->status != CHOLMOD_OK) || (partie->factor->minor < n_i))
+  {
+    return false;
+  }
+  
+  partie->schur = new double [n_g * n_g];
+  memset (partie->schur, 0, sizeof (double) * n_g * n_g);
+  if (n_g == 0)
+  {
+    return true;
+  }
+  
+  // [Y] = [K_II]^-1 · [K_IΓ] puis [K_IΓ]^T · [Y].
+  memset (&b, 0, sizeof (b));
+  b.nrow = n_i;
+  b.ncol = n_g;
+  b.nzmax = n_i * n_g;
+  b.d = n_i;
+  b.x = partie->k_ig;
+  b.xtype = CHOLMOD_REAL;
+  b.dtype = CHOLMOD_DOUBLE;
+  y = cholmod_solve (CHOLMOD_A, partie->factor, &b, c);
+  if (y == NULL)
+  {
+    return false;
+  }
+  yx = (double *) y->x;
+  for (col = 0; col < n_g; col++)
+  {
+    for (g = 0; g <= col; g++)
+    {
+      double somme = 0.;
+      
+      for (r = 0; r < n_i; r++)
+      {
+        somme += partie->k_ig[g * n_i + r] * yx[col * n_i + r];
+      }
+      partie->schur[col * n_g + g] = somme;
+      partie->schur[g * n_g + col] = somme;
+    }
+  }
+  cholmod_free_dense (&y, c);
+  
+  return true;
+}
+
+
+/**
+ * \brief Tâche de #common_math_parallele factorisant une sous-structure.
+ * \param donnees : la variable projet,
+ * \param s : le numéro de la sous-structure.
+ * \return Le résultat de #EF_sous_structures_factorise_partie.
+ */
+static bool
+EF_sous_structures_factorise_tache (void  *donnees,
+                                    size_t s)
+{
+  return EF_sous_structures_factorise_partie ((Projet *) donnees,
+                                              (uint32_t) s);
+}
+
+
+/**
+ * \brief Décompose la matrice de rigidité partielle en sous-structures,
+ *        factorise l'intérieur de chacune d'elles en parallèle (au plus
+ *        p->calculs.nb_fils fils d'exécution, chacun traitant plusieurs
+ *        sous-structures) puis assemble et factorise le complément de Schur
+ *        de l'interface : \end{verbatim}
+ *        \begin{displaymath}
+ *        [S] = [K_{\Gamma \Gamma}] - \sum_s [K_{\Gamma I}^s] \cdot
+ *              [K_{II}^s]^{-1} \cdot [K_{I \Gamma}^s]\end{displaymath}
+ *        \begin{verbatim}
+ *        [S] est stocké sous forme dense : l'interface doit rester petite
+ *        devant la taille de la matrice.
+ * \param p : la variable projet,
+ * \param ok : vaut false si une matrice n'est pas définie positive. Dans ce
+ *             cas, p->calculs.sous_structures est libéré.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - p->calculs.m_part == NULL.
+ */
+bool
+EF_sous_structures_factorise (Projet *p,
+                              bool   *ok)
+{
+  EF_Sous_Structures *ss;
+  cholmod_sparse     *m;
+  int                *ap, *ai; // NS
+  double             *ax;
+  uint32_t            nb_parties, s, i;
+  size_t              n, n_g, j, g;
+  uint8_t             k;
+  std::vector <uint32_t> noeud_partie;
+  std::vector <bool> interface;
+  
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (p->calculs.m_part, "%p", p->calculs.m_part, false)
+  
+  *ok = false;
+  EF_sous_structures_free (p);
+  
+  m = p->calculs.m_part;
+  ap = (int *) m->p;
+  ai = (int *) m->i;
+  ax = (double *) m->x;
+  n = m->nrow;
+  
+  nb_parties = p->calculs.nb_sous_structures;
+  if (nb_parties == 0)
+  {
+    nb_parties = common_math_nb_fils (p->calculs.nb_fils, SIZE_MAX);
+  }
+  noeud_partie.assign (p->calculs.nb_noeuds, 0);
+  nb_parties = EF_sous_structures_partitionne (p, nb_parties, &noeud_partie);
+  
+  ss = new EF_Sous_Structures;
+  ss->schur = NULL;
+  ss->partie.assign (n, 0);
+  ss->position.assign (n, 0);
+  p->calculs.sous_structures = ss;
+  for (i = 0; i < p->calculs.nb_noeuds; i++)
+  {
+    for (k = 0; k < 6; k++)
+    {
+      if (p->calculs.n_part[i][k] < n)
+      {
+        ss->partie[p->calculs.n_part[i][k]] = noeud_partie[i];
+      }
+    }
+  }
+  
+  // Un degré de liberté appartient à l'interface s'il est couplé à une
+  // sous-structure de numéro supérieur : les intérieurs de deux
+  // sous-structures ne sont alors jamais couplés.
+  interface.assign (n, false);
+  for (j = 0; j < n; j++)
+  {
+    int q; // NS
+    
+    for (q = ap[j]; q < ap[j + 1]; q++)
+    {
+      if (ss->partie[(size_t) ai[q]] > ss->partie[j])
+      {
+        interface[j] = true;
+      }
+    }
+  }
+  for (s = 0; s < nb_parties; s++)
+  {
+    EF_Sous_Structure *partie = new EF_Sous_Structure;
+    
+    cholmod_start (&partie->Common);
+    partie->factor = NULL;
+    partie->k_ig = NULL;
+    partie->schur = NULL;
+    partie->travail = NULL;
+    ss->parties.push_back (partie);
+  }
+  for (j = 0; j < n; j++)
+  {
+    if (interface[j])
+    {
+      ss->partie[j] = UINT32_MAX;
+      ss->position[j] = (uint32_t) ss->interface.size ();
+      ss->interface.push_back ((uint32_t) j);
+    }
+    else
+    {
+      EF_Sous_Structure *partie = ss->parties[ss->partie[j]];
+      
+      ss->position[j] = (uint32_t) partie->interieur.size ();
+      partie->interieur.push_back ((uint32_t) j);
+    }
+  }
+  n_g = ss->interface.size ();
+  
+  // Interface couplée à l'intérieur de chaque sous-structure.
+  for (s = 0; s < nb_parties; s++)
+  {
+    EF_Sous_Structure *partie = ss->parties[s];
+    std::vector <uint32_t>::iterator it;
+    
+    for (it = partie->interieur.begin (); it != partie->interieur.end (); ++it)
+    {
+      int q; // NS
+      
+      for (q = ap[*it]; q < ap[*it + 1]; q++)
+      {
+        if (ss->partie[(size_t) ai[q]] == UINT32_MAX)
+        {
+          partie->interface.push_back (ss->position[(size_t) ai[q]]);
+        }
+      }
+    }
+    std::sort (partie->interface.begin (), partie->interface.end ());
+    partie->interface.erase (std::unique (partie->interface.begin (),
+                                          partie->interface.end ()),
+                             partie->interface.end ());
+  }
+  
+  // Factorisation des intérieurs, réparties sur au plus p->calculs.nb_fils
+  // fils d'exécution, le premier fil étant le fil courant.
+  if (!common_math_parallele (EF_sous_structures_factorise_tache,
+                              p,
+                              nb_parties,
+                              p->calculs.nb_fils))
+  {
+    EF_sous_structures_free (p);
+    
+    return true;
+  }
+  
+  // Assemblage du complément de Schur : [K_ΓΓ] puis retrait de la
+  // contribution de chaque sous-structure.
+  ss->schur = new double [n_g * n_g];
+  memset (ss->schur, 0, sizeof (double) * n_g * n_g);
+  for (g = 0; g < n_g; g++)
+  {
+    uint32_t jj = ss->interface[g];
+    int      q; // NS
+    
+    for (q = ap[jj]; q < ap[jj + 1]; q++)
+    {
+      if (ss->partie[(size_t) ai[q]] == UINT32_MAX)
+      {
+        ss->schur[g * n_g + ss->position[(size_t) ai[q]]] = ax[q];
+      }
+    }
+  }
+  for (s = 0; s < nb_parties; s++)
+  {
+    EF_Sous_Structure *partie = ss->parties[s];
+    size_t             n_gs = partie->interface.size ();
+    size_t             r;
+    
+    for (j = 0; j < n_gs; j++)
+    {
+      for (r = 0; r < n_gs; r++)
+      {
+        ss->schur[partie->interface[j] * n_g + partie->interface[r]] -=
+          partie->schur[j * n_gs + r];
+      }
+    }
+    delete [] partie->schur;
+    partie->schur = NULL;
+  }
+  
+  // Factorisation de Cholesky dense (triangle inférieur) de [S].
+  for (j = 0; j < n_g; j++)
+  {
+    double *col_j = &ss->schur[j * n_g];
+    size_t  r, kk;
+    
+    for (kk = 0; kk < j; kk++)
+    {
+      double *col_k = &ss->schur[kk * n_g];
+      double  l_jk = col_k[j];
+      
+      for (r = j; r < n_g; r++)
+      {
+        col_j[r] -= col_k[r] * l_jk;
+      }
+    }
+    if (col_j[j] <= 0.)
+    {
+      EF_sous_structures_free (p);
+      
+      return true;
+    }
+    col_j[j] = sqrt (col_j[j]);
+    for (r = j + 1; r < n_g; r++)
+    {
+      col_j[r] /= col_j[j];
+    }
+  }
+  
+  *ok = true;
+  
+  return true;
+}
+
+
+/**
+ * \brief Réalise l'une des deux étapes de résolution d'une sous-structure.
+ *        Étape 0 : \end{verbatim}\begin{displaymath}
+ *        \{r^s\} = [K_{\Gamma I}^s] \cdot [K_{II}^s]^{-1} \cdot \{F_I^s\}
+ *        \end{displaymath}\begin{verbatim}
+ *        stocké dans partie->travail. Étape 1, les déplacements de l'interface
+ *        étant connus : \end{verbatim}\begin{displaymath}
+ *        \{D_I^s\} = [K_{II}^s]^{-1} \cdot \left( \{F_I^s\} -
+ *                    [K_{I \Gamma}^s] \cdot \{D_\Gamma\} \right)
+ *        \end{displaymath}\begin{verbatim}
+ * \param p : la variable projet,
+ * \param s : le numéro de la sous-structure,
+ * \param etape : 0 ou 1,
+ * \param for_part : les seconds membres (nrow × nb),
+ * \param dep_part : les déplacements (nrow × nb),
+ * \param nb : le nombre de colonnes.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+static bool
+EF_sous_structures_resoud_partie (Projet  *p,
+                                  uint32_t s,
+                                  uint8_t  etape,
+                                  double  *for_part,
+                                  double  *dep_part,
+                                  uint32_t nb)
+{
+  EF_Sous_Structures *ss = p->calculs.sous_structures;
+  EF_Sous_Structure  *partie = ss->parties[s];
+  cholmod_common     *c = &partie->Common;
+  cholmod_dense      *b, *x;
+  double             *bx, *xx;
+  size_t              n = p->calculs.m_part->nrow;
+  size_t              n_i = partie->interieur.size ();
+  size_t              n_g = partie->interface.size ();
+  size_t              r, g;
+  uint32_t            k;
+  
+  if (n_i == 0)
+  {
+    if (etape == 0)
+    {
+      memset (partie->travail, 0, sizeof (double) * n_g * nb);
+    }
+    return true;
+  }
+  
+  b = cholmod_allocate_dense (n_i, nb, n_i, CHOLMOD_REAL, c);
+  if (b == NULL)
+  {
+    return false;
+  }
+  bx = (double *) b->x;
+  for (k = 0; k < nb; k++)
+  {
+    for (r = 0; r < n_i; r++)
+    {
+      bx[k * n_i + r] = for_part[k * n + partie->interieur[r]];
+    }
+    if (etape == 1)
+    {
+      for (g = 0; g < n_g; g++)
+      {
+        double d_g = dep_part[k * n + ss->interface[partie->interface[g]]];
+        
+        for (r = 0; r < n_i; r++)
+        {
+          bx[k * n_i + r] -= partie->k_ig[g * n_i + r] * d_g;
+        }
+      }
+    }
+  }
+  
+  x = cholmod_solve (CHOLMOD_A, partie->factor, b, c);
+  cholmod_free_dense (&b, c);
+  if (x == NULL)
+  {
+    return false;
+  }
+  xx = (double *) x->x;
+  
+  for (k = 0; k < nb; k++)
+  {
+    if (etape == 0)
+    {
+      for (g = 0; g < n_g; g++)
+      {
+        double somme = 0.;
+        
+        for (r = 0; r < n_i; r++)
+        {
+          somme += partie->k_ig[g * n_i + r] * xx[k * n_i + r];
+        }
+        partie->travail[k * n_g + g] = somme;
+      }
+    }
+    else
+    {
+      for (r = 0; r < n_i; r++)
+      {
+        dep_part[k * n + partie->interieur[r]] = xx[k * n_i + r];
+      }
+    }
+  }
+  cholmod_free_dense (&x, c);
+  
+  return true;
+}
+
+
+/**
+ * \struct EF_Sous_Structures_Etape
+ * \brief Données d'une étape de résolution transmises à
+ *        #EF_sous_structures_resoud_tache.
+ */
+typedef struct
+{
+  /// La variable projet.
+  Projet  *p;
+  /// L'étape (voir #EF_sous_structures_resoud_partie).
+  uint8_t  etape;
+  /// Les seconds membres.
+  double  *for_part;
+  /// Les déplacements.
+  double  *dep_part;
+  /// Le nombre de colonnes.
+  uint32_t nb;
+} EF_Sous_Structures_Etape;
+
+
+/**
+ * \brief Tâche de #common_math_parallele réalisant une étape de résolution
+ *        d'une sous-structure.
+ * \param donnees : l'étape (EF_Sous_Structures_Etape),
+ * \param s : le numéro de la sous-structure.
+ * \return Le résultat de #EF_sous_structures_resoud_partie.
+ */
+static bool
+EF_sous_structures_resoud_tache (void  *donnees,
+                                 size_t s)
+{
+  EF_Sous_Structures_Etape *e = (EF_Sous_Structures_Etape *) donnees;
+  
+  return EF_sous_structures_resoud_partie (e->p,
+                                           (uint32_t) s,
+                                           e->etape,
+                                           e->for_part,
+                                           e->dep_part,
+                                           e->nb);
+}
+
+
+/**
+ * \brief Lance l'étape de résolution des sous-structures, réparties sur au
+ *        plus p->calculs.nb_fils fils d'exécution (autant que de cœurs si
+ *        nul).
+ * \param p : la variable projet,
+ * \param etape : l'étape (voir #EF_sous_structures_resoud_partie),
+ * \param for_part : les seconds membres,
+ * \param dep_part : les déplacements,
+ * \param nb : le nombre de colonnes.
+ * \return true si toutes les sous-structures ont été résolues.
+ */
+static bool
+EF_sous_structures_resoud_etape (Projet  *p,
+                                 uint8_t  etape,
+                                 double  *for_part,
+                                 double  *dep_part,
+                                 uint32_t nb)
+{
+  EF_Sous_Structures_Etape e;
+  
+  e.p = p;
+  e.etape = etape;
+  e.for_part = for_part;
+  e.dep_part = dep_part;
+  e.nb = nb;
+  
+  return common_math_parallele (EF_sous_structures_resoud_tache,
+                                &e,
+                                p->calculs.sous_structures->parties.size (),
+                                p->calculs.nb_fils);
+}
+
+
+/**
+ * \brief Résout [K]{D} = {F} pour nb seconds membres à l'aide de la
+ *        sous-structuration calculée par #EF_sous_structures_factorise :
+ *        condensation des seconds membres sur l'interface (en parallèle),
+ *        résolution du complément de Schur puis restitution des déplacements
+ *        intérieurs (en parallèle). p->calculs.residu contient le résidu
+ *        maximal obtenu.
+ * \param p : la variable projet,
+ * \param for_part : les seconds membres (nrow valeurs par colonne),
+ * \param dep_part : les déplacements (nrow valeurs par colonne),
+ * \param nb : le nombre de colonnes.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - p == NULL,
+ *     - p->calculs.sous_structures == NULL,
+ *     - en cas d'erreur d'allocation mémoire.
+ */
+bool
+EF_sous_structures_resoud (Projet  *p,
+                           double  *for_part,
+                           double  *dep_part,
+                           uint32_t nb)
+{
+  EF_Sous_Structures *ss;
+  cholmod_dense       b, d, *r;
+  double              minusone[2] = {-1., 0.}, one[2] = {1., 0.};
+  double             *rx, *u;
+  size_t              n, n_g, i, j;
+  uint32_t            k;
+  
+  std::vector <EF_Sous_Structure *>::iterator it;
+  
+  BUGPARAM (p, "%p", p, false)
+  BUGPARAM (p->calculs.sous_structures,
+            "%p",
+            p->calculs.sous_structures,
+            false)
+  
+  ss = p->calculs.sous_structures;
+  n = p->calculs.m_part->nrow;
+  n_g = ss->interface.size ();
+  
+  for (it = ss->parties.begin (); it != ss->parties.end (); ++it)
+  {
+    (*it)->travail = new double [(*it)->interface.size () * nb];
+  }
+#define FREE_ALL \
+  for (it = ss->parties.begin (); it != ss->parties.end (); ++it) \
+  { \
+    delete [] (*it)->travail; \
+    (*it)->travail = NULL; \
+  }
+  BUGCRIT (EF_sous_structures_resoud_etape (p, 0, for_part, dep_part, nb),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n"));
+             FREE_ALL)
+  
+  // Second membre de l'interface puis résolution de [S]{D_Γ} = {F_Γ} - {r}.
+  u = new double [n_g];
+  for (k = 0; k < nb; k++)
+  {
+    for (i = 0; i < n_g; i++)
+    {
+      u[i] = for_part[k * n + ss->interface[i]];
+    }
+    for (it = ss->parties.begin (); it != ss->parties.end (); ++it)
+    {
+      for (i = 0; i < (*it)->interface.size (); i++)
+      {
+        u[(*it)->interface[i]] -= (*it)->travail[k * (*it)->interface.size ()
+                                                 + i];
+      }
+    }
+    for (j = 0; j < n_g; j++)
+    {
+      u[j] /= ss->schur[j * n_g + j];
+      for (i = j + 1; i < n_g; i++)
+      {
+        u[i] -= ss->schur[j * n_g + i] * u[j];
+      }
+    }
+    for (j = n_g; j-- > 0; )
+    {
+      for (i = j + 1; i < n_g; i++)
+      {
+        u[j] -= ss->schur[j * n_g + i] * u[i];
+      }
+      u[j] /= ss->schur[j * n_g + j];
+    }
+    for (i = 0; i < n_g; i++)
+    {
+      dep_part[k * n + ss->interface[i]] = u[i];
+    }
+  }
+  delete [] u;
+  
+  BUGCRIT (EF_sous_structures_resoud_etape (p, 1, for_part, dep_part, nb),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n"));
+             FREE_ALL)
+  FREE_ALL
+#undef FREE_ALL
+
+  // Résidu : {r} = [K]{D} - {F}
+  memset (&b, 0, sizeof (b));
+  b.nrow = n;
+  b.ncol = nb;
+  b.nzmax = n * nb;
+  b.d = n;
+  b.x = for_part;
+  b.xtype = CHOLMOD_REAL;
+  b.dtype = CHOLMOD_DOUBLE;
+  d = b;
+  d.x = dep_part;
+  BUGCRIT (r = cholmod_copy_dense (&b, p->calculs.c),
+           false,
+           (gettext ("Erreur d'allocation mémoire.\n")); )
+  cholmod_sdmult (p->calculs.m_part, 0, one, minusone, &d, r, p->calculs.c);
+  rx = (double *) r->x;
+  p->calculs.residu = 0.;
+  for (i = 0; i < n * nb; i++)
+  {
+    p->calculs.residu = std::max (fabs (rx[i]), p->calculs.residu);
+  }
+  cholmod_free_dense (&r, p->calculs.c);
+  
+  return true;
+}
+
+
+/**
+ * \brief Libère la sous-structuration de la matrice de rigidité partielle.
+ * \param p : la variable projet.
+ * \return Rien.
+ */
+void
+EF_sous_structures_free (Projet *p)
+{
+  std::vector <EF_Sous_Structure *>::iterator it;
+  
+  if (p->calculs.sous_structures == NULL)
+  {
+    return;
+  }
+  
+  it = p->calculs.sous_structures->parties.begin ();
+  while (it != p->calculs.sous_structures->parties.end ())
+  {
+    EF_Sous_Structure *partie = *it;
+    
+    cholmod_free_factor (&partie->factor, &partie->Common);
+    cholmod_finish (&partie->Common);
+    delete [] partie->k_ig;
+    delete [] partie->schur;
+    delete [] partie->travail;
+    delete partie;
+    
+    ++it;
+  }
+  delete [] p->calculs.sous_structures->schur;
+  delete p->calculs.sous_structures;
+  p->calculs.sous_structures = NULL;
+  
+  return;
+}
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
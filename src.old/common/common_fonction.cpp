@@ -29,8 +29,48 @@
 #include "common_erreurs.hpp"
 #include "common_math.hpp"
 #include "common_fonction.hpp"
+#include "common_polynome.hpp"
 #include "common_text.hpp"
 
+/// Nombre minimal de fusions confiées à chaque fil d'exécution lors d'un
+/// niveau de la réduction en arbre. En deçà, le niveau est traité par le
+/// fil courant.
+#define FUSIONS_PAR_FIL 16U
+
+/**
+ * \brief Renvoie le nombre de tronçons de la fonction.
+ * \param fonction : la fonction.
+ * \return Le nombre de tronçons.
+ */
+static size_t
+common_fonction_nb_troncons (const Fonction *fonction)
+{
+  return fonction->coef.size () / 7U;
+}
+
+
+/**
+ * \brief Renvoie le premier tronçon dont la fin est supérieure ou égale à x
+ *        par une recherche dichotomique dans les bornes.
+ * \param fonction : une fonction non vide,
+ * \param x : l'abscisse.
+ * \return L'indice du tronçon, le nombre de tronçons si x est au-delà de la
+ *         fin de la fonction.
+ */
+static size_t
+common_fonction_troncon (const Fonction *fonction,
+                         long double     x)
+{
+  std::vector <double>::const_iterator it;
+  
+  it = std::lower_bound (fonction->bornes.begin () + 1,
+                         fonction->bornes.end (),
+                         x);
+  
+  return (size_t) (it - fonction->bornes.begin ()) - 1U;
+}
+
+
 /**
  * \brief Divise un tronçon en deux à la position coupure. Si la coupure est
  *        en dehors de la borne de validité actuelle de la fonction, les bornes
@@ -51,105 +91,72 @@ bool
 common_fonction_scinde_troncon (Fonction *fonction,
                                 double    coupure)
 {
+  size_t i;
+  double bloc[7];
+  
   BUGPARAM (fonction, "%p", fonction, false)
-  INFO (fonction->t.size () != 0,
+  INFO (common_fonction_nb_troncons (fonction) != 0,
         false,
         (gettext ("Impossible de scinder une fonction vide\n")); )
   
   // Si la coupure est égale au début du premier tronçon Alors
   //   Fin.
-  if (errrel ((*fonction->t.begin ())->debut_troncon, coupure))
+  if (errrel (fonction->bornes[0], coupure))
   {
     return true;
   }
   // Sinon Si la coupure est inférieure au début du premier troncon Alors
   //   Insertion d'un tronçon en première position.
   //   Initialisation de tous les coefficients à 0.
-  else if (coupure < (*fonction->t.begin ())->debut_troncon)
+  else if (coupure < fonction->bornes[0])
   {
-    Troncon *t_new = new Troncon;
-    
-    t_new->debut_troncon = coupure;
-    t_new->fin_troncon = (*fonction->t.begin ())->debut_troncon;
-    t_new->x0 = 0.;
-    t_new->x1 = 0.;
-    t_new->x2 = 0.;
-    t_new->x3 = 0.;
-    t_new->x4 = 0.;
-    t_new->x5 = 0.;
-    t_new->x6 = 0.;
-    
-    fonction->t.push_front (t_new);
+    fonction->bornes.insert (fonction->bornes.begin (), coupure);
+    fonction->coef.insert (fonction->coef.begin (), 7U, 0.);
     
     return true;
   }
-  else
-  {
+  
   // Sinon
-  //   Pour chaque tronçon
-  //     Si la coupure correspond exactement à la borne supérieure
-  //       Fin.
-  //     Sinon si la coupure est à l'intérieur du tronçon étudié
-  //       Scindage du tronçon en deux.
-  //       Attribution des mêmes coefficients pour les deux tronçons.
-  //       Fin.
-  //     FinSi
-  //   FinPour
+  //   Recherche du tronçon contenant la coupure.
+  //   Si la coupure correspond exactement à sa borne supérieure
+  //     Fin.
+  //   Sinon si la coupure est à l'intérieur du tronçon
+  //     Scindage du tronçon en deux.
+  //     Attribution des mêmes coefficients pour les deux tronçons.
+  //     Fin.
+  //   FinSi
   // FinSi
-    std::list <Troncon *>::iterator it = fonction->t.begin ();
-    Troncon *t_new;
-    
-    while (it != fonction->t.end ())
+  i = common_fonction_troncon (fonction, coupure);
+  if ((i > 0) && (errrel (fonction->bornes[i], coupure)))
+  {
+    return true;
+  }
+  if (i < common_fonction_nb_troncons (fonction))
+  {
+    if (errrel (fonction->bornes[i + 1], coupure))
     {
-      if (errrel ((*it)->fin_troncon, coupure))
-      {
-        return true;
-      }
-      else if ((*it)->fin_troncon > coupure)
-      {
-        t_new = new Troncon;
-        
-        t_new->debut_troncon = (*it)->debut_troncon;
-        t_new->fin_troncon = coupure;
-        t_new->x0 = (*it)->x0;
-        t_new->x1 = (*it)->x1;
-        t_new->x2 = (*it)->x2;
-        t_new->x3 = (*it)->x3;
-        t_new->x4 = (*it)->x4;
-        t_new->x5 = (*it)->x5;
-        t_new->x6 = (*it)->x6;
-        
-        fonction->t.insert (it, t_new);
-        
-        return true;
-      }
-      
-      ++it;
+      return true;
     }
+    std::copy (&fonction->coef[i * 7U], &fonction->coef[i * 7U] + 7, bloc);
+    fonction->bornes.insert (fonction->bornes.begin () + (long) i + 1,
+                             coupure);
+    fonction->coef.insert (fonction->coef.begin () + (long) (i + 1U) * 7,
+                           bloc,
+                           bloc + 7);
+    
+    return true;
+  }
+  
   // Si la position de la coupure est au-delà à la borne supérieure du dernier
   // tronçon
   //   Ajout d'un nouveau tronçon en dernière position.
   //   Initialisation de tous les coefficients à 0.
   //   Fin.
   // FinSi
-    
-    t_new = new Troncon;
-    
-    --it;
-    
-    t_new->debut_troncon = (*it)->fin_troncon;
-    t_new->fin_troncon = coupure;
-    t_new->x0 = 0.;
-    t_new->x1 = 0.;
-    t_new->x2 = 0.;
-    t_new->x3 = 0.;
-    t_new->x4 = 0.;
-    t_new->x5 = 0.;
-    
-    fonction->t.push_back (t_new);
-    
-    return true;
-  }
+  fonction->bornes.push_back (coupure);
+  fonction->coef.insert (fonction->coef.end (), 7U, 0.);
+  
+  return true;
 }
 
 
@@ -248,23 +255,17 @@ common_fonction_ajout_poly (Fonction *fonction,
   // Si aucun troncon n'est présent (fonction vide) Alors
   //   Création d'un tronçon avec pour borne debut_troncon .. fin_troncon.
   //   Attribution des coefficients de la fonction.
-  if (fonction->t.size () == 0)
+  if (common_fonction_nb_troncons (fonction) == 0)
   {
-    Troncon *t_new;
-    
-    t_new = new Troncon;
-    
-    t_new->debut_troncon = debut_troncon;
-    t_new->fin_troncon = fin_troncon;
-    t_new->x0 = x0_t;
-    t_new->x1 = x1_t;
-    t_new->x2 = x2_t;
-    t_new->x3 = x3_t;
-    t_new->x4 = x4_t;
-    t_new->x5 = x5_t;
-    t_new->x6 = x6_t;
-    
-    fonction->t.push_back (t_new);
+    fonction->bornes.push_back (debut_troncon);
+    fonction->bornes.push_back (fin_troncon);
+    fonction->coef.push_back (x0_t);
+    fonction->coef.push_back (x1_t);
+    fonction->coef.push_back (x2_t);
+    fonction->coef.push_back (x3_t);
+    fonction->coef.push_back (x4_t);
+    fonction->coef.push_back (x5_t);
+    fonction->coef.push_back (x6_t);
 
     return true;
   }
@@ -278,29 +279,29 @@ common_fonction_ajout_poly (Fonction *fonction,
   // FinSi
   else
   {
-    std::list <Troncon *>::iterator it = fonction->t.begin ();
+    size_t i;
     
     BUG (common_fonction_scinde_troncon (fonction, debut_troncon), false)
     BUG (common_fonction_scinde_troncon (fonction, fin_troncon), false)
-    while (it != fonction->t.end ())
+    for (i = 0; i < common_fonction_nb_troncons (fonction); i++)
     {
-      if (errrel ((*it)->debut_troncon, fin_troncon))
+      double *c = &fonction->coef[i * 7U];
+      
+      if (errrel (fonction->bornes[i], fin_troncon))
       {
         return true;
       }
-      else if ((errrel ((*it)->debut_troncon, debut_troncon)) ||
-               ((*it)->debut_troncon > debut_troncon))
+      else if ((errrel (fonction->bornes[i], debut_troncon)) ||
+               (fonction->bornes[i] > debut_troncon))
       {
-        (*it)->x0 += x0_t;
-        (*it)->x1 += x1_t;
-        (*it)->x2 += x2_t;
-        (*it)->x3 += x3_t;
-        (*it)->x4 += x4_t;
-        (*it)->x5 += x5_t;
-        (*it)->x6 += x6_t;
+        c[0] += x0_t;
+        c[1] += x1_t;
+        c[2] += x2_t;
+        c[3] += x3_t;
+        c[4] += x4_t;
+        c[5] += x5_t;
+        c[6] += x6_t;
       }
-      
-      ++it;
     }
     return true;
   }
@@ -308,43 +309,53 @@ common_fonction_ajout_poly (Fonction *fonction,
 
 
 /**
- * \brief Additionne une fonction à une fonction existante.
- * \param fonction : fonction à modifier,
- * \param fonction_a_ajouter : fonction à ajouter,
- * \param multi : coefficient multiplicateur de la fonction à ajouter.
+ * \brief Fusionne les tronçons voisins ayant une fonction identique.
+ * \param fonction : fonction à afficher,
+ * \param index : index de la fonction fonction. Peut être NULL.
  * \return
  *   Succès : true.\n
  *   Échec : false :
  *     - fonction == NULL,
- *     - fonction_a_ajouter == NULL,
  *     - en cas d'erreur d'allocation mémoire.
  */
 bool
-common_fonction_ajout_fonction (Fonction *fonction,
-                                Fonction *fonction_a_ajouter,
-                                double    multi)
+common_fonction_compacte (Fonction *fonction,
+                          Fonction *index)
 {
-  std::list <Troncon *>::iterator it;
+  size_t i;
   
   BUGPARAM (fonction, "%p", fonction, false)
-  BUGPARAM (fonction_a_ajouter, "%p", fonction_a_ajouter, false)
   
-  it = fonction_a_ajouter->t.begin ();
-  while (it != fonction_a_ajouter->t.end ())
+  i = 1;
+  while (i < common_fonction_nb_troncons (fonction))
   {
-    BUG (common_fonction_ajout_poly (fonction,
-                                     (*it)->debut_troncon,
-                                     (*it)->fin_troncon,
-                                     multi*(*it)->x0,
-                                     multi*(*it)->x1,
-                                     multi*(*it)->x2,
-                                     multi*(*it)->x3,
-                                     multi*(*it)->x4,
-                                     multi*(*it)->x5,
-                                     multi*(*it)->x6,
-                                     0.),
-         false)
-    ++it;
+    double *c_1 = &fonction->coef[(i - 1U) * 7U];
+    double *c = &fonction->coef[i * 7U];
+    
+    if ((errrel (c[0], c_1[0])) &&
+        (errrel (c[1], c_1[1])) &&
+        (errrel (c[2], c_1[2])) &&
+        (errrel (c[3], c_1[3])) &&
+        (errrel (c[4], c_1[4])) &&
+        (errrel (c[5], c_1[5])) &&
+        (errrel (c[6], c_1[6])) &&
+        ((index == NULL) ||
+         (errrel (index->coef[i * 7U], index->coef[(i - 1U) * 7U]))))
+    {
+      fonction->bornes.erase (fonction->bornes.begin () + (long) i);
+      fonction->coef.erase (fonction->coef.begin () + (long) i * 7,
+                            fonction->coef.begin () + (long) (i + 1U) * 7);
+      if (index != NULL)
+      {
+        index->bornes.erase (index->bornes.begin () + (long) i);
+        index->coef.erase (index->coef.begin () + (long) i * 7,
+                           index->coef.begin () + (long) (i + 1U) * 7);
+      }
+    }
+    else
+    {
+      i++;
+    }
   }
   
   return true;
@@ -352,115 +363,175 @@ common_fonction_ajout_fonction (Fonction *fonction,
 
 
 /**
- * \brief Fusionne les tronçons voisins ayant une fonction identique.
- * \param fonction : fonction à afficher,
- * \param index : index de la fonction fonction. Peut être NULL.
+ * \brief Calcule la somme pondérée de plusieurs fonctions. Les bornes des
+ *        fonctions, déjà triées, sont fusionnées deux à deux en log2(nb)
+ *        passes, puis les bornes confondues (au sens de #errrel) sont
+ *        éliminées. Les coefficients de chaque tronçon du résultat sont
+ *        ensuite cumulés en un seul parcours par fonction. Le domaine du
+ *        résultat est l'union des domaines, une fonction étant nulle en
+ *        dehors du sien.
+ * \param fonction : le résultat, dont le contenu est remplacé. Elle peut
+ *                   faire partie des fonctions à additionner,
+ * \param fonctions : les fonctions à additionner,
+ * \param multi : le coefficient multiplicateur de chaque fonction,
+ * \param nb : le nombre de fonctions,
+ * \param compacte : fusionne les tronçons voisins identiques du résultat
+ *                   (#common_fonction_compacte).
  * \return
  *   Succès : true.\n
  *   Échec : false :
  *     - fonction == NULL,
+ *     - fonctions == NULL,
+ *     - multi == NULL,
+ *     - une des fonctions vaut NULL,
  *     - en cas d'erreur d'allocation mémoire.
  */
 bool
-common_fonction_compacte (Fonction *fonction,
-                          Fonction *index)
+common_fonction_somme (Fonction      *fonction,
+                       Fonction     **fonctions,
+                       const double  *multi,
+                       uint32_t       nb,
+                       bool           compacte)
 {
-  std::list <Troncon *>::iterator it_f_1;
-  std::list <Troncon *>::iterator it_f;
-  std::list <Troncon *>::iterator it_i;
+  Fonction resultat;
+  uint32_t j;
+  size_t   i, nb_t, taille;
+  
+  std::vector <double> bornes;
+  std::vector <size_t> series;
   
   BUGPARAM (fonction, "%p", fonction, false)
+  BUGPARAM (fonctions, "%p", fonctions, false)
+  BUGPARAM (multi, "%p", multi, false)
   
-  if (fonction->t.size () <= 1)
+  // Concaténation des bornes. Chaque fonction forme une série triée.
+  series.push_back (0);
+  for (j = 0; j < nb; j++)
   {
-    return true;
+    BUGPARAM (fonctions[j], "%p", fonctions[j], false)
+    if (common_fonction_nb_troncons (fonctions[j]) != 0)
+    {
+      bornes.insert (bornes.end (),
+                     fonctions[j]->bornes.begin (),
+                     fonctions[j]->bornes.end ());
+      series.push_back (bornes.size ());
+    }
   }
   
-  it_f_1 = fonction->t.begin ();
-  it_f = std::next (it_f_1);
-  if (index != NULL)
+  // Fusion des séries deux à deux jusqu'à n'en avoir plus qu'une.
+  for (taille = 1; taille < series.size () - 1; taille *= 2)
   {
-    it_i = std::next (index->t.begin ());
+    for (i = 0; i + taille < series.size () - 1; i += 2 * taille)
+    {
+      std::inplace_merge (
+        bornes.begin () + (long) series[i],
+        bornes.begin () + (long) series[i + taille],
+        bornes.begin () + (long) series[std::min (i + 2 * taille,
+                                                  series.size () - 1)]);
+    }
   }
   
-  while (it_f != fonction->t.end ())
+  // Suppression des bornes confondues.
+  for (i = 0; i < bornes.size (); i++)
   {
-    if ((errrel ((*it_f)->x0, (*it_f_1)->x0)) &&
-        (errrel ((*it_f)->x1, (*it_f_1)->x1)) &&
-        (errrel ((*it_f)->x2, (*it_f_1)->x2)) &&
-        (errrel ((*it_f)->x3, (*it_f_1)->x3)) &&
-        (errrel ((*it_f)->x4, (*it_f_1)->x4)) &&
-        (errrel ((*it_f)->x5, (*it_f_1)->x5)) &&
-        (errrel ((*it_f)->x6, (*it_f_1)->x6)) &&
-        ((index == NULL) ||
-         (errrel ((*it_i)->x0, (*std::prev (it_i))->x0))))
+    if ((resultat.bornes.empty ()) ||
+        (!errrel (resultat.bornes.back (), bornes[i])))
     {
-      (*it_f_1)->fin_troncon = (*it_f)->fin_troncon;
-      if (index != NULL)
-      {
-        (*std::prev (it_i))->fin_troncon = (*it_i)->fin_troncon;
-      }
-      it_f = fonction->t.erase (it_f);
-      it_i = fonction->t.erase (it_i);
+      resultat.bornes.push_back (bornes[i]);
     }
-    else
+  }
+  if (resultat.bornes.size () < 2)
+  {
+    fonction->bornes.clear ();
+    fonction->coef.clear ();
+    
+    return true;
+  }
+  nb_t = resultat.bornes.size () - 1;
+  resultat.coef.assign (nb_t * 7U, 0.);
+  
+  // Pour chaque fonction
+  //   Pour chaque tronçon du résultat dans le domaine de la fonction
+  //     Ajout des coefficients du tronçon de la fonction contenant son milieu.
+  //   FinPour
+  // FinPour
+  for (j = 0; j < nb; j++)
+  {
+    Fonction *f = fonctions[j];
+    size_t    k = 0;
+    size_t    nb_f = common_fonction_nb_troncons (f);
+    
+    if ((nb_f == 0) || (multi[j] == 0.))
     {
-      ++it_f_1;
-      ++it_f;
-      if (index != NULL)
+      continue;
+    }
+    
+    i = common_fonction_troncon (&resultat, f->bornes[0]);
+    for (; i < nb_t; i++)
+    {
+      double  milieu = (resultat.bornes[i] + resultat.bornes[i + 1]) / 2.;
+      double *c = &resultat.coef[i * 7U];
+      double *c_f;
+      uint8_t l;
+      
+      while ((k < nb_f) && (f->bornes[k + 1] <= milieu))
+      {
+        k++;
+      }
+      if (k == nb_f)
+      {
+        break;
+      }
+      if (f->bornes[k] > milieu)
+      {
+        continue;
+      }
+      
+      c_f = &f->coef[k * 7U];
+      for (l = 0; l < 7; l++)
       {
-        ++it_i;
+        c[l] += multi[j] * c_f[l];
       }
     }
   }
   
+  std::swap (*fonction, resultat);
+  
+  if (compacte)
+  {
+    BUG (common_fonction_compacte (fonction, NULL), false)
+  }
+  
   return true;
 }
 
 
 /**
- * \brief Renvoie a, b, et c en fonction de f(x1)=y1, ....
- * \param x1 : abscisse du permier point,
- * \param y1 : ordonnée du permier point,
- * \param x2 : abscisse du deuxième point,
- * \param y2 : ordonnée du deuxième point,
- * \param x3 : abscisse du troisième point,
- * \param y3 : ordonnée du troisième point,
- * \param a : valeur de a de la fonction a*x²+b*x+c,
- * \param b : valeur de b de la fonction a*x²+b*x+c,
- * \param c : valeur de c de la fonction a*x²+b*x+c.
- * \return Rien.
+ * \brief Additionne une fonction à une fonction existante.
+ * \param fonction : fonction à modifier,
+ * \param fonction_a_ajouter : fonction à ajouter,
+ * \param multi : coefficient multiplicateur de la fonction à ajouter.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - fonction == NULL,
+ *     - fonction_a_ajouter == NULL,
+ *     - en cas d'erreur d'allocation mémoire.
  */
-void
-common_fonction_ax2_bx_c (double      x1,
-                          long double y1,
-                          double      x2,
-                          long double y2,
-                          double      x3,
-                          long double y3,
-                          double     *a,
-                          double     *b,
-                          double     *c)
+bool
+common_fonction_ajout_fonction (Fonction *fonction,
+                                Fonction *fonction_a_ajouter,
+                                double    multi)
 {
-  // maxima : solve([a*x1^2 + b*x1 + c = y1,
-  //                 a*x2^2 + b*x2 + c = y2,
-  //                 a*x3^2 + b*x3 + c = y3],
-  //                [a,b,c]
-  //               );
-  *a = (double) ((x1 * (y3 - y2) - x2 * y3 + x3 * y2 + (x2 - x3) * y1) /
-                 (x1 * (x3 * x3 - x2 * x2) - x2 * x3 * x3 + x2 * x2 * x3 +
-                  x1 * x1 * (x2 - x3)));
-  *b = (double) (- (x1 * x1 * (y3 - y2) - x2 * x2 * y3 + x3 * x3 * y2 +
-                    (x2 * x2 - x3 * x3) * y1) /
-                   (x1 * (x3 * x3 - x2 * x2) - x2 * x3 * x3 + x2 * x2 * x3 +
-                    x1 * x1 * (x2 - x3)));
-  *c = (double) ((x1 * (x3 * x3 * y2 - x2 * x2 * y3) +
-                  x1 * x1 * (x2 * y3 - x3 * y2) +
-                  (x2 * x2 * x3 - x2 * x3 * x3) * y1) /
-                 (x1 * (x3 * x3 - x2 * x2) - x2 * x3 * x3 + x2 * x2 * x3 +
-                  x1 * x1 * (x2 - x3)));
+  Fonction *fonctions[2] = {fonction, fonction_a_ajouter};
+  double    multis[2] = {1., multi};
   
-  return;
+  BUGPARAM (fonction, "%p", fonction, false)
+  BUGPARAM (fonction_a_ajouter, "%p", fonction_a_ajouter, false)
+  
+  BUG (common_fonction_somme (fonction, fonctions, multis, 2, false), false)
+  
+  return true;
 }
 
 
@@ -494,354 +565,258 @@ common_fonction_y (Fonction *fonction,
                    int8_t    position)
 {
   long double x = x_; // NS (nsiqcppstyle)
-  long double y; // NS (nsiqcppstyle)
-  
-  std::list <Troncon *>::iterator it;
+  size_t      i;
   
   BUGPARAM (fonction, "%p", fonction, NAN)
   BUGPARAM (position, "%d", ((-1 <= position) && (position <= 1)), NAN)
   
-  if (fonction->t.size () == 0)
+  if (common_fonction_nb_troncons (fonction) == 0)
   {
     return NAN;
   }
   
-  if ((errrel ((*fonction->t.begin ())->debut_troncon, x_)) &&
+  if ((errrel (fonction->bornes[0], x_)) &&
       (position == -1))
   {
     return NAN;
   }
   
-  it = fonction->t.begin ();
-  while (it != fonction->t.end ())
+  i = common_fonction_troncon (fonction, x);
+  if ((i == common_fonction_nb_troncons (fonction)) ||
+      (x < fonction->bornes[i]))
   {
-    if (x <= (*it)->fin_troncon)
+    return NAN;
+  }
+  if ((errrel (fonction->bornes[i + 1], x_)) &&
+      (position == 1))
+  {
+    if (i + 1 == common_fonction_nb_troncons (fonction))
     {
-      if (x < (*it)->debut_troncon)
-      {
-        return NAN;
-      }
-      else
-      {
-        if ((errrel ((*it)->fin_troncon, x_)) &&
-            (position == 1))
-        {
-          if (std::next (it) == fonction->t.end ())
-          {
-            return NAN;
-          }
-          else
-          {
-            ++it;
-          }
-        }
-        y = (*it)->x0 +
-            (*it)->x1 * x +
-            (*it)->x2 * x * x +
-            (*it)->x3 * x * x * x +
-            (*it)->x4 * x * x * x * x +
-            (*it)->x5 * x * x * x * x * x +
-            (*it)->x6 * x * x * x * x * x * x;
-        return (double) y;
-      }
+      return NAN;
+    }
+    else
+    {
+      i++;
     }
-    ++it;
   }
   
-  return NAN;
+  return (double) common_polynome_y (&fonction->coef[i * 7U], x);
+}
+
+/**
+ * \brief Évalue un tronçon sur un bloc d'abscisses par la méthode de Horner.
+ *        Les coefficients étant copiés localement et la boucle étant sans
+ *        branchement, le compilateur la vectorise (SSE2, AVX2 ou NEON selon
+ *        la cible).
+ * \param c : les 7 coefficients du tronçon,
+ * \param x : les abscisses,
+ * \param nb : le nombre d'abscisses,
+ * \param y : les valeurs calculées.
+ * \return Rien.
+ */
+static void
+common_fonction_horner (const double *c,
+                        const double *x,
+                        uint32_t      nb,
+                        double       *y)
+{
+  double   c0 = c[0], c1 = c[1], c2 = c[2], c3 = c[3];
+  double   c4 = c[4], c5 = c[5], c6 = c[6];
+  uint32_t k;
+  
+  for (k = 0; k < nb; k++)
+  {
+    double xk = x[k];
+    
+    y[k] = ((((((c6 * xk + c5) * xk + c4) * xk + c3) * xk + c2) * xk + c1) *
+                                                                   xk) + c0;
+  }
+  
+  return;
 }
 
 
 /**
- * \brief Cherche l'abscisse dont l'ordonnée vaut 0.
- * \param fonction : fonction à analyser,
- * \param mini : valeur basse du domaine de recherche,
- * \param maxi : valeur haute du domaine de recherche,
- * \param zero_1 : première abscisse où l'ordonnée vaut 0,
- * \param zero_2 : deuxième abscisse où l'ordonnée vaut 0. Si un seul zéro est
- *                trouvé, il sera toujours dans zero1 et zero2 vaudra NAN.
+ * \brief Renvoie les valeurs f(x[k]) pour un tableau d'abscisses triées par
+ *        ordre croissant. Le résultat est identique à celui de
+ *        #common_fonction_y appelée pour chaque abscisse mais le tronçon
+ *        courant n'est recherché qu'en avançant et chaque suite d'abscisses
+ *        appartenant au même tronçon est évaluée d'un bloc.
+ * \param fonction : fonction à évaluer,
+ * \param x : les abscisses, triées par ordre croissant,
+ * \param nb : le nombre d'abscisses,
+ * \param position : gestion des discontinuités, cf. #common_fonction_y,
+ * \param y : les valeurs renvoyées, NAN pour les abscisses hors domaine.
  * \return
- *   Succès : false si aucun zéro n'est trouvé,
- *            true si au moins est trouvé.
+ *   Succès : true.\n
  *   Échec : false :
  *     - fonction == NULL,
- *     - maxi <= mini.
+ *     - x == NULL,
+ *     - y == NULL,
+ *     - position < -1 ou position > 1,
+ *     - les abscisses ne sont pas triées.
  */
 bool
-common_fonction_cherche_zero (Fonction *fonction,
-                              double    mini,
-                              double    maxi,
-                              double   *zero_1,
-                              double   *zero_2)
+common_fonction_y_tab (Fonction     *fonction,
+                       const double *x,
+                       uint32_t      nb,
+                       int8_t        position,
+                       double       *y)
 {
-  double xx1_2, xx2_2, xx3_2;
-  double yy1, yy2, yy3;
-  double a, b, c;
-  double zero1, zero2;
-  double ecart_x;
+  size_t   i = 0, nb_t;
+  uint32_t k = 0;
   
   BUGPARAM (fonction, "%p", fonction, false)
-  INFO (maxi > mini,
-        false,
-        (gettext("Borne [%lf,%lf] incorrecte.\n"), mini, maxi); )
-  
-  xx1_2 = mini;
-  xx3_2 = maxi;
-  xx2_2 = (xx1_2 + xx3_2) / 2.;
-  BUG (!std::isnan (yy1 = common_fonction_y (fonction, xx1_2,  1)), false)
-  BUG (!std::isnan (yy2 = common_fonction_y (fonction, xx2_2,  0)), false)
-  BUG (!std::isnan (yy3 = common_fonction_y (fonction, xx3_2, -1)), false)
+  BUGPARAM (x, "%p", x, false)
+  BUGPARAM (y, "%p", y, false)
+  BUGPARAM (position, "%d", ((-1 <= position) && (position <= 1)), false)
   
-  common_fonction_ax2_bx_c (xx1_2, yy1, xx2_2, yy2, xx3_2, yy3, &a, &b, &c);
+  nb_t = common_fonction_nb_troncons (fonction);
   
-  if (errmoy (a, ERRMOY_DIST))
+  // Abscisses situées avant le début de la fonction.
+  while ((k < nb) &&
+         ((nb_t == 0) ||
+          (x[k] < fonction->bornes[0]) ||
+          ((position == -1) && (errrel (fonction->bornes[0], x[k])))))
   {
-    if (errmoy (b, ERRMOY_DIST))
-    {
-      zero1 = NAN;
-      zero2 = NAN;
-    }
-    else
-    {
-      zero1 = -c / b;
-      if ((zero1 < mini) || (zero1 > maxi))
-      {
-        zero1 = NAN;
-      }
-      zero2 = NAN;
-    }
-  }
-  else
-  {
-    if (b * b - 4 * a * c < 0.)
-    {
-      zero1 = NAN;
-      zero2 = NAN;
-    }
-    else
-    {
-      zero1 = ( sqrt (b * b - 4 * a * c) - b) / (2 * a);
-      zero2 = (-sqrt (b * b - 4 * a * c) - b) / (2 * a);
-    }
+    INFO ((k == 0) || (x[k - 1] <= x[k]),
+          false,
+          (gettext ("Les abscisses doivent être triées par ordre croissant.\n")); )
+    y[k] = NAN;
+    k++;
   }
   
-  if ((zero1 < mini) || (zero1 > maxi))
-  {
-    zero1 = NAN;
-  }
-  if ((zero2 < mini) || (zero2 > maxi))
+  // Pour chaque tronçon Faire
+  //   Recherche de la suite d'abscisses [k, fin[ appartenant au tronçon.
+  //   Évaluation du bloc.
+  //   Si position vaut 1, les abscisses égales à la fin du tronçon sont
+  //     évaluées avec le tronçon suivant.
+  // FinPour
+  while ((k < nb) && (i < nb_t))
   {
-    zero2 = NAN;
-  }
-  // Idéalement, il faudrait faire une boucle ci-dessous mais les limitations
-  // de la précision de la virgule flottante va attendre ces limites en
-  // quelques itérations. On utilise cette méthode 2 fois pour déterminer une
-  // première estimation précise des zéro avec l'écart. Pour la suite, on le
-  // fait par le biais d'une recherche dicotomique.
-  ecart_x = (maxi - mini) / 4.;
-  if (!std::isnan (zero1))
-  {
-    double zero1_old = zero1;
+    uint32_t fin = k;
+    uint32_t j;
     
-    if (zero1 - ecart_x < mini)
-    {
-      xx1_2 = mini;
-    }
-    else
+    while ((fin < nb) && (x[fin] <= fonction->bornes[i + 1]))
     {
-      xx1_2 = zero1 - ecart_x;
+      INFO ((fin == 0) || (x[fin - 1] <= x[fin]),
+            false,
+            (gettext ("Les abscisses doivent être triées par ordre croissant.\n")); )
+      fin++;
     }
-    if (zero1 + ecart_x > maxi)
-    {
-      xx3_2 = maxi;
-    }
-    else
-    {
-      xx3_2 = zero1 + ecart_x;
-    }
-    xx2_2 = (xx1_2 + xx3_2) / 2.;
     
-    common_fonction_ax2_bx_c (xx1_2,
-                              common_fonction_y (fonction, xx1_2, 1),
-                              xx2_2,
-                              common_fonction_y (fonction, xx2_2, 0),
-                              xx3_2,
-                              common_fonction_y (fonction, xx3_2, -1),
-                              &a,
-                              &b,
-                              &c);
+    common_fonction_horner (&fonction->coef[i * 7U], &x[k], fin - k, &y[k]);
     
-    if (errmoy (a, ERRMOY_DIST))
+    if (position == 1)
     {
-      if (errmoy (b, ERRMOY_DIST))
-      {
-        zero1 = NAN;
-      }
-      else
+      j = fin;
+      while ((j > k) && (errrel (fonction->bornes[i + 1], x[j - 1])))
       {
-        zero1 = - c / b;
+        j--;
       }
-    }
-    else
-    {
-      if (b * b - 4 * a * c < 0.)
+      if (i + 1 == nb_t)
       {
-        zero1 = NAN;
+        while (j < fin)
+        {
+          y[j] = NAN;
+          j++;
+        }
       }
       else
       {
-        zero1 = (sqrt (b * b - 4 * a * c) - b) / (2 * a);
+        common_fonction_horner (&fonction->coef[(i + 1U) * 7U],
+                                &x[j],
+                                fin - j,
+                                &y[j]);
       }
     }
     
-    ecart_x = fabs (zero1_old - zero1) / 2.;
-  }
-  if ((zero1 < mini) || (zero1 > maxi))
-  {
-    zero1 = NAN;
+    k = fin;
+    i++;
   }
   
-  // Recherche dicotomique du zero1
-  // Première vérification d'usage.
-  if ((!std::isnan (zero1)) && (!(errmoy (ecart_x, ERRMOY_DIST))))
+  // Abscisses situées après la fin de la fonction.
+  while (k < nb)
   {
-    xx1_2 = std::max (zero1 - ecart_x, mini);
-    xx3_2 = std::min (zero1 + ecart_x, maxi);
-    xx2_2 = (xx1_2 + xx3_2) / 2.;
-    while (! (errmoy (xx3_2 - xx1_2, ERRMOY_DIST)))
-    {
-      if (std::signbit (common_fonction_y (fonction, xx1_2, 1)) ==
-                         std::signbit (common_fonction_y (fonction, xx2_2, 0)))
-      {
-        xx1_2 = xx2_2;
-      }
-      else
-      {
-        xx3_2 = xx2_2;
-      }
-      xx2_2 = (xx1_2 + xx3_2) / 2.;
-    }
-    zero1 = (xx3_2 + xx1_2) / 2.;
+    INFO ((k == 0) || (x[k - 1] <= x[k]),
+          false,
+          (gettext ("Les abscisses doivent être triées par ordre croissant.\n")); )
+    y[k] = NAN;
+    k++;
   }
   
-  // On passe à la recherche du zero2 par la même méthode de travail
-  ecart_x = (maxi - mini) / 4.;
-  if (!std::isnan (zero2))
-  {
-    double zero2_old = zero2;
-    
-    if (zero2 - ecart_x < mini)
-    {
-      xx1_2 = mini;
-    }
-    else
-    {
-      xx1_2 = zero2 - ecart_x;
-    }
-    if (zero2 + ecart_x > maxi)
-    {
-      xx3_2 = maxi;
-    }
-    else
-    {
-      xx3_2 = zero2 + ecart_x;
-    }
-    xx2_2 = (xx1_2 + xx3_2) / 2.;
-    
-    common_fonction_ax2_bx_c (xx1_2,
-                              common_fonction_y (fonction, xx1_2, 1),
-                              xx2_2,
-                              common_fonction_y (fonction, xx2_2, 0),
-                              xx3_2,
-                              common_fonction_y (fonction, xx3_2, -1),
-                              &a,
-                              &b,
-                              &c);
-    
-    if (errmoy (a, ERRMOY_DIST))
-    {
-      if (errmoy (b, ERRMOY_DIST))
-      {
-        zero2 = NAN;
-      }
-      else
-      {
-        zero2 = - c / b;
-      }
-    }
-    else
-    {
-      if (b * b - 4 * a * c < 0.)
-      {
-        zero2 = NAN;
-      }
-      else
-      {
-        zero2 = (- sqrt(b * b - 4 * a * c) - b) / (2 * a);
-      }
-    }
-    
-    ecart_x = fabs (zero2_old - zero2) / 2.;
-  }
-  // Dicotomie
-  if ((!std::isnan (zero2)) && (!(errmoy (ecart_x, ERRMOY_DIST))))
+  return true;
+}
+
+
+/**
+ * \brief Cherche l'abscisse dont l'ordonnée vaut 0. Les racines de chaque
+ *        tronçon compris entre mini et maxi sont calculées exactement par
+ *        #common_polynome_racines.
+ * \param fonction : fonction à analyser,
+ * \param mini : valeur basse du domaine de recherche,
+ * \param maxi : valeur haute du domaine de recherche,
+ * \param zero_1 : première abscisse où l'ordonnée vaut 0,
+ * \param zero_2 : deuxième abscisse où l'ordonnée vaut 0. Si un seul zéro est
+ *                trouvé, il sera toujours dans zero1 et zero2 vaudra NAN.
+ * \return
+ *   Succès : true si un unique zéro est trouvé,
+ *            false si aucun zéro ou plusieurs zéros sont trouvés.
+ *   Échec : false :
+ *     - fonction == NULL,
+ *     - maxi <= mini,
+ *     - mini ou maxi en dehors du domaine de la fonction.
+ */
+bool
+common_fonction_cherche_zero (Fonction *fonction,
+                              double    mini,
+                              double    maxi,
+                              double   *zero_1,
+                              double   *zero_2)
+{
+  double  zeros[2] = {NAN, NAN};
+  double  racines[6];
+  uint8_t nb = 0, nb_r, j;
+  size_t  i;
+  
+  BUGPARAM (fonction, "%p", fonction, false)
+  INFO (maxi > mini,
+        false,
+        (gettext("Borne [%lf,%lf] incorrecte.\n"), mini, maxi); )
+  BUG (!std::isnan (common_fonction_y (fonction, mini, 1)), false)
+  BUG (!std::isnan (common_fonction_y (fonction, maxi, -1)), false)
+  
+  i = common_fonction_troncon (fonction, mini);
+  while ((i < common_fonction_nb_troncons (fonction)) &&
+         (fonction->bornes[i] < maxi))
   {
-    xx1_2 = std::max (zero2 - ecart_x, mini);
-    xx3_2 = std::min (zero2 + ecart_x, maxi);
-    xx2_2 = (xx1_2 + xx3_2) / 2.;
-    while (! (errmoy (xx3_2 - xx1_2, ERRMOY_DIST)))
+    nb_r = common_polynome_racines (&fonction->coef[i * 7U],
+                                    std::max (mini, fonction->bornes[i]),
+                                    std::min (maxi, fonction->bornes[i + 1]),
+                                    racines);
+    for (j = 0; j < nb_r; j++)
     {
-      if (std::signbit (common_fonction_y (fonction, xx1_2, 1)) ==
-                         std::signbit (common_fonction_y (fonction, xx2_2, 0)))
+      // Un zéro situé à la jonction de deux tronçons n'est compté qu'une
+      // fois.
+      if ((nb != 0) &&
+          (errmoy (racines[j] - zeros[std::min (nb, (uint8_t) 2) - 1],
+                   ERRMOY_DIST)))
       {
-        xx1_2 = xx2_2;
+        continue;
       }
-      else
+      if (nb < 2)
       {
-        xx3_2 = xx2_2;
+        zeros[nb] = racines[j];
       }
-      xx2_2 = (xx1_2 + xx3_2) / 2.;
+      nb++;
     }
-    zero2 = (xx3_2 + xx1_2) / 2.;
+    i++;
   }
   
-  if ((zero2 < mini) || (zero2 > maxi))
-  {
-    zero2 = NAN;
-  }
+  *zero_1 = zeros[0];
+  *zero_2 = zeros[1];
   
-  if ((std::isnan (zero1)) && (std::isnan (zero2)))
-  {
-    *zero_1 = NAN;
-    *zero_2 = NAN;
-  }
-  else if ((std::isnan (zero1)) && (!std::isnan (zero2)))
-  {
-    *zero_1 = zero2;
-    *zero_2 = NAN;
-  }
-  else if ((!std::isnan (zero1)) && (std::isnan (zero2)))
-  {
-    *zero_1 = zero1;
-    *zero_2 = NAN;
-  }
-  else if (errrel (zero1, zero2))
-  {
-    *zero_1 = zero1;
-    *zero_2 = NAN;
-  }
-  else
-  {
-    *zero_1 = zero1;
-    *zero_2 = zero2;
-  }
-  
-  if ((std::isnan (*zero_1)) || (!std::isnan (*zero_2)))
-  {
-    return false;
-  }
-  
-  return true;
+  return nb == 1;
 }
 
 
@@ -867,53 +842,47 @@ common_fonction_caracteristiques (Fonction *fonction,
   uint8_t  j;
   double  *pos_tmp = NULL, *val_tmp = NULL;
   void    *tmp;
-  
-  std::list <Troncon *>::iterator it;
+  size_t   i;
+  double   derivee[7], racines[12];
+  uint8_t  nb_r;
   
   BUGPARAM (fonction, "%p", fonction, 0)
   BUGPARAM (pos, "%p", pos, 0)
   BUGPARAM (val, "%p", val, 0)
   
-  if (fonction->t.size () == 0)
+  if (common_fonction_nb_troncons (fonction) == 0)
   {
     *pos = NULL;
     *val = NULL;
     return 0;
   }
   
-  it = fonction->t.begin ();
-  while (it != fonction->t.end ())
+  for (i = 0; i < common_fonction_nb_troncons (fonction); i++)
   {
     // On commence par s'occuper du début du tronçon. 
     
     // On ajoute si c'est le début de la fonction
-    if (it == fonction->t.begin ())
+    if (i == 0)
     {
       BUGCRIT (pos_tmp = (double *) malloc (sizeof (double)),
                0,
                (gettext ("Erreur d'allocation mémoire.\n")); )
-      pos_tmp[0] = (*it)->debut_troncon;
+      pos_tmp[0] = fonction->bornes[i];
       BUGCRIT (val_tmp = (double *) malloc (sizeof (double)),
                0,
                (gettext ("Erreur d'allocation mémoire.\n"));
                  free (pos_tmp); )
       val_tmp[0] = common_fonction_y (fonction,
-                                      (*it)->debut_troncon,
+                                      fonction->bornes[i],
                                       1);
       nb = 1;
     }
     else
     {
-      // On vérifie si la fonction est discontinue en x
-      if ((!errrel ((*it)->debut_troncon,
-                    (*std::prev (it))->fin_troncon)) ||
-      // ou si elle est discontinue en y
-          (!errrel (common_fonction_y (fonction,
-                                       (*it)->debut_troncon,
-                                       -1),
-                    common_fonction_y (fonction,
-                                       (*it)->debut_troncon,
-                                       1))))
+      // On vérifie si la fonction est discontinue en y. Les tronçons étant
+      // contigus, elle ne peut pas l'être en x.
+      if (!errrel (common_fonction_y (fonction, fonction->bornes[i], -1),
+                   common_fonction_y (fonction, fonction->bornes[i], 1)))
       {
         nb++;
         tmp = pos_tmp;
@@ -922,7 +891,7 @@ common_fonction_caracteristiques (Fonction *fonction,
                  (gettext ("Erreur d'allocation mémoire.\n"));
                    free (tmp);
                    free (val_tmp); )
-        pos_tmp[nb - 1] = (*it)->debut_troncon;
+        pos_tmp[nb - 1] = fonction->bornes[i];
         tmp = val_tmp;
         BUGCRIT (val_tmp = (double *) realloc (val_tmp, sizeof (double) * nb),
                  0,
@@ -930,7 +899,7 @@ common_fonction_caracteristiques (Fonction *fonction,
                    free (pos_tmp);
                    free (tmp); )
         val_tmp[nb - 1] = common_fonction_y (fonction,
-                                             (*it)->debut_troncon,
+                                             fonction->bornes[i],
                                              -1);
         nb++;
         tmp = pos_tmp;
@@ -939,7 +908,7 @@ common_fonction_caracteristiques (Fonction *fonction,
                  (gettext ("Erreur d'allocation mémoire.\n"));
                    free (tmp);
                    free (val_tmp); )
-        pos_tmp[nb - 1] = (*it)->debut_troncon;
+        pos_tmp[nb - 1] = fonction->bornes[i];
         tmp = val_tmp;
         BUGCRIT (val_tmp = (double *) realloc (val_tmp, sizeof (double) * nb),
                  0,
@@ -947,26 +916,20 @@ common_fonction_caracteristiques (Fonction *fonction,
                    free (pos_tmp);
                    free (tmp); )
         val_tmp[nb - 1] = common_fonction_y (fonction,
-                                             (*it)->debut_troncon,
+                                             fonction->bornes[i],
                                              1);
       }
       // Si elle est continue, elle est un point caractéristique si sa dérivée
-      // change de signe. Rappel : f'(x)=(f(x+Dx)-f(x))/Dx. Dans notre cas, on
-      // prendra Dx = 1/1000 du troncon.
+      // change de signe. La dérivée de chaque tronçon est calculée
+      // exactement.
       else
       {
-        double dx;
         double fprim1, fprim2;
         
-        dx = ((*std::prev (it))->fin_troncon -
-                                     (*std::prev (it))->debut_troncon) / 1000.;
-        fprim1 = (common_fonction_y (fonction, (*it)->debut_troncon, -1) -
-                  common_fonction_y (fonction, (*it)->debut_troncon - dx, 0)) /
-                 dx;
-        
-        dx = ((*it)->fin_troncon - (*it)->debut_troncon) / 1000.;
-        fprim2 = (common_fonction_y (fonction, (*it)->debut_troncon + dx, 0) -
-                  common_fonction_y (fonction, (*it)->debut_troncon, 1)) / dx;
+        common_polynome_derive (&fonction->coef[(i - 1U) * 7U], derivee);
+        fprim1 = (double) common_polynome_y (derivee, fonction->bornes[i]);
+        common_polynome_derive (&fonction->coef[i * 7U], derivee);
+        fprim2 = (double) common_polynome_y (derivee, fonction->bornes[i]);
         
         if (std::signbit (fprim1) != std::signbit (fprim2))
         {
@@ -978,7 +941,7 @@ common_fonction_caracteristiques (Fonction *fonction,
                    (gettext ("Erreur d'allocation mémoire.\n"));
                      free (tmp);
                      free (val_tmp); )
-          pos_tmp[nb - 1] = (*it)->debut_troncon;
+          pos_tmp[nb - 1] = fonction->bornes[i];
           tmp = val_tmp;
           BUGCRIT (val_tmp = (double *) realloc (val_tmp,
                                                  sizeof (double) * nb),
@@ -987,469 +950,52 @@ common_fonction_caracteristiques (Fonction *fonction,
                      free (pos_tmp);
                      free (tmp); )
           val_tmp[nb - 1] = common_fonction_y (fonction,
-                                               (*it)->debut_troncon,
+                                               fonction->bornes[i],
                                                -1);
         }
       }
     }
     
-    // On étudie l'intérieur du tronçon
-    for (j = 0; j < 9; j++)
+    // On étudie l'intérieur du tronçon : les zéros de la fonction et de sa
+    // dérivée (extremums) sont calculés exactement puis ajoutés par ordre
+    // croissant. Ceux situés à la fin du tronçon sont traités avec le tronçon
+    // suivant.
+    common_polynome_derive (&fonction->coef[i * 7U], derivee);
+    nb_r = common_polynome_racines (&fonction->coef[i * 7U],
+                                    fonction->bornes[i],
+                                    fonction->bornes[i + 1],
+                                    racines);
+    nb_r = (uint8_t) (nb_r + common_polynome_racines (derivee,
+                                                      fonction->bornes[i],
+                                                      fonction->bornes[i + 1],
+                                                      &racines[nb_r]));
+    std::sort (racines, racines + nb_r);
+    for (j = 0; j < nb_r; j++)
     {
-      double xx1, xx2, xx3;
-      double xx1_2, xx2_2, xx3_2;
-      double a, b, c; // forme de l'interpolation : a*x²+b*x+c
-      double zero1, zero2, deriv_zero;
-      double zero2_old = NAN, deriv_zero_old = NAN;
-      double ecart_x, ecart_old;
-      
-      // On commence par calculer une interpolation hyperbolique
-      // On s'arrange pour que la deuxième moitié du tronçon à analyser soit la
-      // première moitié du tronçon suivant. C'est une sécurité. En effet, on
-      // ne connait pas l'erreur de l'approximation faite. Il se pourrait
-      // qu'avec l'approximation de base x soit dans l'intervalle mais que,
-      // suite à l'affinement x en sorte.
-      xx1 = (*it)->debut_troncon +
-              ((*it)->fin_troncon - (*it)->debut_troncon) / 10. * j;
-      xx2 = (*it)->debut_troncon +
-              ((*it)->fin_troncon - (*it)->debut_troncon) / 10. * (j + 1);
-      xx3 = (*it)->debut_troncon +
-              ((*it)->fin_troncon - (*it)->debut_troncon) / 10. * (j + 2.);
-      
-      common_fonction_ax2_bx_c (xx1,
-                                common_fonction_y (fonction, xx1, 1),
-                                xx2,
-                                common_fonction_y (fonction, xx2, 0),
-                                xx3,
-                                common_fonction_y (fonction, xx3, -1),
-                                &a,
-                                &b,
-                                &c);
-      
-      if (errmoy (a, ERRMOY_DIST))
-      {
-        if (errmoy (b, ERRMOY_DIST))
-        {
-          zero1 = NAN;
-          zero2 = NAN;
-        }
-        else
-        {
-          zero1 = - c / b;
-          zero2 = NAN;
-        }
-        deriv_zero = NAN;
-      }
-      else
-      {
-        if (b * b - 4 * a * c < 0.)
-        {
-          zero1 = NAN;
-          zero2 = NAN;
-        }
-        else
-        {
-          // maxima : solve(a*x^2+b*x+c=0,x);
-          zero1 = ( sqrt (b * b - 4 * a * c) - b) / (2 * a);
-          zero2 = (-sqrt (b * b - 4 * a * c) - b) / (2 * a);
-        }
-        deriv_zero = - b / (2 * a);
-      }
-      
-      if ((deriv_zero < xx1) || (deriv_zero > xx3))
-      {
-        deriv_zero = NAN;
-      }
-      if ((zero1 < xx1) || (zero1 > xx3))
-      {
-        zero1 = NAN;
-      }
-      if ((zero2 < xx1) || (zero2 > xx3))
-      {
-        zero2 = NAN;
-      }
-      
-      ecart_old = xx3 - xx1;
-      ecart_x = (xx3 - xx1) / 4.;
-      while ((!std::isnan (zero1)) && (!errmoy (ecart_x, ERRMOY_DIST)))
-      {
-        double zero1_old = zero1;
-        
-        if (zero1 - ecart_x < xx1)
-        {
-          xx1_2 = xx1;
-        }
-        else
-        {
-          xx1_2 = zero1 - ecart_x;
-        }
-        if (zero1 + ecart_x > xx3)
-        {
-          xx3_2 = xx3;
-        }
-        else
-        {
-          xx3_2 = zero1 + ecart_x;
-        }
-        xx2_2 = (xx1_2 + xx3_2) / 2.;
-        
-        common_fonction_ax2_bx_c (xx1_2,
-                                  common_fonction_y (fonction, xx1_2, 1),
-                                  xx2_2,
-                                  common_fonction_y (fonction, xx2_2, 0),
-                                  xx3_2,
-                                  common_fonction_y (fonction, xx3_2, -1),
-                                  &a,
-                                  &b,
-                                  &c);
-        
-        if (errmoy (a, ERRMOY_DIST))
-        {
-          if (errmoy (b, ERRMOY_DIST))
-          {
-            zero1 = NAN;
-          }
-          else
-          {
-            zero1 = - c / b;
-            if ((zero1 < xx1) || (zero1 > xx3))
-            {
-              zero1 = NAN;
-            }
-          }
-        }
-        else
-        {
-          if (b * b - 4 * a * c < 0.)
-          {
-            zero1 = NAN;
-          }
-          else
-          {
-            zero1 = (sqrt (b * b - 4 * a * c) - b) / (2 * a);
-            if ((zero1 < xx1) || (zero1 > xx3))
-            {
-              zero1 = NAN;
-            }
-          }
-        }
-        ecart_x = fabs (zero1_old - zero1) / 4.;
-        if (ecart_x > ecart_old)
-        {
-          // Si on arrive ici, c'est que la méthode ci-dessus ne marche plus à
-          // cause des imprécisions dûes aux virgules flottantes. On passe donc
-          // en mode recherche dicotomique en calculant le signe aux points
-          // xx1_2, xx2_2 et xx3_2. Si le signe de xx1_2 est le même que xx2_2,
-          // xx1_2 devient égal à xx2_2. Si le signe de xx3_2 est le même que
-          // xx2_2, xx3_2 devient égal à xx2_2.
-          // La méthode est un peu plus longue mais est moins problématique.
-          while (true)
-          {
-            if (std::signbit (common_fonction_y (fonction, xx1_2, 1)) ==
-                         std::signbit (common_fonction_y (fonction, xx2_2, 0)))
-            {
-              xx1_2 = xx2_2;
-            }
-            else
-            {
-              xx3_2 = xx2_2;
-            }
-            if (errmoy (xx3_2 - xx1_2, ERRMOY_DIST))
-            {
-              zero1 = (xx3_2 + xx1_2) / 2.;
-              break;
-            }
-            xx2_2 = (xx3_2 + xx1_2) / 2.;
-          }
-          
-          break;
-        }
-        else
-        {
-          if ((zero1 < xx1) || (zero1 > xx3))
-          {
-            zero1 = NAN;
-          }
-        }
-        ecart_old = ecart_x;
-      }
-      
-      ecart_old = xx3 - xx1;
-      ecart_x = (xx3 - xx1) / 4.;
-      while ((!std::isnan (zero2)) && (!errmoy (ecart_x, ERRMOY_DIST)))
-      {
-        zero2_old = zero2;
-        if (zero2 - ecart_x < xx1)
-        {
-          xx1_2 = xx1;
-        }
-        else
-        {
-          xx1_2 = zero2 - ecart_x;
-        }
-        if (zero2 + ecart_x > xx3)
-        {
-          xx3_2 = xx3;
-        }
-        else
-        {
-          xx3_2 = zero2 + ecart_x;
-        }
-        xx2_2 = (xx1_2 + xx3_2) / 2.;
-        
-        common_fonction_ax2_bx_c (xx1_2,
-                                  common_fonction_y (fonction, xx1_2, 1),
-                                  xx2_2,
-                                  common_fonction_y (fonction, xx2_2, 0),
-                                  xx3_2,
-                                  common_fonction_y (fonction, xx3_2, -1),
-                                  &a,
-                                  &b,
-                                  &c);
-        
-        if (errmoy (a, ERRMOY_DIST))
-        {
-          if (errmoy (b, ERRMOY_DIST))
-          {
-            zero2 = NAN;
-          }
-          else
-          {
-            zero2 = - c / b;
-            if ((zero2 < xx1) || (zero2 > xx3))
-            {
-              zero2 = NAN;
-            }
-          }
-        }
-        else
-        {
-          if (b * b - 4 * a * c < 0.)
-          {
-            zero2 = NAN;
-          }
-          else
-          {
-            zero2 = (-sqrt (b * b - 4 * a * c) - b) / (2 * a);
-            if ((zero2 < xx1) || (zero2 > xx3))
-            {
-              zero2 = NAN;
-            }
-          }
-        }
-        ecart_x = fabs (zero2_old - zero2) / 4.;
-        if (ecart_x > ecart_old)
-        {
-          // Si on arrive ici, c'est que la méthode ci-dessus ne marche plus à
-          // cause des imprécisions dues aux virgules flottantes. On passe donc
-          // en mode recherche dicotomique en calculant le signe aux points
-          // xx1_2, xx2_2 et xx3_2. Si le signe de xx1_2 est le même que xx2_2,
-          // xx1_2 devient égal à xx2_2. Si le signe de xx3_2 est le même que
-          // xx2_2, xx3_2 devient égal à xx2_2.
-          // La méthode est un peu plus longue mais est moins problématique.
-          while (true)
-          {
-            if (std::signbit (common_fonction_y (fonction, xx1_2, 1)) ==
-                         std::signbit (common_fonction_y (fonction, xx2_2, 0)))
-            {
-              xx1_2 = xx2_2;
-            }
-            else
-            {
-              xx3_2 = xx2_2;
-            }
-            if (errmoy (xx3_2 - xx1_2, ERRMOY_DIST))
-            {
-              zero2 = (xx3_2 + xx1_2) / 2.;
-              break;
-            }
-            xx2_2 = (xx3_2 + xx1_2) / 2.;
-          }
-          
-          break;
-        }
-        else
-        {
-          if ((zero2 < xx1) || (zero2 > xx3))
-          {
-            zero2 = NAN;
-          }
-        }
-      }
-      
-      ecart_old = xx3 - xx1;
-      ecart_x = (xx3 - xx1) / 4.;
-      while ((!std::isnan (deriv_zero)) && (!errmoy (ecart_x, ERRMOY_DIST)))
-      {
-        deriv_zero_old = deriv_zero;
-        if (deriv_zero - ecart_x < xx1)
-        {
-          xx1_2 = xx1;
-        }
-        else
-        {
-          xx1_2 = deriv_zero - ecart_x;
-        }
-        if (deriv_zero + ecart_x > xx3)
-        {
-          xx3_2 = xx3;
-        }
-        else
-        {
-          xx3_2 = deriv_zero + ecart_x;
-        }
-        xx2_2 = (xx1_2 + xx3_2) / 2.;
-        
-        common_fonction_ax2_bx_c (xx1_2,
-                                  common_fonction_y (fonction, xx1_2, 1),
-                                  xx2_2,
-                                  common_fonction_y (fonction, xx2_2, 0),
-                                  xx3_2,
-                                  common_fonction_y (fonction, xx3_2, -1),
-                                  &a,
-                                  &b,
-                                  &c);
-        
-        if (errmoy (a, ERRMOY_DIST))
-        {
-          deriv_zero = NAN;
-        }
-        else
-        {
-          deriv_zero = - b / (2 * a);
-        }
-        ecart_x = fabs (deriv_zero_old - deriv_zero) / 4.;
-        if (ecart_x > ecart_old)
-        {
-          // Si on arrive ici, c'est que la méthode ci-dessus ne marche plus à
-          // cause des imprécisions dues aux virgules flottantes. On passe donc
-          // en mode recherche dicotomique en calculant le signe de la dérivée
-          // aux points xx1_2, xx2_2 et xx3_2. Si le signe de xx1_2 est le même
-          // que xx2_2, xx1_2 devient égal à xx2_2. Si le signe de xx3_2 est le
-          // même que xx2_2, xx3_2 devient égal à xx2_2.
-          // La méthode est un peu plus longue mais est moins problématique.
-          while (true)
-          {
-            ecart_old = xx3_2 - xx1_2;
-            a = common_fonction_y (fonction, xx1_2 + ecart_old / 10., 1) -
-                                        common_fonction_y (fonction, xx1_2, 1);
-            b = common_fonction_y (fonction, xx2_2 + ecart_old / 10., 0) -
-                                        common_fonction_y (fonction, xx2_2, 0);
-            c = common_fonction_y (fonction, xx3_2, -1) -
-                     common_fonction_y (fonction, xx3_2 - ecart_old / 10., -1);
-            if (std::signbit (a) == std::signbit (b))
-            {
-              xx1_2 = xx2_2;
-            }
-            else
-            {
-              xx3_2 = xx2_2;
-            }
-            if (errmoy (xx3_2 - xx1_2, ERRMOY_DIST))
-            {
-              deriv_zero = (xx3_2 + xx1_2) / 2.;
-              break;
-            }
-            xx2_2 = (xx3_2 + xx1_2) / 2.;
-          }
-          
-          break;
-        }
-        else
-        {
-          if ((deriv_zero < xx1) || (deriv_zero > xx3))
-          {
-            deriv_zero = NAN;
-          }
-        }
-        ecart_old = ecart_x;
-      }
-      
-      // On tri les résultats.
-      a = zero1;
-      b = zero2;
-      c = deriv_zero;
-      
-      if (a > b)
-      {
-        a = zero2;
-        b = zero1;
-      }
-      if (b > c)
-      {
-        ecart_x = b;
-        b = c;
-        c = ecart_x;
-      }
-      if (a > c)
+      if ((errmoy (pos_tmp[nb - 1] - racines[j], ERRMOY_DIST)) ||
+          (errmoy (fonction->bornes[i + 1] - racines[j], ERRMOY_DIST)))
       {
-        ecart_x = a;
-        a = c;
-        c = ecart_x;
-      }
-      
-      if ((!std::isnan (a)) && (!errmoy (pos_tmp [nb - 1] - a, ERRMOY_DIST)))
-      {
-        nb++;
-        tmp = pos_tmp;
-        BUGCRIT (pos_tmp = (double *) realloc (pos_tmp, sizeof (double) * nb),
-                 0,
-                 (gettext ("Erreur d'allocation mémoire.\n"));
-                   free (tmp);
-                   free (val_tmp); )
-        pos_tmp[nb - 1] = a;
-        tmp = val_tmp;
-        BUGCRIT (val_tmp = (double *) realloc (val_tmp, sizeof (double) * nb),
-                 0,
-                 (gettext ("Erreur d'allocation mémoire.\n"));
-                   free (pos_tmp);
-                   free (tmp); )
-        val_tmp[nb - 1] = common_fonction_y (fonction, a, 0);
-      }
-      if ((!std::isnan (b)) && (!errmoy (pos_tmp[nb - 1] - b, ERRMOY_DIST)))
-      {
-        nb++;
-        tmp = pos_tmp;
-        BUGCRIT (pos_tmp = (double *) realloc (pos_tmp, sizeof (double) * nb),
-                 0,
-                 (gettext ("Erreur d'allocation mémoire.\n"));
-                   free (tmp);
-                   free (val_tmp); )
-        pos_tmp[nb - 1] = b;
-        tmp = val_tmp;
-        BUGCRIT (val_tmp = (double *) realloc (val_tmp, sizeof (double) * nb),
-                 0,
-                 (gettext ("Erreur d'allocation mémoire.\n"));
-                   free (pos_tmp);
-                   free (tmp); )
-        val_tmp[nb - 1] = common_fonction_y (fonction, b, 0);
-      }
-      if ((!std::isnan (c)) && (!errmoy (pos_tmp [nb - 1] - c, ERRMOY_DIST)))
-      {
-        nb++;
-        tmp = pos_tmp;
-        BUGCRIT (pos_tmp = (double *) realloc (pos_tmp, sizeof (double) * nb),
-                 0,
-                 (gettext ("Erreur d'allocation mémoire.\n"));
-                   free (tmp);
-                   free (val_tmp); )
-        pos_tmp[nb - 1] = c;
-        tmp = val_tmp;
-        BUGCRIT (val_tmp = (double *) realloc (val_tmp, sizeof (double) * nb),
-                 0,
-                 (gettext ("Erreur d'allocation mémoire.\n"));
-                   free (pos_tmp);
-                   free (tmp); )
-        val_tmp[nb - 1] = common_fonction_y (fonction, c, 0);
+        continue;
       }
+      nb++;
+      tmp = pos_tmp;
+      BUGCRIT (pos_tmp = (double *) realloc (pos_tmp, sizeof (double) * nb),
+               0,
+               (gettext ("Erreur d'allocation mémoire.\n"));
+                 free (tmp);
+                 free (val_tmp); )
+      pos_tmp[nb - 1] = racines[j];
+      tmp = val_tmp;
+      BUGCRIT (val_tmp = (double *) realloc (val_tmp, sizeof (double) * nb),
+               0,
+               (gettext ("Erreur d'allocation mémoire.\n"));
+                 free (pos_tmp);
+                 free (tmp); )
+      val_tmp[nb - 1] = common_fonction_y (fonction, racines[j], 0);
     }
-    
-    ++it;
   }
   
-  it = std::prev (fonction->t.end ());
-  if (!errrel (pos_tmp[nb - 1],
-               (*it)->fin_troncon))
+  if (!errrel (pos_tmp[nb - 1], fonction->bornes.back ()))
   {
     nb++;
     tmp = pos_tmp;
@@ -1458,20 +1004,100 @@ common_fonction_caracteristiques (Fonction *fonction,
              (gettext ("Erreur d'allocation mémoire.\n"));
                free (tmp);
                free (val_tmp); )
-    pos_tmp[nb - 1] = (*it)->fin_troncon;
+    pos_tmp[nb - 1] = fonction->bornes.back ();
     tmp = val_tmp;
     BUGCRIT (val_tmp = (double *) realloc (val_tmp, sizeof (double) * nb),
              0,
              (gettext ("Erreur d'allocation mémoire.\n"));
                free (pos_tmp);
                free (tmp); )
-    val_tmp[nb - 1] = common_fonction_y (fonction, (*it)->fin_troncon, -1);
+    val_tmp[nb - 1] = common_fonction_y (fonction,
+                                         fonction->bornes.back (),
+                                         -1);
+  }
+  
+  *pos = pos_tmp;
+  *val = val_tmp;
+  
+  return nb;
+}
+
+/**
+ * \brief Renvoie les valeurs minimale et maximale de la fonction ainsi que
+ *        leurs abscisses. Les candidats sont les extrémités de chaque tronçon
+ *        (avec la valeur propre au tronçon en cas de discontinuité) et les
+ *        zéros de la dérivée calculés exactement par
+ *        #common_polynome_racines.
+ * \param fonction : fonction à analyser,
+ * \param x_min : abscisse du minimum,
+ * \param y_min : valeur du minimum,
+ * \param x_max : abscisse du maximum,
+ * \param y_max : valeur du maximum.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - fonction == NULL,
+ *     - x_min == NULL,
+ *     - y_min == NULL,
+ *     - x_max == NULL,
+ *     - y_max == NULL,
+ *     - fonction vide.
+ */
+bool
+common_fonction_extremums (Fonction *fonction,
+                           double   *x_min,
+                           double   *y_min,
+                           double   *x_max,
+                           double   *y_max)
+{
+  size_t i;
+  
+  BUGPARAM (fonction, "%p", fonction, false)
+  BUGPARAM (x_min, "%p", x_min, false)
+  BUGPARAM (y_min, "%p", y_min, false)
+  BUGPARAM (x_max, "%p", x_max, false)
+  BUGPARAM (y_max, "%p", y_max, false)
+  INFO (common_fonction_nb_troncons (fonction) != 0,
+        false,
+        (gettext ("Fonction indéfinie.\n")); )
+  
+  *x_min = NAN;
+  *y_min = INFINITY;
+  *x_max = NAN;
+  *y_max = -INFINITY;
+  
+  for (i = 0; i < common_fonction_nb_troncons (fonction); i++)
+  {
+    double *c = &fonction->coef[i * 7U];
+    double  derivee[7], x[8];
+    uint8_t nb_x, j;
+    
+    common_polynome_derive (c, derivee);
+    x[0] = fonction->bornes[i];
+    x[1] = fonction->bornes[i + 1];
+    nb_x = (uint8_t) (2U + common_polynome_racines (derivee,
+                                                    fonction->bornes[i],
+                                                    fonction->bornes[i + 1],
+                                                    &x[2]));
+    
+    for (j = 0; j < nb_x; j++)
+    {
+      double y = (double) common_polynome_y (c, x[j]);
+      
+      if (y < *y_min)
+      {
+        *x_min = x[j];
+        *y_min = y;
+      }
+      if (y > *y_max)
+      {
+        *x_max = x[j];
+        *y_max = y;
+      }
+    }
   }
   
-  *pos = pos_tmp;
-  *val = val_tmp;
-  
-  return nb;
+  return true;
 }
 
 
@@ -1529,54 +1155,44 @@ common_fonction_affiche_caract (Fonction *fonction,
 bool
 common_fonction_affiche (Fonction *fonction)
 {
-  std::list <Troncon *>::iterator it;
+  size_t i;
   
   BUGPARAM (fonction, "%p", fonction, false)
   
-  INFO (fonction->t.size () != 0, false, (gettext ("Fonction indéfinie.\n")); )
+  INFO (common_fonction_nb_troncons (fonction) != 0, false, (gettext ("Fonction indéfinie.\n")); )
   
-  it = fonction->t.begin ();
-  while (it != fonction->t.end ())
+  for (i = 0; i < common_fonction_nb_troncons (fonction); i++)
   {
+    double *c = &fonction->coef[i * 7U];
+    double  debut = fonction->bornes[i];
+    double  fin = fonction->bornes[i + 1];
+    
     printf (gettext ("debut_troncon : %.5f\tfin_troncon : %.5f\t0 : %.20f\tx : %.20f\tx2 : %.20f\tx3 : %.20f\tx4 : %.20f\tx5 : %.20f\tx6 : %.20f\tsoit f(%.5f) = %.20f\tf(%.5f) = %.20f\n"),
-      (*it)->debut_troncon,
-      (*it)->fin_troncon,
-      (*it)->x0,
-      (*it)->x1,
-      (*it)->x2,
-      (*it)->x3,
-      (*it)->x4,
-      (*it)->x5,
-      (*it)->x6,
-      (*it)->debut_troncon,
-      (*it)->x0 +
-        (*it)->x1 * (*it)->debut_troncon +
-        (*it)->x2 * (*it)->debut_troncon * (*it)->debut_troncon +
-        (*it)->x3 * (*it)->debut_troncon * (*it)->debut_troncon *
-                    (*it)->debut_troncon +
-        (*it)->x4 * (*it)->debut_troncon * (*it)->debut_troncon *
-                    (*it)->debut_troncon * (*it)->debut_troncon +
-        (*it)->x5 * (*it)->debut_troncon * (*it)->debut_troncon *
-                    (*it)->debut_troncon * (*it)->debut_troncon *
-                    (*it)->debut_troncon +
-        (*it)->x6 * (*it)->debut_troncon * (*it)->debut_troncon *
-                    (*it)->debut_troncon * (*it)->debut_troncon *
-                    (*it)->debut_troncon * (*it)->debut_troncon,
-      (*it)->fin_troncon,
-      (*it)->x0 +
-        (*it)->x1 * (*it)->fin_troncon +
-        (*it)->x2 * (*it)->fin_troncon * (*it)->fin_troncon +
-        (*it)->x3 * (*it)->fin_troncon * (*it)->fin_troncon *
-                    (*it)->fin_troncon +
-        (*it)->x4 * (*it)->fin_troncon * (*it)->fin_troncon *
-                    (*it)->fin_troncon * (*it)->fin_troncon +
-        (*it)->x5 * (*it)->fin_troncon * (*it)->fin_troncon *
-                    (*it)->fin_troncon * (*it)->fin_troncon *
-                    (*it)->fin_troncon +
-        (*it)->x6 * (*it)->fin_troncon * (*it)->fin_troncon *
-                    (*it)->fin_troncon * (*it)->fin_troncon *
-                    (*it)->fin_troncon * (*it)->fin_troncon);
-    ++it;
+      debut,
+      fin,
+      c[0],
+      c[1],
+      c[2],
+      c[3],
+      c[4],
+      c[5],
+      c[6],
+      debut,
+      c[0] +
+        c[1] * debut +
+        c[2] * debut * debut +
+        c[3] * debut * debut * debut +
+        c[4] * debut * debut * debut * debut +
+        c[5] * debut * debut * debut * debut * debut +
+        c[6] * debut * debut * debut * debut * debut * debut,
+      fin,
+      c[0] +
+        c[1] * fin +
+        c[2] * fin * fin +
+        c[3] * fin * fin * fin +
+        c[4] * fin * fin * fin * fin +
+        c[5] * fin * fin * fin * fin * fin +
+        c[6] * fin * fin * fin * fin * fin * fin);
   }
   
   return true;
@@ -1614,6 +1230,7 @@ common_fonction_dessin (std::list <Fonction *> *fonctions,
   cairo_t         *cr;
   double           fy_min = 0., fy_max = 0., echelle;
   double          *mi, *ma;
+  double          *abscisses, *valeurs;
   Fonction        *fonction;
   
   std::list <Fonction *>::iterator it;
@@ -1646,6 +1263,14 @@ common_fonction_dessin (std::list <Fonction *> *fonctions,
              cairo_destroy (cr);
              cairo_surface_destroy (surface);
              free (mi); )
+  BUGCRIT (abscisses = (double *) malloc (sizeof (double) * width * 2U),
+           NULL,
+           (gettext ("Erreur d'allocation mémoire.\n"));
+             cairo_destroy (cr);
+             cairo_surface_destroy (surface);
+             free (mi);
+             free (ma); )
+  valeurs = abscisses + width;
   
   pixbuf = gdk_pixbuf_new (GDK_COLORSPACE_RGB, TRUE, 8, width, height);
   pixels = gdk_pixbuf_get_pixels (pixbuf);
@@ -1675,46 +1300,34 @@ common_fonction_dessin (std::list <Fonction *> *fonctions,
     }
   }
   
-  // On détermine les valeurs de la courbe pour la première fonction.
+  // On détermine les valeurs des courbes, chacune évaluée en une seule fois
+  // sur les width abscisses.
   it = fonctions->begin ();
-  fonction = *it;
-  for (x = 0; x < width; x++)
-  {
-    mi[x] = common_fonction_y (
-      fonction,
-      (*fonction->t.begin ())->debut_troncon +
-        x * ((*std::prev (fonction->t.end ()))->fin_troncon -
-                         (*fonction->t.begin ())->debut_troncon) / (width - 1),
-      0);
-    ma[x] = mi[x];
-    
-    if (fy_max < mi[x])
-    {
-      fy_max = mi[x];
-    }
-    if (fy_min > mi[x])
-    {
-      fy_min = mi[x];
-    }
-  }
-  
-  ++it;
   while (it != fonctions->end ())
   {
     fonction = *it;
     for (x = 0; x < width; x++)
     {
-      echelle = common_fonction_y (
-        fonction,
-        (*fonction->t.begin ())->debut_troncon +
-          x * ((*std::prev (fonction->t.end ()))->fin_troncon -
-                         (*fonction->t.begin ())->debut_troncon) / (width - 1),
-        0);
-      if (echelle > ma[x])
+      abscisses[x] = fonction->bornes.front () +
+                     x * (fonction->bornes.back () -
+                          fonction->bornes.front ()) / (width - 1);
+    }
+    BUG (common_fonction_y_tab (fonction, abscisses, width, 0, valeurs),
+         NULL,
+         cairo_destroy (cr);
+           cairo_surface_destroy (surface);
+           free (mi);
+           free (ma);
+           free (abscisses); )
+    
+    for (x = 0; x < width; x++)
+    {
+      echelle = valeurs[x];
+      if ((it == fonctions->begin ()) || (echelle > ma[x]))
       {
         ma[x] = echelle;
       }
-      if (echelle < mi[x])
+      if ((it == fonctions->begin ()) || (echelle < mi[x]))
       {
         mi[x] = echelle;
       }
@@ -1801,6 +1414,7 @@ common_fonction_dessin (std::list <Fonction *> *fonctions,
   cairo_surface_destroy (surface);
   free (mi);
   free (ma);
+  free (abscisses);
   
   return pixbuf;
 }
@@ -1828,7 +1442,7 @@ common_fonction_conversion_combinaisons (
   std::list <std::list <Ponderation *> *> **liste)
 {
   std::list <std::list <Ponderation *> *> *list_tmp;
-  std::list <Troncon *>::iterator          it;
+  size_t                                   i;
   
   BUGPARAM (fonction, "%p", fonction, false)
   BUGPARAM (ponderations, "%p", ponderations, false)
@@ -1836,14 +1450,11 @@ common_fonction_conversion_combinaisons (
   
   list_tmp = new std::list <std::list <Ponderation *> *> ();
   
-  it = fonction->t.begin ();
-  while (it != fonction->t.end ())
+  for (i = 0; i < common_fonction_nb_troncons (fonction); i++)
   {
-    uint16_t numero = (uint16_t) (*it)->x0;
+    uint16_t numero = (uint16_t) fonction->coef[i * 7U];
     
     list_tmp->push_back (*std::next (ponderations->begin (), numero));
-    
-    ++it;
   }
   
   *liste = list_tmp;
@@ -1875,17 +1486,18 @@ common_fonction_renvoie (Fonction                                *fonction,
   std::string retour;
   double      minimum = pow (10, -decimales);
   
+  size_t      i;
+  
   std::list <std::list <Ponderation *> *>::iterator it;
-  std::list <Troncon *>::iterator                   it2;
   
   BUGPARAM (fonction, "%p", fonction, NULL)
   BUGPARAM (index,
             "%p",
             (index == NULL) ||
-            ((index != NULL) && (fonction->t.size () == index->size ())),
+            ((index != NULL) && (common_fonction_nb_troncons (fonction) == index->size ())),
             NULL)
   
-  if (fonction->t.size () == 0)
+  if (common_fonction_nb_troncons (fonction) == 0)
   {
     retour = format ("%.*lf", decimales, 0.);
   }
@@ -1895,90 +1507,90 @@ common_fonction_renvoie (Fonction                                *fonction,
     it = index->begin ();
   }
   
-  it2 = fonction->t.begin ();
-  while (it2 != fonction->t.end ())
+  for (i = 0; i < common_fonction_nb_troncons (fonction); i++)
   {
     std::string ajout;
+    double     *c = &fonction->coef[i * 7U];
     
-    if (it2 != fonction->t.begin ())
+    if (i != 0)
     {
       retour += "\n";
     }
     
-    if (fonction->t.size () != 1)
+    if (common_fonction_nb_troncons (fonction) != 1)
     {
       retour += format (gettext ("de %.*lfm à %.*lfm : "),
                         DECIMAL_DISTANCE,
-                        (*it2)->debut_troncon,
+                        fonction->bornes[i],
                         DECIMAL_DISTANCE,
-                        (*it2)->fin_troncon);
+                        fonction->bornes[i + 1]);
     }
     
-    if (fabs ((*it2)->x0) > minimum)
+    if (fabs (c[0]) > minimum)
     {
       ajout += format ("%.*lf",
                        decimales,
-                       (*it2)->x0);
+                       c[0]);
     }
     
-    if (fabs ((*it2)->x1) > minimum)
+    if (fabs (c[1]) > minimum)
     {
       ajout += format ("%s%.*lf*x",
-                       (*it2)->x1 > 0 ?
+                       c[1] > 0 ?
                          (ajout == "" ? "" : "+") :
                          "",
                        decimales,
-                       (*it2)->x1);
+                       c[1]);
     }
     
-    if (fabs ((*it2)->x2) > minimum)
+    if (fabs (c[2]) > minimum)
     {
       ajout += format ("%s%.*lf*x²",
-                       (*it2)->x2 > 0 ?
+                       c[2] > 0 ?
                          (ajout == "" ? "" : "+") :
                          "",
                        decimales,
-                       (*it2)->x2);
+                       c[2]);
     }
     
-    if (fabs ((*it2)->x3) > minimum)
+    if (fabs (c[3]) > minimum)
     {
       ajout += format ("%s%.*lf*x³",
-                       (*it2)->x3 > 0 ?
+                       c[3] > 0 ?
                          (ajout == "" ? "" : "+") :
                          "",
                        decimales,
-                       (*it2)->x3);
+                       c[3]);
     }
     
-    if (fabs ((*it2)->x4) > minimum)
+    if (fabs (c[4]) > minimum)
     {
       ajout += format ("%s%.*lf*x⁴",
-                       (*it2)->x4 > 0 ?
+                       c[4] > 0 ?
                          (ajout == "" ? "" : "+") :
                          "",
                        decimales,
-                       (*it2)->x4);
+                       c[4]);
     }
     
-    if (fabs ((*it2)->x5) > minimum)
+    if (fabs (c[5]) > minimum)
     {
       ajout += format ("%s%.*lf*x⁵",
-                       (*it2)->x5 > 0 ?
+                       c[5] > 0 ?
                          (ajout == "" ? "" : "+") :
                          "",
                        decimales,
-                       (*it2)->x5);
+                       c[5]);
     }
     
-    if (fabs ((*it2)->x6) > minimum)
+    if (fabs (c[6]) > minimum)
     {
       ajout += format ("%s%.*lf*x⁶",
-                       (*it2)->x6 > 0 ?
+                       c[6] > 0 ?
                          (ajout == "" ? "" : "+") :
                          "",
                        decimales,
-                       (*it2)->x6);
+                       c[6]);
     }
     
     if (ajout == "")
@@ -1999,7 +1611,6 @@ common_fonction_renvoie (Fonction                                *fonction,
       
       ++it;
     }
-    ++it2;
   }
   
   return retour;
@@ -2007,7 +1618,326 @@ common_fonction_renvoie (Fonction                                *fonction,
 
 
 /**
- * \brief Renvoie deux fonctions qui enveloppent la liste des fonctions. 
+ * \brief Remplace, dans une courbe enveloppe, les tronçons compris entre debut
+ *        et fin par la courbe prépondérante.
+ * \param source : la courbe prépondérante,
+ * \param source_comb : le numéro de la combinaison (dans x0) de la courbe
+ *                      prépondérante, avec les mêmes tronçons que source,
+ * \param enveloppe : la courbe enveloppe à modifier, déjà scindée en debut et
+ *                    en fin,
+ * \param comb : le numéro de la combinaison (dans x0) de la courbe enveloppe,
+ * \param debut : début de la zone à remplacer,
+ * \param fin : fin de la zone à remplacer.
+ * \return Rien.
+ */
+static void
+common_fonction_enveloppe_remplace (Fonction *source,
+                                    Fonction *source_comb,
+                                    Fonction *enveloppe,
+                                    Fonction *comb,
+                                    double    debut,
+                                    double    fin)
+{
+  double c[7] = {0., 0., 0., 0., 0., 0., 0.};
+  double num = 0.;
+  double milieu = (debut + fin) / 2.;
+  size_t i;
+  
+  // En dehors de son domaine de définition, la courbe est nulle.
+  if (common_fonction_nb_troncons (source) != 0)
+  {
+    i = common_fonction_troncon (source, milieu);
+    if ((i < common_fonction_nb_troncons (source)) &&
+        (milieu >= source->bornes[i]))
+    {
+      std::copy (&source->coef[i * 7U], &source->coef[i * 7U] + 7, c);
+      num = source_comb->coef[i * 7U];
+    }
+  }
+  
+  i = common_fonction_troncon (enveloppe, debut);
+  while (i < common_fonction_nb_troncons (enveloppe))
+  {
+    double fin_i = enveloppe->bornes[i + 1];
+    
+    if ((fin_i > fin) && (!errrel (fin_i, fin)))
+    {
+      break;
+    }
+    if ((fin_i > debut) && (!errrel (fin_i, debut)))
+    {
+      std::copy (c, c + 7, &enveloppe->coef[i * 7U]);
+      comb->coef[i * 7U] = num;
+    }
+    
+    i++;
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Fusionne une courbe enveloppe dans une autre. La courbe enveloppe est
+ *        remplacée par la courbe source partout où
+ *        signe * (source - enveloppe) est strictement positif. En cas
+ *        d'égalité, la courbe enveloppe est conservée. Les changements de
+ *        prépondérance sont les racines exactes de la différence, calculées
+ *        tronçon par tronçon.
+ * \param source : la courbe à fusionner,
+ * \param source_comb : le numéro de la combinaison (dans x0) de source,
+ * \param signe : 1. pour l'enveloppe supérieure, -1. pour l'enveloppe
+ *                inférieure,
+ * \param enveloppe : la courbe enveloppe non vide,
+ * \param comb : le numéro de la combinaison (dans x0) de enveloppe.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - erreur d'allocation mémoire.
+ */
+static bool
+common_fonction_enveloppe_ajout (Fonction *source,
+                                 Fonction *source_comb,
+                                 double    signe,
+                                 Fonction *enveloppe,
+                                 Fonction *comb)
+{
+  Fonction  fonction_moins;
+  Fonction *fonctions[2] = {source, enveloppe};
+  double    multi[2] = {signe, -signe};
+  size_t    i;
+  
+  BUG (common_fonction_somme (&fonction_moins, fonctions, multi, 2, false),
+       false)
+  
+  // Pour chaque tronçon de signe * (source - enveloppe)
+  //   Découpage du tronçon aux racines de la différence.
+  //   Pour chaque sous-intervalle
+  //     Si la différence est positive en son milieu Alors
+  //       La courbe source remplace l'enveloppe sur le sous-intervalle.
+  //     FinSi
+  //   FinPour
+  // FinPour
+  for (i = 0; i < common_fonction_nb_troncons (&fonction_moins); i++)
+  {
+    const double *coef = &fonction_moins.coef[i * 7U];
+    double        points[8];
+    uint8_t       j, nb;
+    
+    points[0] = fonction_moins.bornes[i];
+    nb = common_polynome_racines (coef,
+                                  fonction_moins.bornes[i],
+                                  fonction_moins.bornes[i + 1],
+                                  &points[1]);
+    points[nb + 1] = fonction_moins.bornes[i + 1];
+    
+    for (j = 0; j <= nb; j++)
+    {
+      double val;
+      
+      if (points[j + 1] <= points[j])
+      {
+        continue;
+      }
+      
+      val = (double) common_polynome_y (coef,
+                                        (points[j] + points[j + 1]) / 2.L);
+      if ((val <= 0.) || (errmoy (val, ERRMOY_DIST)))
+      {
+        continue;
+      }
+      
+      BUG (common_fonction_scinde_troncon (enveloppe, points[j]), false)
+      BUG (common_fonction_scinde_troncon (comb, points[j]), false)
+      BUG (common_fonction_scinde_troncon (enveloppe, points[j + 1]), false)
+      BUG (common_fonction_scinde_troncon (comb, points[j + 1]), false)
+      
+      common_fonction_enveloppe_remplace (source,
+                                          source_comb,
+                                          enveloppe,
+                                          comb,
+                                          points[j],
+                                          points[j + 1]);
+    }
+  }
+  
+  BUG (common_fonction_compacte (enveloppe, comb), false)
+  
+  return true;
+}
+
+
+/**
+ * \struct Fonction_Niveau
+ * \brief Données d'un niveau de la réduction en arbre transmises à
+ *        #common_fonction_enveloppe_tache.
+ */
+typedef struct
+{
+  /// Les courbes enveloppes.
+  std::vector <Fonction> *enveloppes;
+  /// Les numéros de combinaison associés.
+  std::vector <Fonction> *combs;
+  /// 1. pour l'enveloppe supérieure, -1. pour l'inférieure.
+  double                  signe;
+} Fonction_Niveau;
+
+
+/**
+ * \brief Tâche de #common_math_parallele fusionnant, pour un niveau de la
+ *        réduction en arbre, la courbe enveloppe 2j+1 dans la courbe 2j.
+ *        Chaque paire n'étant modifiée que par une seule tâche, aucun verrou
+ *        n'est nécessaire.
+ * \param donnees : le niveau (Fonction_Niveau),
+ * \param j : le numéro de la paire.
+ * \return Le résultat de #common_fonction_enveloppe_ajout.
+ */
+static bool
+common_fonction_enveloppe_tache (void  *donnees,
+                                 size_t j)
+{
+  Fonction_Niveau *niveau = (Fonction_Niveau *) donnees;
+  
+  return common_fonction_enveloppe_ajout (&(*niveau->enveloppes)[2 * j + 1],
+                                          &(*niveau->combs)[2 * j + 1],
+                                          niveau->signe,
+                                          &(*niveau->enveloppes)[2 * j],
+                                          &(*niveau->combs)[2 * j]);
+}
+
+
+/**
+ * \brief Calcule une courbe enveloppe par réduction en arbre : les fonctions
+ *        sont fusionnées deux à deux (0 avec 1, 2 avec 3, ...) puis les
+ *        résultats à nouveau deux à deux jusqu'à obtenir une seule courbe.
+ *        Les fusions d'un même niveau sont indépendantes et réparties sur
+ *        au plus nb_fils fils d'exécution, chacun réalisant au moins
+ *        FUSIONS_PAR_FIL fusions : les petits niveaux, et donc les petites
+ *        listes, sont traités par le fil courant. La courbe de gauche étant
+ *        conservée en
+ *        cas d'égalité, la combinaison prépondérante est la même que celle
+ *        obtenue en ajoutant les fonctions une par une.
+ * \param fonctions : les fonctions à envelopper, la première non vide,
+ * \param signe : 1. pour l'enveloppe supérieure, -1. pour l'inférieure,
+ * \param enveloppe : la courbe enveloppe (vide),
+ * \param comb : le numéro (dans x0) de la fonction prépondérante (vide),
+ * \param nb_fils : le nombre de fils d'exécution.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - #common_fonction_enveloppe_ajout.
+ */
+static bool
+common_fonction_enveloppe_arbre (std::vector <Fonction *> *fonctions,
+                                 double                    signe,
+                                 Fonction                 *enveloppe,
+                                 Fonction                 *comb,
+                                 uint32_t                  nb_fils)
+{
+  size_t          nb = fonctions->size ();
+  size_t          j, k;
+  Fonction_Niveau niveau;
+  
+  std::vector <Fonction> enveloppes (nb);
+  std::vector <Fonction> combs (nb);
+  
+  // Les feuilles : chaque fonction avec son numéro.
+  for (k = 0; k < nb; k++)
+  {
+    Fonction *fonction = (*fonctions)[k];
+    
+    enveloppes[k] = *fonction;
+    combs[k].bornes = fonction->bornes;
+    combs[k].coef.assign (fonction->coef.size (), 0.);
+    for (j = 0; j < common_fonction_nb_troncons (fonction); j++)
+    {
+      combs[k].coef[j * 7U] = (double) k;
+    }
+  }
+  
+  niveau.enveloppes = &enveloppes;
+  niveau.combs = &combs;
+  niveau.signe = signe;
+  while (nb > 1)
+  {
+    uint32_t nb_f;
+    
+    nb_f = common_math_nb_fils (nb_fils, nb / 2 / FUSIONS_PAR_FIL);
+    if (!common_math_parallele (common_fonction_enveloppe_tache,
+                                &niveau,
+                                nb / 2,
+                                nb_f))
+    {
+      return false;
+    }
+    
+    // Les courbes fusionnées sont regroupées au début du tableau.
+    for (j = 1; 2 * j < nb; j++)
+    {
+      std::swap (enveloppes[j], enveloppes[2 * j]);
+      std::swap (combs[j], combs[2 * j]);
+    }
+    nb = (nb + 1) / 2;
+  }
+  
+  std::swap (*enveloppe, enveloppes[0]);
+  std::swap (*comb, combs[0]);
+  
+  return true;
+}
+
+
+/**
+ * \brief Calcule les deux courbes enveloppes d'une liste de fonctions.
+ * \param fonctions : liste des fonctions à envelopper,
+ * \param fonction_min : courbe enveloppe inférieure (vide),
+ * \param fonction_max : courbe enveloppe supérieure (vide),
+ * \param comb_min : le numéro de la combinaison prépondérante (vide),
+ * \param comb_max : le numéro de la combinaison prépondérante (vide),
+ * \param nb_fils : le nombre de fils d'exécution pour la réduction, 0
+ *                  pour autant que de cœurs disponibles.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - #common_fonction_enveloppe_arbre.
+ */
+static bool
+common_fonction_enveloppe_calcule (std::list <Fonction *> *fonctions,
+                                   Fonction               *fonction_min,
+                                   Fonction               *fonction_max,
+                                   Fonction               *comb_min,
+                                   Fonction               *comb_max,
+                                   uint32_t                nb_fils)
+{
+  std::vector <Fonction *> liste (fonctions->begin (), fonctions->end ());
+  
+  BUG (common_fonction_enveloppe_arbre (&liste,
+                                        1.,
+                                        fonction_max,
+                                        comb_max,
+                                        nb_fils),
+       false)
+  BUG (common_fonction_enveloppe_arbre (&liste,
+                                        -1.,
+                                        fonction_min,
+                                        comb_min,
+                                        nb_fils),
+       false,
+       fonction_max->bornes.clear ();
+         fonction_max->coef.clear ();
+         comb_max->bornes.clear ();
+         comb_max->coef.clear (); )
+  
+  return true;
+}
+
+
+/**
+ * \brief Renvoie deux fonctions qui enveloppent la liste des fonctions. Les
+ *        fonctions sont fusionnées par une réduction en arbre dont chaque
+ *        niveau est réparti sur au plus autant de fils d'exécution que de
+ *        cœurs disponibles. Les petites listes sont traitées par le fil
+ *        courant.
  * \param fonctions : liste des fonctions à envelopper,
  * \param fonction_min : courbe enveloppe inférieure (en valeur algébrique),
  * \param fonction_max : courbe enveloppe supérieure (en valeur algébrique),
@@ -2017,10 +1947,11 @@ common_fonction_renvoie (Fonction                                *fonction,
  *   Succès : true.\n
  *   Échec : false :
  *     - fonctions == NULL,
- *     - fonction_min == NULL,
- *     - fonction_max == NULL,
- *     - comb_min,
- *     - comb_max,
+ *     - fonctions est vide,
+ *     - fonction_min == NULL ou non vide,
+ *     - fonction_max == NULL ou non vide,
+ *     - comb_min == NULL ou non vide,
+ *     - comb_max == NULL ou non vide,
  *     - erreur d'allocation mémoire.
  */
 bool
@@ -2030,532 +1961,179 @@ common_fonction_renvoie_enveloppe (std::list <Fonction *> *fonctions,
                                    Fonction               *comb_min,
                                    Fonction               *comb_max)
 {
-  Fonction *fonction;
-  uint16_t  num;
-  
-  std::list <Fonction *>::iterator it;
-  
   BUGPARAM (fonctions, "%p", fonctions, false)
+  BUGPARAM (fonctions->size (), "%zu", fonctions->size () != 0, false)
   BUGPARAM (fonction_min, "%p", fonction_min, false)
-  BUGPARAM (fonction_min->t.size () == 0,
+  BUGPARAM (common_fonction_nb_troncons (fonction_min),
             "%zu",
-            fonction_min->t.size (),
+            common_fonction_nb_troncons (fonction_min) == 0,
             false)
   BUGPARAM (fonction_max, "%p", fonction_max, false)
-  BUGPARAM (fonction_max->t.size () == 0,
+  BUGPARAM (common_fonction_nb_troncons (fonction_max),
             "%zu",
-            fonction_max->t.size (),
+            common_fonction_nb_troncons (fonction_max) == 0,
             false)
   BUGPARAM (comb_min, "%p", comb_min, false)
-  BUGPARAM (comb_min->t.size () == 0,
+  BUGPARAM (common_fonction_nb_troncons (comb_min),
             "%zu",
-            comb_min->t.size (),
+            common_fonction_nb_troncons (comb_min) == 0,
             false)
   BUGPARAM (comb_max, "%p", comb_max, false)
-  BUGPARAM (comb_max->t.size () == 0,
+  BUGPARAM (common_fonction_nb_troncons (comb_max),
             "%zu",
-            comb_max->t.size (),
+            common_fonction_nb_troncons (comb_max) == 0,
             false)
   
-#define FREE_ALL { \
-  for_each (fonction_min->t.begin (), \
-            fonction_min->t.end (), \
-            std::default_delete <Troncon> ()); \
-  for_each (fonction_max->t.begin (), \
-            fonction_max->t.end (), \
-            std::default_delete <Troncon> ()); \
-  for_each (comb_min->t.begin (), \
-            comb_min->t.end (), \
-            std::default_delete <Troncon> ()); \
-  for_each (comb_max->t.begin (), \
-            comb_max->t.end (), \
-            std::default_delete <Troncon> ()); \
-}
-  
-  it = fonctions->begin ();
-  fonction = *it;
+  BUG (common_fonction_enveloppe_calcule (fonctions,
+                                          fonction_min,
+                                          fonction_max,
+                                          comb_min,
+                                          comb_max,
+                                          0),
+       false)
   
-  BUG (common_fonction_ajout_fonction (fonction_min, fonction, 1.),
-       false,
-       FREE_ALL)
-  BUG (common_fonction_ajout_fonction (fonction_max, fonction, 1.),
-       false,
-       FREE_ALL)
-  BUG (common_fonction_ajout_fonction (comb_min, fonction, 0.),
-       false,
-       FREE_ALL)
-  BUG (common_fonction_ajout_fonction (comb_max, fonction, 0.),
-       false,
-       FREE_ALL)
+  return true;
+}
+
+
+/**
+ * \struct Fonction_Listes
+ * \brief Données de #common_fonction_renvoie_enveloppes transmises à
+ *        #common_fonction_renvoie_enveloppes_tache.
+ */
+typedef struct
+{
+  /// Les listes de fonctions.
+  std::vector <std::list <Fonction *> *> *fonctions;
+  /// Les courbes enveloppes inférieures.
+  std::vector <Fonction>                 *fonction_min;
+  /// Les courbes enveloppes supérieures.
+  std::vector <Fonction>                 *fonction_max;
+  /// Les combinaisons prépondérantes inférieures.
+  std::vector <Fonction>                 *comb_min;
+  /// Les combinaisons prépondérantes supérieures.
+  std::vector <Fonction>                 *comb_max;
+} Fonction_Listes;
+
+
+/**
+ * \brief Tâche de #common_math_parallele calculant les courbes enveloppes
+ *        de la liste k, réduite en arbre par le seul fil courant.
+ * \param donnees : les listes (Fonction_Listes),
+ * \param k : le numéro de la liste.
+ * \return Le résultat de #common_fonction_enveloppe_calcule.
+ */
+static bool
+common_fonction_renvoie_enveloppes_tache (void  *donnees,
+                                          size_t k)
+{
+  Fonction_Listes *listes = (Fonction_Listes *) donnees;
+  
+  return common_fonction_enveloppe_calcule ((*listes->fonctions)[k],
+                                            &(*listes->fonction_min)[k],
+                                            &(*listes->fonction_max)[k],
+                                            &(*listes->comb_min)[k],
+                                            &(*listes->comb_max)[k],
+                                            1);
+}
+
+
+/**
+ * \brief Calcule les courbes enveloppes de plusieurs listes de fonctions
+ *        indépendantes, typiquement une liste par barre et par composante
+ *        d'effort. Les listes sont réparties sur nb_fils fils d'exécution,
+ *        chacune étant réduite en arbre par un seul fil.
+ * \param fonctions : les listes de fonctions à envelopper, non vides,
+ * \param fonction_min : fonctions->size () courbes enveloppes inférieures,
+ *                       vides,
+ * \param fonction_max : fonctions->size () courbes enveloppes supérieures,
+ *                       vides,
+ * \param comb_min : fonctions->size () numéros de combinaison prépondérante
+ *                   (dans x0), vides,
+ * \param comb_max : fonctions->size () numéros de combinaison prépondérante
+ *                   (dans x0), vides,
+ * \param nb_fils : le nombre de fils d'exécution, 0 pour autant que de cœurs
+ *                  disponibles.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - fonctions == NULL,
+ *     - une liste de fonctions est NULL ou vide,
+ *     - fonction_min == NULL ou de taille différente de fonctions,
+ *     - fonction_max == NULL ou de taille différente de fonctions,
+ *     - comb_min == NULL ou de taille différente de fonctions,
+ *     - comb_max == NULL ou de taille différente de fonctions,
+ *     - une courbe de sortie n'est pas vide,
+ *     - erreur d'allocation mémoire.
+ */
+bool
+common_fonction_renvoie_enveloppes (
+  std::vector <std::list <Fonction *> *> *fonctions,
+  std::vector <Fonction>                 *fonction_min,
+  std::vector <Fonction>                 *fonction_max,
+  std::vector <Fonction>                 *comb_min,
+  std::vector <Fonction>                 *comb_max,
+  uint32_t                                nb_fils)
+{
+  Fonction_Listes listes;
+  size_t          k;
   
-#undef FREE_ALL
-  ++it;
-  num = 1;
-  while (it != fonctions->end ())
+  BUGPARAM (fonctions, "%p", fonctions, false)
+  BUGPARAM (fonction_min, "%p", fonction_min, false)
+  BUGPARAM (fonction_min->size (),
+            "%zu",
+            fonction_min->size () == fonctions->size (),
+            false)
+  BUGPARAM (fonction_max, "%p", fonction_max, false)
+  BUGPARAM (fonction_max->size (),
+            "%zu",
+            fonction_max->size () == fonctions->size (),
+            false)
+  BUGPARAM (comb_min, "%p", comb_min, false)
+  BUGPARAM (comb_min->size (),
+            "%zu",
+            comb_min->size () == fonctions->size (),
+            false)
+  BUGPARAM (comb_max, "%p", comb_max, false)
+  BUGPARAM (comb_max->size (),
+            "%zu",
+            comb_max->size () == fonctions->size (),
+            false)
+  for (k = 0; k < fonctions->size (); k++)
   {
-    uint8_t  j;
-    double   val[10], x[10];
-    Fonction fonction_moins, fonction_bis;
-    double   x_base, tmp;
-    
-    std::list <Troncon *>::iterator it_m, it_b;
-    std::list <Troncon *>::iterator it_k, it_c;
-    
-    fonction = *it;
-    
-#define FREE_ALL { \
-  for_each (fonction_min->t.begin (), \
-            fonction_min->t.end (), \
-            std::default_delete <Troncon> ()); \
-  for_each (fonction_max->t.begin (), \
-            fonction_max->t.end (), \
-            std::default_delete <Troncon> ()); \
-  for_each (comb_min->t.begin (), \
-            comb_min->t.end (), \
-            std::default_delete <Troncon> ()); \
-  for_each (comb_max->t.begin (), \
-            comb_max->t.end (), \
-            std::default_delete <Troncon> ()); \
-  for_each (fonction_bis.t.begin (), \
-            fonction_bis.t.end (), \
-            std::default_delete <Troncon> ()); \
-  for_each (fonction_moins.t.begin (), \
-            fonction_moins.t.end (), \
-            std::default_delete <Troncon> ()); \
-}
-    BUG (common_fonction_ajout_fonction (&fonction_moins, fonction, 1.),
-         false,
-         FREE_ALL)
-    BUG (common_fonction_ajout_fonction (&fonction_moins, fonction_max, -1.),
-         false,
-         FREE_ALL)
-    BUG (common_fonction_ajout_fonction (&fonction_bis, fonction, 1.),
-         false,
-         FREE_ALL)
-    
-    it_m = fonction_moins.t.begin ();
-    it_b = fonction_bis.t.begin ();
-    while (it_m != fonction_moins.t.end ())
-    {
-      int8_t modif;
-      double zero1, zero2;
-      
-      x_base = (*it_m)->debut_troncon;
-      BUG (common_fonction_scinde_troncon (&fonction_bis, x_base),
-           false,
-           FREE_ALL)
-      BUG (common_fonction_scinde_troncon (fonction_max, x_base),
-           false,
-           FREE_ALL)
-      BUG (common_fonction_scinde_troncon (comb_max, x_base),
-           false,
-           FREE_ALL)
-      BUG (common_fonction_scinde_troncon (&fonction_moins, x_base),
-           false,
-           FREE_ALL)
-      
-      x[0] = x_base;
-      val[0] = common_fonction_y (&fonction_moins, x[0], 1);
-      for (j = 1; j < 9; j++)
-      {
-        x[j] = (*it_m)->debut_troncon +
-               j * ((*it_m)->fin_troncon -
-                    (*it_m)->debut_troncon) / 9.;
-        val[j] = common_fonction_y (&fonction_moins, x[j], 0);
-      }
-      x[9] = (*it_m)->fin_troncon;
-      val[9] = common_fonction_y (&fonction_moins, x[9], -1);
-      
-      // On vérifie en 10 points si la fonction est toujours inférieure à
-      // fonction_max. modif = 0 si la fonction en cours d'étude est inférieure
-      // à fonction_max. Elle vaut 1 si elle est supérieure.
-      if (errmoy (val[0], ERRMOY_DIST))
-      {
-        modif = -1;
-      }
-      else if (val[0] < 0.)
-      {
-        modif = 0;
-      }
-      else
-      {
-        modif = 1;
-      }
-      for (j = 1; j < 10; j++)
-      {
-        if ((val[j] > 0.) &&
-            (!errmoy (val[j], ERRMOY_DIST)) &&
-            (modif == -1))
-        {
-          modif = 1;
-        }
-        else if ((val[j] > 0.) &&
-                 (!errmoy (val[j], ERRMOY_DIST)) &&
-                 (modif == 0))
-        {
-          BUG (common_fonction_cherche_zero (&fonction_moins,
-                                             x[j - 1],
-                                             x[j],
-                                             &zero1,
-                                             &zero2),
-               false,
-               FREE_ALL)
-          BUGCRIT ((!std::isnan (zero1)) && (std::isnan (zero2)),
-                   false,
-                   (gettext ("Zéro impossible à trouver.\n"));
-                     FREE_ALL)
-          BUG (common_fonction_scinde_troncon (fonction_max, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (comb_max, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (&fonction_bis, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (&fonction_moins, zero1),
-               false,
-               FREE_ALL)
-          x_base = zero1;
-          modif = 1;
-        }
-        else if ((val[j] < 0.) &&
-                 (!errmoy (val[j], ERRMOY_DIST)) &&
-                (modif == -1))
-        {
-          modif = 0;
-        }
-        else if ((val[j] < 0.) &&
-                 (!errmoy (val[j], ERRMOY_DIST)) &&
-                 (modif == 1))
-        {
-          BUG (common_fonction_cherche_zero (&fonction_moins,
-                                             x[j - 1],
-                                             x[j],
-                                             &zero1,
-                                             &zero2),
-               false,
-               FREE_ALL)
-          BUGCRIT ((!std::isnan (zero1)) && (std::isnan (zero2)),
-                   false,
-                   (gettext ("Zéro impossible à trouver.\n"));
-                     FREE_ALL)
-          BUG (common_fonction_scinde_troncon (fonction_max, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (comb_max, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (&fonction_bis, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (&fonction_moins, zero1),
-               false,
-               FREE_ALL)
-          
-          it_k = fonction_max->t.begin ();
-          it_c = comb_max->t.begin ();
-          while (it_k != fonction_max->t.end ())
-          {
-            if ((*it_k)->fin_troncon > zero1)
-            {
-              break;
-            }
-            if ((*it_k)->fin_troncon > x_base)
-            {
-              (*it_k)->x0 = (*it_b)->x0;
-              (*it_k)->x1 = (*it_b)->x1;
-              (*it_k)->x2 = (*it_b)->x2;
-              (*it_k)->x3 = (*it_b)->x3;
-              (*it_k)->x4 = (*it_b)->x4;
-              (*it_k)->x5 = (*it_b)->x5;
-              (*it_k)->x6 = (*it_b)->x6;
-              (*it_c)->x0 = num;
-            }
-            
-            ++it_k;
-            ++it_c;
-          }
-          x_base = zero1;
-          modif = 0;
-          break;
-        }
-      }
-      if (modif == 1)
-      {
-        tmp = (*it_m)->fin_troncon;
-        BUG (common_fonction_scinde_troncon (fonction_max, tmp),
-             false,
-             FREE_ALL)
-        BUG (common_fonction_scinde_troncon (comb_max, tmp),
-             false,
-             FREE_ALL)
-        BUG (common_fonction_scinde_troncon (&fonction_bis, tmp),
-             false,
-             FREE_ALL)
-        BUG (common_fonction_scinde_troncon (&fonction_moins, tmp),
-             false,
-             FREE_ALL)
-        
-        it_k = fonction_max->t.begin ();
-        it_c = comb_max->t.begin ();
-        while (it_k != fonction_max->t.end ())
-        {
-          if ((*it_k)->fin_troncon > tmp)
-          {
-            break;
-          }
-          if ((*it_k)->fin_troncon > x_base)
-          {
-            (*it_k)->x0 = (*it_b)->x0;
-            (*it_k)->x1 = (*it_b)->x1;
-            (*it_k)->x2 = (*it_b)->x2;
-            (*it_k)->x3 = (*it_b)->x3;
-            (*it_k)->x4 = (*it_b)->x4;
-            (*it_k)->x5 = (*it_b)->x5;
-            (*it_k)->x6 = (*it_b)->x6;
-            (*it_c)->x0 = num;
-          }
-          
-          ++it_k;
-          ++it_c;
-        }
-      }
-      
-      ++it_m;
-      ++it_b;
-    }
-    BUG (common_fonction_compacte (fonction_max, comb_max), false, FREE_ALL)
-    for_each (fonction_bis.t.begin (), \
-              fonction_bis.t.end (), \
-              std::default_delete <Troncon> ()); \
-    for_each (fonction_moins.t.begin (), \
-              fonction_moins.t.end (), \
-              std::default_delete <Troncon> ()); \
-    fonction_moins.t.clear ();
-    fonction_bis.t.clear ();
-    
-    // On passe à la courbe enveloppe inférieure. On utilise exactement le même
-    // code que ci-dessus sauf qu'on fait -fonction+fonction_min à la place de
-    // fonction-fonction_max. On remplace les fonction_max par fonction_min.
-    // C'est tout !
-    BUG (common_fonction_ajout_fonction (&fonction_moins,
-                                         fonction,
-                                         -1.),
-         false,
-         FREE_ALL)
-    BUG (common_fonction_ajout_fonction (&fonction_moins,
-                                         fonction_min,
-                                         1.),
-         false,
-         FREE_ALL)
-    BUG (common_fonction_ajout_fonction (&fonction_bis, fonction, 1.),
-         false,
-         FREE_ALL)
-    
-    it_m = fonction_moins.t.begin ();
-    it_b = fonction_bis.t.begin ();
-    while (it_m != fonction_moins.t.end ())
-    {
-      int8_t modif;
-      double zero1, zero2;
-      
-      x_base = (*it_m)->debut_troncon;
-      BUG (common_fonction_scinde_troncon (&fonction_bis, x_base),
-           false,
-           FREE_ALL)
-      BUG (common_fonction_scinde_troncon (fonction_min, x_base),
-           false,
-           FREE_ALL)
-      BUG (common_fonction_scinde_troncon (comb_min, x_base), false, FREE_ALL)
-      BUG (common_fonction_scinde_troncon (&fonction_moins, x_base),
-           false,
-           FREE_ALL)
-      
-      x[0] = x_base;
-      val[0] = common_fonction_y (&fonction_moins, x[0], 1);
-      for (j = 1; j < 9; j++)
-      {
-        x[j] = (*it_m)->debut_troncon +
-               j * ((*it_m)->fin_troncon -
-                    (*it_m)->debut_troncon) / 9.;
-        val[j] = common_fonction_y (&fonction_moins, x[j], 0);
-      }
-      x[9] = (*it_m)->fin_troncon;
-      val[9] = common_fonction_y (&fonction_moins, x[9], -1);
-      
-      // On vérifie en 10 points si la fonction est toujours inférieure à
-      // fonction_min. modif = 0 si la fonction en cours d'étude est inférieure
-      // à fonction_min. Elle vaut 1 si elle est supérieure.
-      // modif vaut temporairement -1 si la valeur de y est proche de 0.
-      if (errmoy (val[0], ERRMOY_DIST))
-      {
-        modif = -1;
-      }
-      else if (val[0] < 0.)
-      {
-        modif = 0;
-      }
-      else
-      {
-        modif = 1;
-      }
-      for (j = 1; j < 10; j++)
-      {
-        if ((val[j] > 0.) &&
-            (!errmoy (val[j], ERRMOY_DIST)) &&
-            (modif == -1))
-        {
-          modif = 1;
-        }
-        else if ((val[j] > 0.) &&
-                 (!errmoy (val[j], ERRMOY_DIST)) &&
-                 (modif == 0))
-        {
-          BUG (common_fonction_cherche_zero (&fonction_moins,
-                                             x[j - 1],
-                                             x[j],
-                                             &zero1,
-                                             &zero2),
-               false,
-               FREE_ALL)
-          BUGCRIT ((!std::isnan (zero1)) && (std::isnan (zero2)),
-                   false,
-                   (gettext ("Zéro impossible à trouver.\n"));
-                     FREE_ALL)
-          BUG (common_fonction_scinde_troncon (fonction_min, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (comb_min, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (&fonction_bis, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (&fonction_moins, zero1),
-               false,
-               FREE_ALL)
-          x_base = zero1;
-          modif = 1;
-        }
-        else if ((val[j] < 0.) &&
-                 (!errmoy (val[j], ERRMOY_DIST)) &&
-                 (modif == -1))
-        {
-          modif = 0;
-        }
-        else if ((val[j] < 0.) &&
-                 (!errmoy (val[j], ERRMOY_DIST)) &&
-                 (modif == 1))
-        {
-          BUG (common_fonction_cherche_zero (&fonction_moins,
-                                             x[j - 1],
-                                             x[j],
-                                             &zero1,
-                                             &zero2),
-               false,
-               FREE_ALL)
-          BUGCRIT ((!std::isnan (zero1)) && (std::isnan (zero2)),
-                   false,
-                   (gettext ("Zéro impossible à trouver.\n"));
-                     FREE_ALL)
-          BUG (common_fonction_scinde_troncon (fonction_min, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (comb_min, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (&fonction_bis, zero1),
-               false,
-               FREE_ALL)
-          BUG (common_fonction_scinde_troncon (&fonction_moins, zero1),
-               false,
-               FREE_ALL)
-          
-          it_k = fonction_min->t.begin ();
-          it_c = comb_min->t.begin ();
-          while (it_k != fonction_min->t.end ())
-          {
-            if ((*it_k)->fin_troncon > zero1)
-            {
-              break;
-            }
-            if ((*it_k)->fin_troncon > x_base)
-            {
-              (*it_k)->x0 = (*it_b)->x0;
-              (*it_k)->x1 = (*it_b)->x1;
-              (*it_k)->x2 = (*it_b)->x2;
-              (*it_k)->x3 = (*it_b)->x3;
-              (*it_k)->x4 = (*it_b)->x4;
-              (*it_k)->x5 = (*it_b)->x5;
-              (*it_k)->x6 = (*it_b)->x6;
-              (*it_c)->x0 = num;
-            }
-            
-            ++it_k;
-            ++it_c;
-          }
-          x_base = zero1;
-          modif = 0;
-          break;
-        }
-      }
-      if (modif == 1)
-      {
-        tmp = (*it_m)->fin_troncon;
-        BUG (common_fonction_scinde_troncon (fonction_min, tmp),
-             false,
-             FREE_ALL)
-        BUG (common_fonction_scinde_troncon (comb_min, tmp), false, FREE_ALL)
-        BUG (common_fonction_scinde_troncon (&fonction_bis, tmp),
-             false,
-             FREE_ALL)
-        BUG (common_fonction_scinde_troncon (&fonction_moins, tmp),
-             false,
-             FREE_ALL)
-        
-        
-        it_k = fonction_min->t.begin ();
-        it_c = comb_min->t.begin ();
-        while (it_k != fonction_min->t.end ())
-        {
-          if ((*it_k)->fin_troncon > tmp)
-          {
-            break;
-          }
-          if ((*it_k)->fin_troncon > x_base)
-          {
-            (*it_k)->x0 = (*it_b)->x0;
-            (*it_k)->x1 = (*it_b)->x1;
-            (*it_k)->x2 = (*it_b)->x2;
-            (*it_k)->x3 = (*it_b)->x3;
-            (*it_k)->x4 = (*it_b)->x4;
-            (*it_k)->x5 = (*it_b)->x5;
-            (*it_k)->x6 = (*it_b)->x6;
-            (*it_c)->x0 = num;
-          }
-        }
-      }
-      
-      ++it_m;
-      ++it_b;
-    }
-    BUG (common_fonction_compacte (fonction_min, comb_min), false, FREE_ALL)
-    
-    for_each (fonction_bis.t.begin (), \
-              fonction_bis.t.end (), \
-              std::default_delete <Troncon> ()); \
-    for_each (fonction_moins.t.begin (), \
-              fonction_moins.t.end (), \
-              std::default_delete <Troncon> ()); \
-    fonction_moins.t.clear ();
-    fonction_bis.t.clear ();
-    
-    ++it;
-    num++;
+    BUGPARAM ((*fonctions)[k], "%p", (*fonctions)[k], false)
+    BUGPARAM ((*fonctions)[k]->size (),
+              "%zu",
+              (*fonctions)[k]->size () != 0,
+              false)
+    BUGPARAM (common_fonction_nb_troncons (&(*fonction_min)[k]),
+              "%zu",
+              common_fonction_nb_troncons (&(*fonction_min)[k]) == 0,
+              false)
+    BUGPARAM (common_fonction_nb_troncons (&(*fonction_max)[k]),
+              "%zu",
+              common_fonction_nb_troncons (&(*fonction_max)[k]) == 0,
+              false)
+    BUGPARAM (common_fonction_nb_troncons (&(*comb_min)[k]),
+              "%zu",
+              common_fonction_nb_troncons (&(*comb_min)[k]) == 0,
+              false)
+    BUGPARAM (common_fonction_nb_troncons (&(*comb_max)[k]),
+              "%zu",
+              common_fonction_nb_troncons (&(*comb_max)[k]) == 0,
+              false)
   }
   
-  return true;
+  listes.fonctions = fonctions;
+  listes.fonction_min = fonction_min;
+  listes.fonction_max = fonction_max;
+  listes.comb_min = comb_min;
+  listes.comb_max = comb_max;
+  
+  return common_math_parallele (common_fonction_renvoie_enveloppes_tache,
+                                &listes,
+                                fonctions->size (),
+                                nb_fils);
 }
 
 
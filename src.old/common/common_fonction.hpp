@@ -44,11 +44,30 @@ bool   common_fonction_ajout_fonction       (Fonction *fonction,
                                              Fonction *fonction_a_ajouter,
                                              double    multi)
                                        __attribute__((__warn_unused_result__));
+bool   common_fonction_somme                (Fonction      *fonction,
+                                             Fonction     **fonctions,
+                                             const double  *multi,
+                                             uint32_t       nb,
+                                             bool           compacte)
+                                       __attribute__((__warn_unused_result__));
 
 double common_fonction_y                    (Fonction *fonction,
                                              double    x_,
                                              int8_t    position)
                                        __attribute__((__warn_unused_result__));
+bool   common_fonction_y_tab                (Fonction     *fonction,
+                                             const double *x,
+                                             uint32_t      nb,
+                                             int8_t        position,
+                                             double       *y)
+                                       __attribute__((__warn_unused_result__));
+
+bool   common_fonction_extremums            (Fonction *fonction,
+                                             double   *x_min,
+                                             double   *y_min,
+                                             double   *x_max,
+                                             double   *y_max)
+                                       __attribute__((__warn_unused_result__));
 
 bool   common_fonction_affiche              (Fonction *fonction)
                                        __attribute__((__warn_unused_result__));
@@ -86,6 +105,15 @@ bool  common_fonction_renvoie_enveloppe       (
         Fonction               *comb_max)
                                        __attribute__((__warn_unused_result__));
 
+bool  common_fonction_renvoie_enveloppes      (
+        std::vector <std::list <Fonction *> *> *fonctions,
+        std::vector <Fonction>                 *fonction_min,
+        std::vector <Fonction>                 *fonction_max,
+        std::vector <Fonction>                 *comb_min,
+        std::vector <Fonction>                 *comb_max,
+        uint32_t                                nb_fils)
+                                       __attribute__((__warn_unused_result__));
+
 #endif
 
 /* vim:set shiftwidth=2 softtabstop=2 expandtab: */
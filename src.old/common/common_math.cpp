@@ -21,6 +21,9 @@
 #include <locale>
 #include <cmath>
 #include <cfloat>
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 #include "common_math.hpp"
 #include "common_projet.hpp"
@@ -173,6 +176,364 @@ common_math_arrondi_sparse (cholmod_sparse *sparse)
 }
 
 
+/**
+ * \brief Applique à un vecteur de 12 valeurs (déplacements ou efforts des deux
+ *        noeuds d'une barre) la matrice de rotation diagonale par blocs
+ *        composée de 4 fois la matrice rot : \end{verbatim}\begin{displaymath}
+ *        \{ res \} = [R] \cdot \{ v \} \texttt{ ou }
+ *        \{ res \} = [R]^T \cdot \{ v \}\end{displaymath}\begin{verbatim}
+ * \param rot : matrice de rotation 3×3 stockée ligne par ligne,
+ * \param transposee : true pour appliquer la transposée de la rotation,
+ * \param v : le vecteur à tourner,
+ * \param res : le résultat. Doit être différent de v.
+ * \return Rien.
+ */
+void
+common_math_rotation_vecteur (const double rot[9],
+                              bool         transposee,
+                              const double v[12],
+                              double       res[12])
+{
+  uint8_t b, i;
+  
+  for (b = 0; b < 12; b += 3)
+  {
+    for (i = 0; i < 3; i++)
+    {
+      if (transposee)
+      {
+        res[b + i] = rot[0 * 3 + i] * v[b + 0] +
+                     rot[1 * 3 + i] * v[b + 1] +
+                     rot[2 * 3 + i] * v[b + 2];
+      }
+      else
+      {
+        res[b + i] = rot[i * 3 + 0] * v[b + 0] +
+                     rot[i * 3 + 1] * v[b + 1] +
+                     rot[i * 3 + 2] * v[b + 2];
+      }
+    }
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Calcule la matrice de rigidité élémentaire dans le repère global à
+ *        partir de la matrice locale : \end{verbatim}\begin{displaymath}
+ *        [K]_{global} = [R] \cdot [K]_{local} \cdot [R]^T\end{displaymath}
+ *        \begin{verbatim}La matrice [R] étant diagonale par blocs de 3×3,
+ *        chacun des 16 blocs de [K] est traité indépendamment :
+ *        \end{verbatim}\begin{displaymath}
+ *        [K_{IJ}]_{global} = [rot] \cdot [K_{IJ}]_{local} \cdot [rot]^T
+ *        \end{displaymath}\begin{verbatim}
+ * \param rot : matrice de rotation 3×3 stockée ligne par ligne,
+ * \param k_loc : matrice 12×12 locale stockée colonne par colonne,
+ * \param k_glob : matrice 12×12 globale stockée colonne par colonne.
+ * \return Rien.
+ */
+void
+common_math_rotation_rigidite (const double rot[9],
+                               const double k_loc[144],
+                               double       k_glob[144])
+{
+  uint8_t bi, bj, r, c;
+  
+  for (bj = 0; bj < 12; bj += 3)
+  {
+    for (bi = 0; bi < 12; bi += 3)
+    {
+      double t[3][3];
+      
+      // t = rot · K_IJ
+      for (c = 0; c < 3; c++)
+      {
+        const double *col = &k_loc[(bj + c) * 12 + bi];
+        
+        for (r = 0; r < 3; r++)
+        {
+          t[r][c] = rot[r * 3 + 0] * col[0] +
+                    rot[r * 3 + 1] * col[1] +
+                    rot[r * 3 + 2] * col[2];
+        }
+      }
+      // K_IJ global = t · rot^T
+      for (c = 0; c < 3; c++)
+      {
+        for (r = 0; r < 3; r++)
+        {
+          k_glob[(bj + c) * 12 + bi + r] = t[r][0] * rot[c * 3 + 0] +
+                                           t[r][1] * rot[c * 3 + 1] +
+                                           t[r][2] * rot[c * 3 + 2];
+        }
+      }
+    }
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Produit d'une matrice 12×12 par un vecteur de 12 valeurs.
+ * \param k : matrice stockée colonne par colonne,
+ * \param v : le vecteur,
+ * \param res : le résultat. Doit être différent de v.
+ * \return Rien.
+ */
+void
+common_math_produit_12 (const double k[144],
+                        const double v[12],
+                        double       res[12])
+{
+  uint8_t i, j;
+  
+  for (i = 0; i < 12; i++)
+  {
+    res[i] = 0.;
+  }
+  for (j = 0; j < 12; j++)
+  {
+    for (i = 0; i < 12; i++)
+    {
+      res[i] += k[j * 12 + i] * v[j];
+    }
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Décompose une matrice symétrique n × n en valeurs et vecteurs
+ *        propres par la méthode de Jacobi cyclique :\end{verbatim}
+ *        \begin{displaymath}
+ *        [A] = [V] \cdot [\Lambda] \cdot [V]^T\end{displaymath}
+ *        \begin{verbatim}
+ *        Destinée aux petites matrices (quelques dizaines de lignes).
+ * \param a : la matrice stockée colonne par colonne. Elle est détruite,
+ * \param n : la dimension de la matrice,
+ * \param valeurs : les n valeurs propres,
+ * \param vecteurs : les n vecteurs propres (n × n valeurs), stockés colonne
+ *                   par colonne.
+ * \return Rien.
+ */
+void
+common_math_valeurs_propres (double  *a,
+                             uint32_t n,
+                             double  *valeurs,
+                             double  *vecteurs)
+{
+  uint32_t i, j, k;
+  uint8_t  balayage;
+  
+  for (j = 0; j < n; j++)
+  {
+    for (i = 0; i < n; i++)
+    {
+      vecteurs[j * n + i] = i == j ? 1. : 0.;
+    }
+  }
+  
+  for (balayage = 0; balayage < 50; balayage++)
+  {
+    double hors_diag = 0., diag = 0.;
+    
+    for (j = 0; j < n; j++)
+    {
+      diag += a[j * n + j] * a[j * n + j];
+      for (i = 0; i < j; i++)
+      {
+        hors_diag += a[j * n + i] * a[j * n + i];
+      }
+    }
+    if (hors_diag <= DBL_EPSILON * DBL_EPSILON * diag)
+    {
+      break;
+    }
+    
+    // Pour chaque terme (i, j) hors diagonale
+    //   Rotation de Givens annulant a(i, j) :\end{verbatim}
+    //   \begin{displaymath}
+    //   \theta = \frac{a_{jj} - a_{ii}}{2 \cdot a_{ij}} \texttt{, }
+    //   t = \frac{signe(\theta)}{\left| \theta \right| +
+    //       \sqrt{\theta^2 + 1}}\end{displaymath}\begin{verbatim}
+    for (j = 1; j < n; j++)
+    {
+      for (i = 0; i < j; i++)
+      {
+        double theta, t, c, s;
+        
+        if (a[j * n + i] == 0.)
+        {
+          continue;
+        }
+        
+        theta = (a[j * n + j] - a[i * n + i]) / (2. * a[j * n + i]);
+        t = 1. / (fabs (theta) + sqrt (theta * theta + 1.));
+        if (theta < 0.)
+        {
+          t = -t;
+        }
+        c = 1. / sqrt (t * t + 1.);
+        s = t * c;
+        
+        for (k = 0; k < n; k++)
+        {
+          double aki = a[i * n + k], akj = a[j * n + k];
+          
+          a[i * n + k] = c * aki - s * akj;
+          a[j * n + k] = s * aki + c * akj;
+        }
+        for (k = 0; k < n; k++)
+        {
+          double aik = a[k * n + i], ajk = a[k * n + j];
+          
+          a[k * n + i] = c * aik - s * ajk;
+          a[k * n + j] = s * aik + c * ajk;
+        }
+        for (k = 0; k < n; k++)
+        {
+          double vki = vecteurs[i * n + k], vkj = vecteurs[j * n + k];
+          
+          vecteurs[i * n + k] = c * vki - s * vkj;
+          vecteurs[j * n + k] = s * vki + c * vkj;
+        }
+      }
+    }
+    // FinPour
+  }
+  
+  for (i = 0; i < n; i++)
+  {
+    valeurs[i] = a[i * n + i];
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Renvoie le nombre de fils d'exécution utilisés par
+ *        #common_math_parallele pour nb tâches : nb_fils (autant que de
+ *        cœurs si nul), sans dépasser le nombre de tâches, et au moins 1.
+ * \param nb_fils : le nombre maximal de fils d'exécution,
+ * \param nb : le nombre de tâches.
+ * \return Le nombre de fils d'exécution.
+ */
+uint32_t
+common_math_nb_fils (uint32_t nb_fils,
+                     size_t   nb)
+{
+  if (nb_fils == 0)
+  {
+    nb_fils = std::thread::hardware_concurrency ();
+  }
+  
+  return (uint32_t) std::max ((size_t) 1, std::min ((size_t) nb_fils, nb));
+}
+
+
+/**
+ * \brief Fil d'exécution de #common_math_parallele traitant les tâches
+ *        k = fil, fil + nb_fils, ...
+ * \param tache : la fonction réalisant une tâche,
+ * \param donnees : les données transmises à tache,
+ * \param nb : le nombre de tâches,
+ * \param fil : le numéro du fil,
+ * \param nb_fils : le nombre de fils,
+ * \param ok : vaut false si une tâche a échoué.
+ * \return Rien.
+ */
+static void
+common_math_parallele_fil (bool   (*tache) (void  *donnees,
+                                            size_t k),
+                           void    *donnees,
+                           size_t   nb,
+                           uint32_t fil,
+                           uint32_t nb_fils,
+                           bool    *ok)
+{
+  size_t k;
+  
+  *ok = false;
+  
+  for (k = fil; k < nb; k += nb_fils)
+  {
+    if (!tache (donnees, k))
+    {
+      return;
+    }
+  }
+  
+  *ok = true;
+  
+  return;
+}
+
+
+/**
+ * \brief Réalise les tâches tache (donnees, k) pour k = 0 à nb - 1 en les
+ *        répartissant sur au plus nb_fils fils d'exécution (autant que de
+ *        cœurs si nul, jamais plus que de tâches). Le fil k % nb_fils traite
+ *        la tâche k, le premier fil étant le fil courant : aucun fil n'est
+ *        créé si nb_fils vaut 1 ou s'il n'y a qu'une tâche. Les tâches
+ *        doivent être indépendantes.
+ * \param tache : la fonction réalisant une tâche, renvoie false en cas
+ *                d'erreur,
+ * \param donnees : les données transmises à tache,
+ * \param nb : le nombre de tâches,
+ * \param nb_fils : le nombre maximal de fils d'exécution.
+ * \return
+ *   Succès : true.\n
+ *   Échec : false :
+ *     - une des tâches a échoué.
+ */
+bool
+common_math_parallele (bool   (*tache) (void  *donnees,
+                                        size_t k),
+                       void    *donnees,
+                       size_t   nb,
+                       uint32_t nb_fils)
+{
+  uint32_t i;
+  bool    *ok_fils, retour = true;
+  
+  std::vector <std::thread> fils;
+  
+  if (nb == 0)
+  {
+    return true;
+  }
+  nb_fils = common_math_nb_fils (nb_fils, nb);
+  
+  ok_fils = new bool [nb_fils];
+  for (i = 1; i < nb_fils; i++)
+  {
+    fils.push_back (std::thread (common_math_parallele_fil,
+                                 tache,
+                                 donnees,
+                                 nb,
+                                 i,
+                                 nb_fils,
+                                 &ok_fils[i]));
+  }
+  common_math_parallele_fil (tache, donnees, nb, 0, nb_fils, &ok_fils[0]);
+  for (i = 0; i < fils.size (); i++)
+  {
+    fils[i].join ();
+  }
+  for (i = 0; i < nb_fils; i++)
+  {
+    retour = retour && ok_fils[i];
+  }
+  delete [] ok_fils;
+  
+  return retour;
+}
+
+
 /**
  * \brief Converti un nombre double en std::string.
  *        Dest doit déjà être alloué. 30 caractères devrait être suffisant.
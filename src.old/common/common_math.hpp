@@ -54,6 +54,29 @@ bool errrel (double calc,
 double common_math_arrondi_nombre   (double           nombre);
 void   common_math_arrondi_triplet  (cholmod_triplet *triplet);
 void   common_math_arrondi_sparse   (cholmod_sparse  *sparse);
+void   common_math_rotation_vecteur  (const double rot[9],
+                                      bool         transposee,
+                                      const double v[12],
+                                      double       res[12]);
+void   common_math_rotation_rigidite (const double rot[9],
+                                      const double k_loc[144],
+                                      double       k_glob[144]);
+void   common_math_produit_12        (const double k[144],
+                                      const double v[12],
+                                      double       res[12]);
+void   common_math_valeurs_propres   (double          *a,
+                                      uint32_t         n,
+                                      double          *valeurs,
+                                      double          *vecteurs);
+uint32_t common_math_nb_fils         (uint32_t         nb_fils,
+                                      size_t           nb)
+                                       __attribute__((__warn_unused_result__));
+bool   common_math_parallele         (bool           (*tache) (void  *donnees,
+                                                               size_t k),
+                                      void            *donnees,
+                                      size_t           nb,
+                                      uint32_t         nb_fils)
+                                       __attribute__((__warn_unused_result__));
 void   common_math_double_to_string (double           nombre,
                                      std::string     *dest,
                                      int8_t           decimales);
@@ -0,0 +1,544 @@
+/*
+ * 2lgc_code : calcul de résistance des matériaux selon les normes Eurocodes
+ * Copyright (C) 2011
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include <locale>
+#include <cmath>
+#include <algorithm>
+
+#include "common_projet.hpp"
+#include "common_erreurs.hpp"
+#include "common_math.hpp"
+#include "common_polynome.hpp"
+
+/**
+ * \file common_polynome.cpp
+ * \brief Analyse des polynômes de degré 6 au plus décrivant chaque tronçon
+ *        des fonctions. Un polynôme est défini par ses 7 coefficients :
+ *        \f$p(x) = \sum_{k=0}^{6} coef[k] \cdot x^k\f$.\n
+ *        Les racines réelles sont calculées sur l'intervalle [debut, fin]
+ *        ramené à [-1, 1] par le changement de variable
+ *        \f$x = m + h \cdot t\f$ avec \f$m = (debut + fin) / 2\f$ et
+ *        \f$h = (fin - debut) / 2\f$. Les coefficients deviennent ainsi du
+ *        même ordre de grandeur, ce qui permet de déterminer le degré réel du
+ *        polynôme et de conditionner correctement la suite de Sturm.\n
+ *        Jusqu'au degré 3, les racines sont calculées par les formules
+ *        exactes. Au-delà, elles sont isolées puis affinées par dichotomie à
+ *        l'aide d'une suite de Sturm.
+ */
+
+/// Un coefficient est négligé si, une fois le polynôme ramené sur [-1, 1], il
+/// est inférieur à PRECISION_COEF fois le plus grand coefficient.
+#define PRECISION_COEF 1e-13L
+/// Largeur relative (sur [-1, 1]) à laquelle une racine est considérée comme
+/// trouvée.
+#define PRECISION_RACINE 1e-15L
+
+
+/**
+ * \brief Renvoie la valeur du polynôme en x par la méthode de Horner.
+ * \param coef : les 7 coefficients du polynôme,
+ * \param x : l'abscisse.
+ * \return La valeur p(x).
+ */
+long double
+common_polynome_y (const double *coef,
+                   long double   x)
+{
+  return ((((((coef[6] * x + coef[5]) * x + coef[4]) * x + coef[3]) * x +
+                                      coef[2]) * x + coef[1]) * x) + coef[0];
+}
+
+
+/**
+ * \brief Calcule la dérivée d'un polynôme.
+ * \param coef : les 7 coefficients du polynôme,
+ * \param derivee : les 7 coefficients de la dérivée, le dernier étant nul.
+ * \return Rien.
+ */
+void
+common_polynome_derive (const double *coef,
+                        double       *derivee)
+{
+  uint8_t k;
+  
+  for (k = 0; k < 6; k++)
+  {
+    derivee[k] = (k + 1) * coef[k + 1];
+  }
+  derivee[6] = 0.;
+  
+  return;
+}
+
+
+/**
+ * \brief Renvoie la valeur en t d'un polynôme de degré n par la méthode de
+ *        Horner.
+ * \param c : les n+1 coefficients,
+ * \param n : le degré,
+ * \param t : l'abscisse.
+ * \return La valeur du polynôme.
+ */
+static long double
+common_polynome_horner (const long double *c,
+                        uint8_t            n,
+                        long double        t)
+{
+  long double y = c[n]; // NS (nsiqcppstyle)
+  uint8_t     k;
+  
+  for (k = n; k > 0; k--)
+  {
+    y = y * t + c[k - 1];
+  }
+  
+  return y;
+}
+
+
+/**
+ * \brief Affine une racine en t par la méthode de Newton. La correction n'est
+ *        conservée que si elle diminue la valeur absolue du polynôme.
+ * \param c : les n+1 coefficients,
+ * \param n : le degré,
+ * \param t : la racine approchée.
+ * \return La racine affinée.
+ */
+static long double
+common_polynome_newton (const long double *c,
+                        uint8_t            n,
+                        long double        t)
+{
+  uint8_t i, k;
+  
+  for (i = 0; i < 2; i++)
+  {
+    long double y = c[n]; // NS (nsiqcppstyle)
+    long double dy = 0.L; // NS (nsiqcppstyle)
+    long double t2; // NS (nsiqcppstyle)
+    
+    for (k = n; k > 0; k--)
+    {
+      dy = dy * t + y;
+      y = y * t + c[k - 1];
+    }
+    if (dy == 0.L)
+    {
+      break;
+    }
+    t2 = t - y / dy;
+    if (fabsl (common_polynome_horner (c, n, t2)) >= fabsl (y))
+    {
+      break;
+    }
+    t = t2;
+  }
+  
+  return t;
+}
+
+
+/**
+ * \brief Calcule les racines réelles d'un polynôme de degré 3 au plus par les
+ *        formules exactes.
+ * \param c : les n+1 coefficients,
+ * \param n : le degré (1, 2 ou 3), c[n] étant non nul,
+ * \param t : les racines, non triées.
+ * \return Le nombre de racines.
+ */
+static uint8_t
+common_polynome_racines_exactes (const long double *c,
+                                 uint8_t            n,
+                                 long double       *t)
+{
+  if (n == 1)
+  {
+    t[0] = -c[0] / c[1];
+    return 1;
+  }
+  else if (n == 2)
+  {
+    long double delta = c[1] * c[1] - 4.L * c[2] * c[0]; // NS (nsiqcppstyle)
+    long double q; // NS (nsiqcppstyle)
+    
+    // Une racine double peut donner un discriminant très légèrement négatif.
+    if (delta < 0.L)
+    {
+      if (-delta > PRECISION_COEF * (c[1] * c[1] + fabsl (4.L * c[2] * c[0])))
+      {
+        return 0;
+      }
+      delta = 0.L;
+    }
+    // Formulation évitant la perte de précision lorsque b² >> 4ac.
+    q = -(c[1] + copysignl (sqrtl (delta), c[1])) / 2.L;
+    if (q == 0.L)
+    {
+      t[0] = 0.L;
+      return 1;
+    }
+    t[0] = q / c[2];
+    t[1] = c[0] / q;
+    return 2;
+  }
+  else
+  {
+    // Méthode trigonométrique de Viète pour x³ + a x² + b x + c.
+    long double a = c[2] / c[3]; // NS (nsiqcppstyle)
+    long double b = c[1] / c[3]; // NS (nsiqcppstyle)
+    long double d = c[0] / c[3]; // NS (nsiqcppstyle)
+    long double q = (a * a - 3.L * b) / 9.L; // NS (nsiqcppstyle)
+    long double r = (2.L * a * a * a - 9.L * a * b + 27.L * d) / 54.L; // NS (nsiqcppstyle)
+    
+    // Une racine double peut faire passer r² très légèrement au-dessus de q³.
+    if ((q > 0.L) && (r * r <= q * q * q * (1.L + PRECISION_COEF * 10.L)))
+    {
+      long double theta; // NS (nsiqcppstyle)
+      long double sq = sqrtl (q); // NS (nsiqcppstyle)
+      
+      theta = acosl (std::max (-1.L, std::min (1.L, r / (sq * sq * sq))));
+      t[0] = -2.L * sq * cosl (theta / 3.L) - a / 3.L;
+      t[1] = -2.L * sq * cosl ((theta + 2.L * M_PI) / 3.L) - a / 3.L;
+      t[2] = -2.L * sq * cosl ((theta - 2.L * M_PI) / 3.L) - a / 3.L;
+      return 3;
+    }
+    else
+    {
+      long double aa, bb; // NS (nsiqcppstyle)
+      
+      aa = -copysignl (cbrtl (fabsl (r) + sqrtl (r * r - q * q * q)), r);
+      bb = (aa == 0.L) ? 0.L : q / aa;
+      t[0] = (aa + bb) - a / 3.L;
+      return 1;
+    }
+  }
+}
+
+
+/**
+ * \brief Calcule le reste de la division de a par b.
+ * \param a : les na+1 coefficients du dividende, remplacés par le reste,
+ * \param na : le degré du dividende,
+ * \param b : les nb+1 coefficients du diviseur,
+ * \param nb : le degré du diviseur, inférieur ou égal à na.
+ * \return Rien.
+ */
+static void
+common_polynome_reste (long double       *a,
+                       uint8_t            na,
+                       const long double *b,
+                       uint8_t            nb)
+{
+  uint8_t i, k;
+  
+  for (i = na; i >= nb; i--)
+  {
+    long double q = a[i] / b[nb]; // NS (nsiqcppstyle)
+    
+    for (k = 0; k <= nb; k++)
+    {
+      a[i - nb + k] -= q * b[k];
+    }
+    a[i] = 0.L;
+    if (i == nb)
+    {
+      break;
+    }
+  }
+  
+  return;
+}
+
+
+/**
+ * \brief Renvoie le nombre de changements de signe de la suite de Sturm en t.
+ * \param suite : les polynômes de la suite, 7 coefficients chacun,
+ * \param degres : le degré de chaque polynôme,
+ * \param nb : le nombre de polynômes,
+ * \param t : l'abscisse.
+ * \return Le nombre de changements de signe.
+ */
+static uint8_t
+common_polynome_sturm_signes (long double suite[7][7],
+                              uint8_t     degres[7],
+                              uint8_t     nb,
+                              long double t)
+{
+  uint8_t     i, changements = 0;
+  long double precedent = 0.L; // NS (nsiqcppstyle)
+  
+  for (i = 0; i < nb; i++)
+  {
+    long double y = common_polynome_horner (suite[i], degres[i], t); // NS (nsiqcppstyle)
+    
+    if (y == 0.L)
+    {
+      continue;
+    }
+    if ((precedent != 0.L) && (std::signbit (y) != std::signbit (precedent)))
+    {
+      changements++;
+    }
+    precedent = y;
+  }
+  
+  return changements;
+}
+
+
+/**
+ * \brief Calcule les racines réelles distinctes d'un polynôme de degré 4 à 6
+ *        dans [-1, 1] à l'aide d'une suite de Sturm.
+ * \param c : les n+1 coefficients,
+ * \param n : le degré,
+ * \param t : les racines, triées par ordre croissant.
+ * \return Le nombre de racines.
+ */
+static uint8_t
+common_polynome_racines_sturm (const long double *c,
+                               uint8_t            n,
+                               long double       *t)
+{
+  long double suite[7][7];
+  uint8_t     degres[7];
+  uint8_t     nb_suite, k, nb = 0;
+  long double bornes_a[7], bornes_b[7]; // NS (nsiqcppstyle)
+  uint8_t     signes_a[7], signes_b[7];
+  uint8_t     nb_pile = 0;
+  // On élargit légèrement l'intervalle pour ne pas perdre les racines
+  // situées exactement aux extrémités.
+  long double debut = -1.L - 16.L * PRECISION_RACINE; // NS (nsiqcppstyle)
+  long double fin = 1.L + 16.L * PRECISION_RACINE; // NS (nsiqcppstyle)
+  
+  // Construction de la suite : p0 = p, p1 = p', pi+1 = -reste (pi-1, pi).
+  for (k = 0; k <= n; k++)
+  {
+    suite[0][k] = c[k];
+  }
+  degres[0] = n;
+  for (k = 0; k < n; k++)
+  {
+    suite[1][k] = (k + 1) * c[k + 1];
+  }
+  degres[1] = (uint8_t) (n - 1U);
+  nb_suite = 2;
+  while (degres[nb_suite - 1] > 0)
+  {
+    long double maxi = 0.L; // NS (nsiqcppstyle)
+    uint8_t     d;
+    
+    for (k = 0; k <= degres[nb_suite - 2]; k++)
+    {
+      suite[nb_suite][k] = suite[nb_suite - 2][k];
+      maxi = std::max (maxi, fabsl (suite[nb_suite][k]));
+    }
+    common_polynome_reste (suite[nb_suite],
+                           degres[nb_suite - 2],
+                           suite[nb_suite - 1],
+                           degres[nb_suite - 1]);
+    
+    // Le reste est de degré inférieur au diviseur. Les coefficients
+    // négligeables devant ceux du dividende sont supprimés.
+    d = (uint8_t) (degres[nb_suite - 1] - 1U);
+    while ((d > 0) && (fabsl (suite[nb_suite][d]) <= PRECISION_COEF * maxi))
+    {
+      d--;
+    }
+    if (fabsl (suite[nb_suite][d]) <= PRECISION_COEF * maxi)
+    {
+      // Reste nul : le dernier polynôme est le PGCD de p et p'.
+      break;
+    }
+    for (k = 0; k <= d; k++)
+    {
+      suite[nb_suite][k] = -suite[nb_suite][k];
+    }
+    degres[nb_suite] = d;
+    nb_suite++;
+  }
+  
+  // Isolation des racines par dichotomie sur le nombre de changements de
+  // signe puis affinement de chaque racine isolée.
+  bornes_a[0] = debut;
+  bornes_b[0] = fin;
+  signes_a[0] = common_polynome_sturm_signes (suite, degres, nb_suite, debut);
+  signes_b[0] = common_polynome_sturm_signes (suite, degres, nb_suite, fin);
+  nb_pile = 1;
+  while (nb_pile > 0)
+  {
+    long double a, b, milieu; // NS (nsiqcppstyle)
+    uint8_t     sa, sb, sm;
+    
+    nb_pile--;
+    a = bornes_a[nb_pile];
+    b = bornes_b[nb_pile];
+    sa = signes_a[nb_pile];
+    sb = signes_b[nb_pile];
+    if (sa <= sb)
+    {
+      continue;
+    }
+    
+    // Pour chaque intervalle contenant plusieurs racines Faire
+    //   Division en deux.
+    // FinPour
+    // Pour chaque intervalle contenant une seule racine Faire
+    //   Dichotomie jusqu'à la précision souhaitée.
+    // FinPour
+    while (b - a > PRECISION_RACINE)
+    {
+      milieu = (a + b) / 2.L;
+      sm = common_polynome_sturm_signes (suite, degres, nb_suite, milieu);
+      if ((sa - sb > 1) && (sa > sm) && (sm > sb) && (nb_pile < 7))
+      {
+        bornes_a[nb_pile] = milieu;
+        bornes_b[nb_pile] = b;
+        signes_a[nb_pile] = sm;
+        signes_b[nb_pile] = sb;
+        nb_pile++;
+        b = milieu;
+        sb = sm;
+      }
+      else if (sa > sm)
+      {
+        b = milieu;
+        sb = sm;
+      }
+      else
+      {
+        a = milieu;
+        sa = sm;
+      }
+    }
+    t[nb] = common_polynome_newton (c, n, (a + b) / 2.L);
+    nb++;
+  }
+  
+  std::sort (t, t + nb);
+  
+  return nb;
+}
+
+
+/**
+ * \brief Calcule les racines réelles distinctes d'un polynôme de degré 6 au
+ *        plus sur l'intervalle [debut, fin]. Les racines sont calculées par
+ *        les formules exactes jusqu'au degré 3 et par une suite de Sturm
+ *        au-delà.
+ * \param coef : les 7 coefficients du polynôme,
+ * \param debut : le début de l'intervalle,
+ * \param fin : la fin de l'intervalle,
+ * \param racines : les racines, triées par ordre croissant. Le tableau doit
+ *                  pouvoir contenir 6 valeurs.
+ * \return Le nombre de racines. 0 si le polynôme est identiquement nul ou si
+ *         fin <= debut.
+ */
+uint8_t
+common_polynome_racines (const double *coef,
+                         double        debut,
+                         double        fin,
+                         double       *racines)
+{
+  long double c[7], t[6]; // NS (nsiqcppstyle)
+  long double m = (debut + fin) / 2.L; // NS (nsiqcppstyle)
+  long double h = (fin - debut) / 2.L; // NS (nsiqcppstyle)
+  long double hk = 1.L, maxi = 0.L; // NS (nsiqcppstyle)
+  uint8_t     n, i, k, nb, retour = 0;
+  
+  if (!(fin > debut))
+  {
+    return 0;
+  }
+  
+  // Changement de variable x = m + h t : décalage de Taylor puis mise à
+  // l'échelle.
+  for (k = 0; k < 7; k++)
+  {
+    c[k] = coef[k];
+  }
+  for (i = 0; i < 6; i++)
+  {
+    for (k = 5; k >= i; k--)
+    {
+      c[k] += m * c[k + 1];
+      if (k == 0)
+      {
+        break;
+      }
+    }
+  }
+  for (k = 0; k < 7; k++)
+  {
+    c[k] = c[k] * hk;
+    hk = hk * h;
+    maxi = std::max (maxi, fabsl (c[k]));
+  }
+  
+  // Détermination du degré réel.
+  n = 6;
+  while ((n > 0) && (fabsl (c[n]) <= PRECISION_COEF * maxi))
+  {
+    n--;
+  }
+  if (n == 0)
+  {
+    return 0;
+  }
+  
+  if (n <= 3)
+  {
+    nb = common_polynome_racines_exactes (c, n, t);
+    for (i = 0; i < nb; i++)
+    {
+      t[i] = common_polynome_newton (c, n, t[i]);
+    }
+    std::sort (t, t + nb);
+  }
+  else
+  {
+    nb = common_polynome_racines_sturm (c, n, t);
+  }
+  
+  // Retour dans le repère d'origine, suppression des racines hors intervalle
+  // et des doublons.
+  for (i = 0; i < nb; i++)
+  {
+    double x;
+    
+    if ((t[i] < -1.L - 16.L * PRECISION_RACINE) ||
+        (t[i] > 1.L + 16.L * PRECISION_RACINE))
+    {
+      continue;
+    }
+    x = (double) (m + h * std::max (-1.L, std::min (1.L, t[i])));
+    if ((retour != 0) &&
+        (fabs (x - racines[retour - 1]) <= (double) (h * PRECISION_RACINE * 16.L)))
+    {
+      continue;
+    }
+    racines[retour] = x;
+    retour++;
+  }
+  
+  return retour;
+}
+
+
+/* vim:set shiftwidth=2 softtabstop=2 expandtab: */
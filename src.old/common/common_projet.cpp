@@ -148,6 +148,7 @@ CProjet::~CProjet ()
   // il est nécessaire d'avoir accès aux informations contenues dans les
   // noeuds.
   BUG (EF_calculs_free (p), false)
+  BUG (EF_rigidite_free_symbolique (p), false)
   BUG (EF_sections_free (p), false)
   BUG (EF_noeuds_free (p), false)
   BUG (_1992_1_1_barres_free (p), false)
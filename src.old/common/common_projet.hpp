@@ -226,6 +226,75 @@ typedef enum
 } Type_EF_Appui;
 
 
+/**
+ * \enum EF_Solveur
+ * \brief Méthode de factorisation de la matrice de rigidité partielle.
+ */
+typedef enum
+{
+  /// Factorisation LU (UMFPACK) de la matrice complète.
+  EF_SOLVEUR_LU = 0,
+  /// Factorisation de Cholesky supernodale (CHOLMOD) du seul triangle
+  /// supérieur. La factorisation LU est utilisée si la matrice n'est pas
+  /// définie positive (mécanisme, matrice singulière).
+  EF_SOLVEUR_CHOLESKY,
+  /// Gradient conjugué préconditionné. Aucune factorisation n'est réalisée,
+  /// la mémoire utilisée reste proportionnelle au nombre de termes non nuls
+  /// de la matrice de rigidité partielle.
+  EF_SOLVEUR_GRADIENT_CONJUGUE,
+  /// Sous-structuration : l'intérieur de chaque sous-structure est factorisé
+  /// par un fil d'exécution distinct puis le complément de Schur de
+  /// l'interface est assemblé et factorisé. La factorisation LU est utilisée
+  /// en cas d'échec.
+  EF_SOLVEUR_SOUS_STRUCTURES,
+  /// Factorisation de Cholesky en simple précision et raffinement itératif
+  /// en double précision. L'analyse symbolique est celle de
+  /// EF_SOLVEUR_CHOLESKY, seules les valeurs du facteur sont en simple
+  /// précision. La factorisation LU est utilisée si la matrice n'est pas
+  /// définie positive.
+  EF_SOLVEUR_PRECISION_MIXTE
+} EF_Solveur;
+
+
+/**
+ * \enum EF_Ordonnancement
+ * \brief Renumérotation des degrés de liberté limitant le remplissage des
+ *        factorisations.
+ */
+typedef enum
+{
+  /// Choix de la librairie : AMD (complété par la dissection emboîtée si
+  /// METIS est disponible) pour CHOLMOD, AMD ou COLAMD pour UMFPACK.
+  EF_ORDRE_DEFAUT = 0,
+  /// Degré minimum approché (AMD).
+  EF_ORDRE_AMD,
+  /// Degré minimum approché sur les colonnes (COLAMD). CHOLMOD utilise AMD
+  /// pour une matrice symétrique.
+  EF_ORDRE_COLAMD,
+  /// Dissection emboîtée par le partitionnement de CHOLMOD (NESDIS).
+  EF_ORDRE_DISSECTION,
+  /// Cuthill-McKee inverse sur le graphe des noeuds, chaque noeud apportant
+  /// ensemble ses degrés de liberté libres.
+  EF_ORDRE_RCM
+} EF_Ordonnancement;
+
+
+/**
+ * \enum EF_Preconditionneur
+ * \brief Préconditionneur utilisé par le solveur EF_SOLVEUR_GRADIENT_CONJUGUE.
+ */
+typedef enum
+{
+  /// Inverse de la diagonale de la matrice de rigidité partielle.
+  EF_PRECOND_JACOBI = 0,
+  /// Inverse du bloc 6×6 (ou moins si des degrés de liberté sont bloqués) de
+  /// chaque noeud.
+  EF_PRECOND_BLOC_JACOBI,
+  /// Factorisation de Cholesky incomplète sans remplissage (IC(0)).
+  EF_PRECOND_CHOLESKY_INCOMPLET
+} EF_Preconditionneur;
+
+
 /**
  * \enum EF_Relachement_Type
  * \brief Type de relâchement.
@@ -445,6 +514,8 @@ typedef struct
   Flottant ecm;
   /// Coefficient de poisson.
   Flottant nu;
+  /// Masse volumique en kg/m³.
+  Flottant rho;
 } Materiau_Beton;
 
 
@@ -463,6 +534,8 @@ typedef struct
   Flottant e;
   /// Coefficient de poisson.
   Flottant nu;
+  /// Masse volumique en kg/m³.
+  Flottant rho;
 } Materiau_Acier;
 
 
@@ -629,46 +702,24 @@ typedef struct
 } Analyse_Comm;
 
 
-/**
- * \struct Troncon
- * \brief Définition de la structure Troncon qui contient une fonction avec un
- *        domaine de validité précis. La fonction mathématique est définie par
- *        x0 + x1*x + x2*x^2 + x3*x^3 + x4*x^4 + x5*x^5 + x6*x^6.
- */
-typedef struct
-{
-  /// Début du tronçon de validité de la fonction.
-  double debut_troncon;
-  /// Fin du tronçon de validité de la fonction.
-  double fin_troncon;
-  /// Coefficient x0.
-  double x0;
-  /// Coefficient x1.
-  double x1;
-  /// Coefficient x2.
-  double x2;
-  /// Coefficient x3.
-  double x3;
-  /// Coefficient x4.
-  double x4;
-  /// Coefficient x5.
-  double x5;
-  /// Coefficient x6.
-  double x6;
-} Troncon;
-
-
 /**
  * \struct Fonction
- * \brief Une fonction décrit une courbe sous forme d'une liste de troncons.
+ * \brief Une fonction décrit une courbe sous forme d'une suite de troncons.
  *        Les fonctions n'étant pas forcément continues le long de la barre
  *        (par exemple de part et d'une charge ponctuelle). Il est nécessaire
- *        de définir plusieurs tronçons avec pour chaque tronçon sa fonction.
+ *        de définir plusieurs tronçons avec pour chaque tronçon sa fonction.\n
+ *        Les tronçons sont stockés dans deux tableaux contigus : le tronçon i
+ *        est valide entre bornes[i] et bornes[i+1] et sa fonction
+ *        mathématique est définie par \f$\sum_{k=0}^{6} coef[i*7+k] \cdot
+ *        x^k\f$.
  */
 typedef struct
 {
-  /// Tableau dynamique contenant les fonctions continues par tronçon.
-  std::list <Troncon *> t;
+  /// Abscisses des jonctions entre tronçons, triées par ordre croissant.
+  /// Contient le nombre de tronçons + 1 valeurs (ou aucune si vide).
+  std::vector <double> bornes;
+  /// Coefficients x0 à x6 de chaque tronçon, 7 valeurs par tronçon.
+  std::vector <double> coef;
 } Fonction;
 
 
@@ -1441,6 +1492,13 @@ typedef struct
    * celui du numéro du dernier noeud + 1.
    */
   uint32_t    numero;
+  /// Position du noeud dans la liste p->modele.noeuds.
+  /**
+   * Est maintenu à jour lors de l'ajout et de la suppression de noeuds. Il
+   * permet de retrouver en temps constant la ligne du noeud dans les matrices
+   * de calcul.
+   */
+  uint32_t    indice;
   /// Type de noeud : Libre ou le long d'une barre.
   Type_Noeud  type;
   /// Contient les données permettant de récupérer les coordonnées
@@ -1450,6 +1508,12 @@ typedef struct
   void       *data;
   /// Défini l'appui du noeud. Peut-être NULL si le noeud est libre.
   EF_Appui   *appui;
+  /// Sous-structure du noeud pour le solveur EF_SOLVEUR_SOUS_STRUCTURES.
+  /**
+   * 0 : automatique. Le partitionnement défini par l'utilisateur n'est
+   * utilisé que si tous les noeuds ont une sous-structure non nulle.
+   */
+  uint16_t    sous_structure;
 #ifdef ENABLE_GTK
   /// Affichage graphique dans le treeview de la fenêtre Noeud.
   GtkTreeIter Iter;
@@ -1520,8 +1584,11 @@ typedef struct
  */
 typedef struct
 {
-  /// Matrice de rigidite locale.
-  cholmod_sparse *m_rig_loc;
+  /// Matrice de rigidite locale 12×12, stockée colonne par colonne.
+  double          k_loc[144];
+  /// Numéro du tronçon dans les tables de dispersion p->calculs.disp_part et
+  /// p->calculs.disp_reac.
+  uint32_t        troncon;
   
   /// Paramètre de souplesse a de la poutre selon l'axe y.
   double ay;
@@ -1563,6 +1630,11 @@ typedef struct
    * celui du numéro de la dernière barre + 1.
    */
   uint32_t        numero;
+  /// Position de la barre dans la liste p->modele.barres.
+  /**
+   * Est maintenu à jour lors de l'ajout et de la suppression de barres.
+   */
+  uint32_t        indice;
   /// Le type d'élément.
   Type_Element    type;
   /// La section de la barre.
@@ -1590,10 +1662,11 @@ typedef struct
   /// L'affichage graphique dans la fenêtre graphique.
   GtkTreeIter     Iter;
 #endif
-  /// Matrice de rotation de la barre.
-  cholmod_sparse *m_rot;
-  /// Matrice de rotation transposée de la barre.
-  cholmod_sparse *m_rot_t;
+  /// Matrice de rotation 3×3 de la barre, stockée ligne par ligne.
+  /** La matrice de rotation 12×12 d'un tronçon est diagonale par blocs et
+   *  composée de 4 fois cette matrice.
+   */
+  double          rot[9];
 } EF_Barre;
 
 
@@ -1738,6 +1811,22 @@ typedef struct
 } Ponderation;
 
 
+/**
+ * \struct Ponderation_Resultat
+ * \brief Résultat d'une pondération évalué à la demande. Seul le coefficient
+ *        de chaque action est conservé. Les efforts, déplacements et réactions
+ *        sont obtenus par combinaison linéaire des résultats des actions au
+ *        moment de la demande.
+ */
+typedef struct
+{
+  /// Les actions de la pondération, chacune présente une seule fois.
+  std::vector <Action *> actions;
+  /// Le coefficient de chaque action, pondération et psi compris.
+  std::vector <double>   coefs;
+} Ponderation_Resultat;
+
+
 /**
  * \struct Combinaison
  * \brief Contient une action et un flag pour savoir si les actions variables
@@ -1863,6 +1952,106 @@ typedef struct
 } Modele;
 
 
+/**
+ * \struct EF_Sous_Structure
+ * \brief Une sous-structure du solveur EF_SOLVEUR_SOUS_STRUCTURES : ses
+ *        degrés de liberté intérieurs et leur couplage avec l'interface.
+ */
+typedef struct
+{
+  /// Paramètres de cholmod propres au fil d'exécution de la sous-structure.
+  cholmod_common         Common;
+  /// Degrés de liberté intérieurs (lignes de m_part, croissantes).
+  std::vector <uint32_t> interieur;
+  /// Degrés de liberté de l'interface couplés à l'intérieur.
+  /** Positions dans EF_Sous_Structures::interface, croissantes.
+   */
+  std::vector <uint32_t> interface;
+  /// Factorisation de Cholesky de [K_II], matrice de l'intérieur.
+  cholmod_factor        *factor;
+  /// [K_IΓ] : couplage dense de l'intérieur avec son interface.
+  /** interieur.size () × interface.size () valeurs, colonne par colonne.
+   */
+  double                *k_ig;
+  /// Contribution au complément de Schur : [K_IΓ]^T · [K_II]^-1 · [K_IΓ].
+  double                *schur;
+  /// Espace de travail de la résolution (interface.size () × nb valeurs).
+  double                *travail;
+} EF_Sous_Structure;
+
+
+/**
+ * \struct EF_Sous_Structures
+ * \brief Décomposition de la matrice de rigidité partielle en
+ *        sous-structures reliées par une interface.
+ */
+typedef struct
+{
+  /// Les sous-structures.
+  std::vector <EF_Sous_Structure *> parties;
+  /// Degrés de liberté de l'interface (lignes de m_part, croissantes).
+  std::vector <uint32_t> interface;
+  /// Pour chaque ligne de m_part, sa position dans interieur ou interface.
+  std::vector <uint32_t> position;
+  /// Pour chaque ligne de m_part, sa sous-structure (UINT32_MAX : interface).
+  std::vector <uint32_t> partie;
+  /// Facteur de Cholesky dense (triangle inférieur) du complément de Schur.
+  /** interface.size () × interface.size () valeurs, colonne par colonne.
+   */
+  double                *schur;
+} EF_Sous_Structures;
+
+
+/**
+ * \struct EF_Mode
+ * \brief Un mode propre de vibration de la structure.
+ */
+typedef struct
+{
+  /// Pulsation propre en rad/s.
+  double          pulsation;
+  /// Fréquence propre en Hz.
+  double          frequence;
+  /// Masse modale effective selon x, y et z en kg.
+  double          masse_effective[3];
+  /// Déformée modale normée par rapport à la masse ({φ}^T[M]{φ} = 1).
+  /** Même organisation que Action::deplacement : 6 valeurs par noeud, nulles
+   *  pour les degrés de liberté bloqués.
+   */
+  cholmod_sparse *deformee;
+} EF_Mode;
+
+
+/**
+ * \struct EF_Influence
+ * \brief Lignes d'influence des sollicitations le long d'un chemin de barres.
+ *        Les sections et les positions de la charge unitaire sont les noeuds
+ *        du chemin (extrémités des barres et noeuds intermédiaires).
+ */
+typedef struct
+{
+  /// Barre de chaque section.
+  std::vector <EF_Barre *> barres;
+  /// Tronçon de la barre dont l'extrémité est la section.
+  std::vector <uint32_t>   troncons;
+  /// true si la section est le noeud de fin du tronçon, false s'il s'agit du
+  /// noeud de début.
+  std::vector <bool>       fins;
+  /// Noeud de chaque section.
+  std::vector <EF_Noeud *> noeuds;
+  /// Abscisse curviligne de chaque section depuis le début du chemin en m.
+  std::vector <double>     abscisses;
+  /// Direction de la charge unitaire dans le repère global.
+  double                   direction[3];
+  /// Les lignes d'influence.
+  /** Pour la section s, la sollicitation c (N, Ty, Tz, Mx, My, Mz dans le
+   *  repère local de la barre) et la position k de la charge unitaire :
+   *  lignes[(s × 6 + c) × nb_sections + k].
+   */
+  double                  *lignes;
+} EF_Influence;
+
+
 /**
  * \struct Calculs
  * \brief Contient toutes les données nécessaires pour la réalisation des
@@ -1872,10 +2061,10 @@ typedef struct
  * noeud et sa position dans la matrice de rigidité globale partielle et
  * complète. Par partielle, il faut comprendre la matrice de rigidité globale
  * sans les lignes et les colonnes dont les déplacements sont connus ; cette
- * même matrice qui permet de déterminer le déplacement des noeuds. La matrice
- * de rigidité complète permet, sur la base du calcul des déplacements, de
- * déterminer les efforts aux noeuds et d'en déduire les sollicitations le long
- * des barres. La position de la ligne / colonne dans la matrice se déterminera
+ * même matrice qui permet de déterminer le déplacement des noeuds. Seules les
+ * lignes de la matrice de rigidité complète des degrés de liberté bloqués
+ * sont conservées : elles permettent, sur la base du calcul des déplacements,
+ * de déterminer les réactions d'appui. La position de la ligne / colonne dans la matrice se déterminera
  * par la lecture de n_part[10][1] pour, par exemple, la position du noeud dont
  * le numéro est le 10 et comme degré de liberté y. Si la valeur renvoyée est
  * -1, cela signifie que le déplacement ou la rotation est bloquée et que le
@@ -1899,40 +2088,224 @@ typedef struct
    *  [0à5]].
    */
   uint32_t       **n_comp;
+  /// Nombre de lignes de n_part et n_comp.
+  uint32_t         nb_noeuds;
   
-  /// Triplet contenant la matrice de rigidité.
-  /** Variable temporaire avant transformation en matrice sparse. Les éléments
-   * sont ajoutés au fur et à mesure que la rigidité des barres est ajoutée
-   * dans la matrice de rigidité.
+  /// Matrice de rigidité partielle en format sparse.
+  /** Sa structure est déterminée par #EF_calculs_initialise, les valeurs sont
+   *  ensuite cumulées directement dans m_part->x par l'ajout de la rigidité
+   *  des barres via la table disp_part.
    */
-  cholmod_triplet *t_part;
-  /// Triplet contenant la matrice de rigidité complète.
-  cholmod_triplet *t_comp;
+  cholmod_sparse  *m_part;
+  /// Nombre de degrés de liberté bloqués (lignes de réaction).
+  uint32_t         nb_reactions;
+  /// Lignes de la matrice de rigidité complète des degrés de liberté bloqués.
+  /** Format CSR : la ligne r correspond au degré de liberté reac_ligne[r]
+   *  (numérotation n_comp) et contient les termes reac_x[reac_p[r] ..
+   *  reac_p[r + 1] - 1] des colonnes reac_i, numérotées comme n_part. Les
+   *  colonnes des degrés de liberté bloqués, de déplacement nul, ne sont pas
+   *  conservées. Les réactions d'appui valent alors \end{verbatim}
+   *  \begin{displaymath}\{R\} = [K_{b}] \cdot \{D\} - \{F_b\}
+   *  \end{displaymath}\begin{verbatim}
+   */
+  uint32_t        *reac_ligne;
+  /// Début de chaque ligne de réaction dans reac_i et reac_x.
+  uint32_t        *reac_p;
+  /// Colonne (numérotation n_part) de chaque terme de réaction.
+  uint32_t        *reac_i;
+  /// Valeur de chaque terme de réaction.
+  double          *reac_x;
   
-  /// Numéro de la prochaine donnée du triplet t_part qui est à compléter.
-  uint32_t         t_part_en_cours;
-  /// Numéro de la prochaine donnée du triplet t_comp qui est à compléter.
-  uint32_t         t_comp_en_cours;
+  /// Nombre de fils d'exécution pour le calcul des matrices élémentaires.
+  /** 0 : autant que de cœurs disponibles (std::thread::hardware_concurrency).
+   */
+  uint32_t         nb_fils;
+  /// Nombre total de tronçons (barres discrétisées) du modèle.
+  uint32_t         nb_troncons;
+  /// Table de dispersion des matrices de rigidité élémentaires dans m_part.
+  /** Pour le tronçon t (Barre_Info_EF::troncon), l'élément (i, j) de la
+   *  matrice de rigidité élémentaire 12×12 dans le repère global est cumulé
+   *  dans m_part->x[disp_part[t * 144 + j * 12 + i]]. Vaut UINT32_MAX si
+   *  l'un des deux degrés de liberté est bloqué.
+   */
+  uint32_t        *disp_part;
+  /// Table de dispersion des matrices de rigidité élémentaires dans reac_x.
+  /** Même convention que disp_part. Vaut UINT32_MAX si la ligne n'est pas
+   *  bloquée ou si la colonne l'est.
+   */
+  uint32_t        *disp_reac;
   
-  /// Matrice de rigidité partielle t_part en format sparse.
-  cholmod_sparse  *m_part;
-  /// Matrice de rigidité globale t_comp en format sparse.
-  cholmod_sparse  *m_comp;
+  /// Condensation statique des noeuds intermédiaires des barres.
+  /** Si true, les noeuds intermédiaires d'une barre sans appui et reliés
+   *  uniquement aux tronçons de cette barre sont éliminés de m_part : la
+   *  barre y est remplacée par un super-élément 12×12 reliant ses deux
+   *  extrémités. Les déplacements des noeuds condensés sont restitués barre
+   *  par barre après la résolution.
+   */
+  bool             condensation;
+  /// Nombre de degrés de liberté libres, y compris ceux condensés.
+  /** Les degrés de liberté des noeuds condensés sont numérotés dans n_part à
+   *  partir de m_part->nrow. Vaut m_part->nrow sans condensation.
+   */
+  uint32_t         nb_ddl;
+  /// Table de dispersion du super-élément de chaque barre condensée.
+  /** 144 valeurs par barre indexées par EF_Barre::indice, même convention
+   *  que disp_part.
+   */
+  uint32_t        *disp_cond;
+  /// Position dans cond_x des données de chaque barre (EF_Barre::indice).
+  /** SIZE_MAX si la barre n'est pas condensée.
+   */
+  size_t          *cond_pos;
+  /// Données de condensation des barres. NULL si aucune barre n'est condensée.
+  /** Pour une barre de m = 6 × nds_inter.size () degrés de liberté internes :
+   *  - le super-élément [K_c] (144 valeurs, colonne par colonne),
+   *  - le facteur de Cholesky bande de [K_ii] (12 × m valeurs : L(i, j) est
+   *    stocké en j × 12 + i - j),
+   *  - [Y] = [K_ii]^-1 · [K_ie] (m × 12 valeurs, colonne par colonne).
+   */
+  double          *cond_x;
   
+  /// Méthode de factorisation demandée.
+  EF_Solveur       solveur;
+  /// Renumérotation utilisée par l'analyse symbolique.
+  EF_Ordonnancement ordonnancement;
+  /// Factorisation de Cholesky de m_part si solveur vaut EF_SOLVEUR_CHOLESKY.
+  /** NULL si la factorisation LU (numeric) a été utilisée. Dans le cas
+   *  contraire, m_part ne contient que son triangle supérieur (stype = 1).
+   */
+  cholmod_factor  *factor;
+  /// Nombre de mises à jour de rang faible appliquées à factor.
+  /** Remis à 0 à chaque factorisation complète. Une fois la première mise à
+   *  jour faite, factor est un facteur simplicial LDL^T.
+   */
+  uint32_t         updown_nb;
+  /// Nombre de mises à jour au-delà duquel factor est refactorisé.
+  uint32_t         updown_nb_max;
+  /// Rang maximal d'une mise à jour. Au-delà, factor est refactorisé.
+  uint32_t         updown_rang_max;
+  /// Résidu relatif maximal ||K.D-F|| / ||F|| accepté après une mise à jour.
+  double           updown_tolerance;
   /// Variable temporaire utilisée par la fonction umfpack_di_solve.
   /** Utilisée pour le calcul de la matrice partielle lors de la résolution de
    * chaque cas de charges.
    */
   void            *numeric;
-  /// Pointeur vers la colonne de la matrice t_part.
+  
+  /// Préconditionneur demandé pour le solveur EF_SOLVEUR_GRADIENT_CONJUGUE.
+  EF_Preconditionneur precond;
+  /// Tolérance du gradient conjugué sur le résidu relatif ||K.D-F|| / ||F||.
+  double           gc_tolerance;
+  /// Nombre maximal d'itérations du gradient conjugué. 0 : m_part->nrow.
+  uint32_t         gc_iter_max;
+  /// Valeurs du préconditionneur du gradient conjugué.
+  /** NULL si une factorisation (factor ou numeric) a été utilisée. Sinon :
+   *  - EF_PRECOND_JACOBI : inverse de la diagonale (nrow valeurs),
+   *  - EF_PRECOND_BLOC_JACOBI : inverse du bloc de chaque noeud (36 valeurs
+   *    par noeud, stockées colonne par colonne),
+   *  - EF_PRECOND_CHOLESKY_INCOMPLET : facteur L ayant la structure du
+   *    triangle inférieur de m_part, décrite par precond_p et precond_i.
+   */
+  double          *precond_x;
+  /// Pointeur vers les colonnes du facteur de Cholesky incomplet.
+  int             *precond_p; // NS
+  /// Lignes des termes du facteur de Cholesky incomplet.
+  int             *precond_i; // NS
+  /// Préconditionneur effectivement utilisé.
+  /** Peut différer de precond si la construction du préconditionneur demandé
+   *  a échoué (pivot négatif).
+   */
+  EF_Preconditionneur precond_utilise;
+  /// Nombre de sous-structures du solveur EF_SOLVEUR_SOUS_STRUCTURES.
+  /** 0 : autant que de fils d'exécution (nb_fils).
+   */
+  uint32_t         nb_sous_structures;
+  /// Sous-structuration de m_part. NULL si un autre solveur est utilisé.
+  EF_Sous_Structures *sous_structures;
+  /// Facteur de Cholesky en simple précision (EF_SOLVEUR_PRECISION_MIXTE).
+  /** NULL si un autre solveur est utilisé. Facteur [L], de structure celle
+   *  de symbolique_chol, stocké par colonnes : la colonne a contient les
+   *  termes mixte_x[mixte_pos[a]] à mixte_x[mixte_pos[a + 1] - 1], le
+   *  premier étant le terme diagonal.
+   */
+  float           *mixte_x;
+  /// Début de chaque colonne du facteur dans mixte_x (nrow + 1 valeurs).
+  size_t          *mixte_pos;
+  /// Ligne de chaque terme de mixte_x.
+  uint32_t        *mixte_ligne;
+  /// Renumérotation : mixte_perm[a] est la colonne de m_part en position a.
+  int             *mixte_perm; // NS
+  /// Résidu relatif maximal (norme infinie) visé par le raffinement.
+  /** Le résidu relatif atteignable en double précision est de l'ordre du
+   *  conditionnement de [K] multiplié par 1e-16 : 1e-10 par défaut.
+   */
+  double           mixte_tolerance;
+  /// Nombre maximal d'itérations du raffinement itératif.
+  uint32_t         mixte_iter_max;
+  /// Triangle supérieur de [K] + [K_G] pour le calcul au second ordre.
+  /** Sa structure contient tous les couples de degrés de liberté de chaque
+   *  tronçon, elle est construite une seule fois et conservée d'une itération
+   *  et d'une action à l'autre.
+   */
+  cholmod_sparse  *second_ordre_k;
+  /// Valeurs de la matrice de rigidité linéaire dans second_ordre_k.
+  double          *second_ordre_x0;
+  /// Factorisation de second_ordre_k. L'analyse symbolique est conservée,
+  /// seule la factorisation numérique est refaite à chaque itération.
+  cholmod_factor  *second_ordre_factor;
+  /// Déplacement relatif maximal (norme infinie) visé par le calcul au
+  /// second ordre.
+  double           second_ordre_tolerance;
+  /// Nombre maximal d'itérations du calcul au second ordre.
+  uint32_t         second_ordre_iter_max;
+  /// Pointeur vers la colonne de la matrice m_part.
   int             *ap; // NS
   /// La colonne j de la matrice est définie par Ai [(Ap [j]) … (Ap [j+1]-1)].
   int             *ai; // NS
   /// Le résultat. Ax [(Ap [j]) ... (Ap [j+1]-1)].
   double          *ax;
   
+  /// Empreinte de la topologie ayant servi aux analyses symboliques.
+  /** Les analyses symboliques ci-dessous sont conservées par #EF_calculs_free
+   *  et réutilisées tant que l'empreinte de n_part, n_comp et de la
+   *  connectivité des barres ne change pas. Seule la factorisation numérique
+   *  est alors refaite.
+   */
+  uint64_t         symbolique_cle;
+  /// Analyse symbolique (permutation et structure) de Cholesky de m_part.
+  cholmod_factor  *symbolique_chol;
+  /// Analyse symbolique d'UMFPACK de m_part.
+  void            *symbolique_lu;
+  /// Prévisions de l'analyse symbolique conservée.
+  /** Nombre de termes non nuls du facteur (L pour Cholesky, L+U pour LU),
+   *  nombre d'opérations et mémoire maximale en octets.
+   */
+  double           symbolique_prevision[3];
+  
+  /// Nombre de colonnes de for_bloc et dep_bloc (une par action).
+  uint32_t         nb_bloc;
+  /// Efforts aux noeuds de la matrice partielle pour toutes les actions.
+  /** Bloc dense de nb_ddl × nb_bloc valeurs stockées colonne par
+   *  colonne dans l'ordre de la liste des actions.
+   */
+  double          *for_bloc;
+  /// Déplacements de la matrice partielle pour toutes les actions.
+  /** Même organisation que for_bloc.
+   */
+  double          *dep_bloc;
+  
   /// Erreur non relative des réactions d'appuis.
   double           residu;
+  /// Le rapport d'analyse de la résolution (solveur, convergence, …).
+  /** NULL tant qu'aucune ligne n'a été ajoutée. Libéré par #EF_calculs_free.
+   */
+  std::list <Analyse_Comm *> *rapport;
+  /// Les modes propres calculés par #EF_modes_calcule, par fréquence
+  /// croissante.
+  /** NULL tant qu'aucune analyse modale n'a été faite. Libéré par
+   *  #EF_calculs_free.
+   */
+  std::vector <EF_Mode *> *modes;
 } Calculs;
 
 
@@ -602,7 +602,8 @@ _1992_1_1_gtk_materiaux_ajouter_clicked (GtkButton *button,
          m_f (n,         FLOTTANT_UTILISATEUR),
          m_f (ec3,       FLOTTANT_UTILISATEUR),
          m_f (ecu3,      FLOTTANT_UTILISATEUR),
-         m_f (nu,        FLOTTANT_UTILISATEUR)),
+         m_f (nu,        FLOTTANT_UTILISATEUR),
+         m_f (NAN,       FLOTTANT_UTILISATEUR)),
       )
   
   gtk_widget_destroy (UI_BET.window);
@@ -675,7 +676,8 @@ _1992_1_1_gtk_materiaux_modifier_clicked (GtkButton *button,
          m_f (n,              FLOTTANT_UTILISATEUR),
          m_f (ec3,            FLOTTANT_UTILISATEUR),
          m_f (ecu3,           FLOTTANT_UTILISATEUR),
-         m_f (nu,             FLOTTANT_UTILISATEUR)),
+         m_f (nu,             FLOTTANT_UTILISATEUR),
+         m_f (NAN,            FLOTTANT_UTILISATEUR)),
       )
   
   gtk_widget_destroy (UI_BET.window);
@@ -268,7 +268,8 @@ _1993_1_1_gtk_materiaux_ajouter_clicked (GtkButton *button,
                                   m_f (NAN, FLOTTANT_UTILISATEUR),
                                   m_f (NAN, FLOTTANT_UTILISATEUR),
                                   m_f (e, FLOTTANT_UTILISATEUR),
-                                  m_f (nu, FLOTTANT_UTILISATEUR)),
+                                  m_f (nu, FLOTTANT_UTILISATEUR),
+                                  m_f (NAN, FLOTTANT_UTILISATEUR)),
       )
   
   gtk_widget_destroy (UI_ACI.window);
@@ -311,7 +312,8 @@ _1993_1_1_gtk_materiaux_modifier_clicked (GtkButton *button,
                                   m_f (fy, FLOTTANT_UTILISATEUR),
                                   m_f (fu, FLOTTANT_UTILISATEUR),
                                   m_f (e, FLOTTANT_UTILISATEUR),
-                                  m_f (nu, FLOTTANT_UTILISATEUR)),
+                                  m_f (nu, FLOTTANT_UTILISATEUR),
+                                  m_f (NAN, FLOTTANT_UTILISATEUR)),
        , )
   
   gtk_widget_destroy (UI_ACI.window);
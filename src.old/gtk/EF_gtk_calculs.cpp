@@ -52,8 +52,6 @@ EF_gtk_calculs_calculer (GtkMenuItem *menuitem,
   
   uint16_t erreur;
   
-  std::list <Action *>::iterator it;
-  
   BUGPARAM (p, "%p", p, )
   
   BUG (EF_calculs_free (p), )
@@ -69,15 +67,10 @@ EF_gtk_calculs_calculer (GtkMenuItem *menuitem,
   BUG (EF_calculs_initialise (p), )
   BUG (_1992_1_1_barres_rigidite_ajout_tout (p), )
   BUG (EF_calculs_genere_mat_rig (p), )
-  
-  it = p->actions.begin ();
-  while (it != p->actions.end ())
+  BUG (EF_calculs_resoud_charges (p), )
+  if (p->calculs.rapport != NULL)
   {
-    Action *action = *it;
-    
-    BUG (EF_calculs_resoud_charge (p, action), )
-    
-    ++it;
+    EF_gtk_rapport (p, p->calculs.rapport);
   }
   
   BUG (_1990_combinaisons_genere (p), )
@@ -184,6 +184,7 @@ EF_gtk_materiaux_edit_nom (GtkCellRendererText *cell,
                                       m_f (NAN, FLOTTANT_ORDINATEUR),
                                       m_f (NAN, FLOTTANT_ORDINATEUR),
                                       m_f (NAN, FLOTTANT_ORDINATEUR),
+                                      m_f (NAN, FLOTTANT_ORDINATEUR),
                                       m_f (NAN, FLOTTANT_ORDINATEUR)),
           )
       break;
@@ -196,6 +197,7 @@ EF_gtk_materiaux_edit_nom (GtkCellRendererText *cell,
                                       m_f (NAN, FLOTTANT_ORDINATEUR),
                                       m_f (NAN, FLOTTANT_ORDINATEUR),
                                       m_f (NAN, FLOTTANT_ORDINATEUR),
+                                      m_f (NAN, FLOTTANT_ORDINATEUR),
                                       m_f (NAN, FLOTTANT_ORDINATEUR)),
           )
       break;
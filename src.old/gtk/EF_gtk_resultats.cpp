@@ -580,19 +580,7 @@ EF_gtk_resultats_remplit_page (Gtk_EF_Resultats_Tableau *res,
             
             std::list <Action *>::iterator it2;
             
-    #define FREE_ALL2 delete converti; \
-    for_each (comb_min.t.begin (), \
-              comb_min.t.end (), \
-              std::default_delete <Troncon> ()); \
-    for_each (comb_max.t.begin (), \
-              comb_max.t.end (), \
-              std::default_delete <Troncon> ()); \
-    for_each (f_min.t.begin (), \
-              f_min.t.end (), \
-              std::default_delete <Troncon> ()); \
-    for_each (f_max.t.begin (), \
-              f_max.t.end (), \
-              std::default_delete <Troncon> ());
+    #define FREE_ALL2 delete converti;
             
             switch (res->col_tab[j])
             {
@@ -28,6 +28,8 @@
 
 void EF_gtk_resultats      (Projet *p);
 void EF_gtk_resultats_free (Projet *p);
+bool EF_gtk_resultats_remplit_page (Gtk_EF_Resultats_Tableau *res,
+                                    Projet                   *p);
 
 #endif
 
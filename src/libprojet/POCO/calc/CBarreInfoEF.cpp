@@ -23,9 +23,8 @@
 #include "CBarreInfoEF.hpp"
 
 POCO::calc::CBarreInfoEF::CBarreInfoEF () :
-  m_rig_loc (nullptr),
-  m_rot (nullptr),
-  m_rot_t (nullptr),
+  k_loc (),
+  rot (),
   ay (NAN),
   by (NAN),
   cy (NAN),
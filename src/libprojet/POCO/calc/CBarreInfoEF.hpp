@@ -21,8 +21,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 Fichier généré automatiquement avec dia2code 0.9.0.
  */
 
-#include <cholmod.h>
-
 namespace POCO
 {
   namespace calc
@@ -30,12 +28,11 @@ namespace POCO
     /// Structure interne permettant de caractériser la poutre aux éléments finis.
     struct CBarreInfoEF
     {
-      /// Matrice de rigidite locale
-      cholmod_sparse * m_rig_loc;
-      /// Matrice de rotation de la barre.
-      cholmod_sparse * m_rot;
-      /// Matrice de rotation transposée de la barre.
-      cholmod_sparse * m_rot_t;
+      /// Matrice de rigidite locale 12×12, stockée colonne par colonne.
+      double k_loc[144];
+      /// Matrice de rotation 3×3 de la barre, stockée ligne par ligne. La
+      /// matrice de rotation 12×12 est diagonale par blocs de cette matrice.
+      double rot[9];
       /// Paramètre de souplesse a de la poutre selon l'axe y.
       double ay;
       /// Paramètre de souplesse b de la poutre selon l'axe y.
@@ -21,23 +21,24 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 Fichier généré automatiquement avec dia2code 0.9.0.
  */
 
-#include <list>
-#include "POCO/calc/CTroncon.hpp"
+#include <vector>
 
 namespace POCO
 {
   namespace calc
   {
     /**
-     * \brief Une fonction décrit une courbe sous forme d'une liste de troncons. Les fonctions n'étant pas forcément continues le long de la barre (par exemple de part et d'une charge ponctuelle). Il est nécessaire de définir plusieurs tronçons avec pour chaque tronçon sa fonction.
+     * \brief Une fonction décrit une courbe sous forme d'une suite de troncons. Les fonctions n'étant pas forcément continues le long de la barre (par exemple de part et d'une charge ponctuelle). Il est nécessaire de définir plusieurs tronçons avec pour chaque tronçon sa fonction. Le tronçon i est valide entre bornes[i] et bornes[i+1] et ses coefficients x0 à x6 sont coef[i*7] à coef[i*7+6].
      */
     class CFonction
     {
       // Associations
       // Attributes
       private :
-        /// Tableau dynamique contenant les fonctions continues par tronçon.
-        std::list <CTroncon *> t;
+        /// Abscisses des jonctions entre tronçons, triées par ordre croissant.
+        std::vector <double> bornes;
+        /// Coefficients x0 à x6 de chaque tronçon, 7 valeurs par tronçon.
+        std::vector <double> coef;
     };
   }
 }